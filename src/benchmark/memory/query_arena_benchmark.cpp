@@ -0,0 +1,43 @@
+#include <memory>
+#include <memory_resource>
+
+#include "benchmark/benchmark.h"
+
+#include "memory/query_arena.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Shared by the threads of a run of BM_ConcurrentAllocation. It is set up by the first thread before the timed loop.
+std::shared_ptr<QueryArena> benchmark_arena;
+
+}  // namespace
+
+// Allocates and frees small blocks, as operators do for their intermediates, from all threads of the run. The first
+// argument selects between a shared QueryArena (1) and the global allocator (0). The number of iterations is fixed, as
+// the arena does not reuse freed memory.
+void BM_ConcurrentAllocation(benchmark::State& state) {
+  const auto use_arena = state.range(0) == 1;
+  const auto bytes = static_cast<size_t>(state.range(1));
+  if (use_arena && state.thread_index() == 0) benchmark_arena = std::make_shared<QueryArena>();
+
+  for (auto _ : state) {
+    auto* const resource =
+        use_arena ? static_cast<std::pmr::memory_resource*>(benchmark_arena.get()) : std::pmr::get_default_resource();
+    auto* const pointer = resource->allocate(bytes);
+    benchmark::DoNotOptimize(pointer);
+    resource->deallocate(pointer, bytes);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  if (use_arena && state.thread_index() == 0) benchmark_arena = nullptr;
+}
+BENCHMARK(BM_ConcurrentAllocation)
+    ->ArgsProduct({{0, 1}, {64, 256}})
+    ->ArgNames({"arena", "bytes"})
+    ->Iterations(100'000)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+}  // namespace opossum
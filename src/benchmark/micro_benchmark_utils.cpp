@@ -0,0 +1,41 @@
+#include "micro_benchmark_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Table> create_benchmark_table(const std::string& data_type, const ChunkOffset chunk_size,
+                                              const int64_t distinct_count, const bool sorted,
+                                              const std::optional<EncodingType> encoding_type) {
+  auto generator = std::mt19937_64{42};
+  auto distribution = std::uniform_int_distribution<int64_t>{0, distinct_count - 1};
+  auto numbers = std::vector<int64_t>(BENCHMARK_ROW_COUNT);
+  std::generate(numbers.begin(), numbers.end(), [&] { return distribution(generator); });
+  if (sorted) std::sort(numbers.begin(), numbers.end());
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", data_type);
+  resolve_data_type(data_type, [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    for (const auto number : numbers) {
+      table->append({benchmark_value<DataType>(number)});
+    }
+  });
+
+  if (encoding_type) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->compress_chunk(chunk_id, *encoding_type);
+    }
+  }
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include "all_type_variant.hpp"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Number of rows of the tables used by the micro benchmarks. The tables are large enough to not fit into the caches.
+constexpr auto BENCHMARK_ROW_COUNT = size_t{1'000'000};
+
+// Number of distinct values in the tables used by the micro benchmarks.
+constexpr auto BENCHMARK_DISTINCT_COUNT = int64_t{10'000};
+
+// Returns the value of type T that represents the given number. Values of all types have the same order as the
+// numbers, so a search value for a given selectivity can be computed independently of the data type. Strings are
+// zero-padded for this purpose.
+template <typename T>
+T benchmark_value(const int64_t number) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto buffer = std::array<char, 32>{};
+    std::snprintf(buffer.data(), buffer.size(), "value_%010lld", static_cast<long long>(number));  // NOLINT
+    return std::string{buffer.data()};
+  } else {
+    return static_cast<T>(number);
+  }
+}
+
+// Returns the data type string (e.g., "int") of a type.
+template <typename T>
+std::string benchmark_data_type() {
+  auto name = std::string{};
+  hana::for_each(data_types, [&](auto pair) {
+    using PairType = typename std::decay_t<decltype(hana::second(pair))>::type;
+    if constexpr (std::is_same_v<PairType, T>) {
+      name = hana::first(pair);
+    }
+  });
+  return name;
+}
+
+// Creates a table with a single column of the given type and BENCHMARK_ROW_COUNT rows. The values are drawn uniformly
+// from [0, distinct_count) by a random number generator with a fixed seed, so that all runs see the same data. If
+// sorted is set, the values are sorted before they are inserted, which creates runs of equal values. If an encoding is
+// given, all chunks are compressed with it.
+std::shared_ptr<Table> create_benchmark_table(const std::string& data_type, const ChunkOffset chunk_size,
+                                              const int64_t distinct_count, const bool sorted,
+                                              const std::optional<EncodingType> encoding_type);
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/index/b_plus_tree_index.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The ways in which a TableScan can evaluate its predicate.
+enum class ScanPath : int64_t {
+  ValueSegment,
+  DictionarySegment,
+  RunLengthSegment,
+  FrameOfReferenceSegment,
+  ReferenceSegment,
+  ChunkIndex,
+  TableIndex
+};
+
+std::shared_ptr<TableWrapper> create_input(const std::string& data_type, const ScanPath scan_path,
+                                           const ChunkOffset chunk_size) {
+  auto encoding_type = std::optional<EncodingType>{};
+  switch (scan_path) {
+    case ScanPath::DictionarySegment:
+    case ScanPath::ChunkIndex:
+    case ScanPath::TableIndex:
+      // Indexes are only chosen for predicates that the segment statistics of the compressed chunks show to be
+      // selective.
+      encoding_type = EncodingType::Dictionary;
+      break;
+    case ScanPath::RunLengthSegment:
+      encoding_type = EncodingType::RunLength;
+      break;
+    case ScanPath::FrameOfReferenceSegment:
+      encoding_type = EncodingType::FrameOfReference;
+      break;
+    case ScanPath::ValueSegment:
+    case ScanPath::ReferenceSegment:
+      break;
+  }
+
+  // Run-length encoding is only useful for data with runs.
+  const auto sorted = scan_path == ScanPath::RunLengthSegment;
+  const auto table = create_benchmark_table(data_type, chunk_size, BENCHMARK_DISTINCT_COUNT, sorted, encoding_type);
+
+  if (scan_path == ScanPath::ChunkIndex) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->get_chunk(chunk_id)->create_index<GroupKeyIndex>({ColumnID{0}});
+    }
+  } else if (scan_path == ScanPath::TableIndex) {
+    resolve_data_type(data_type, [&](auto type) {
+      using DataType = typename decltype(type)::type;
+      table->add_index(std::make_shared<BPlusTreeIndex<DataType>>(*table, ColumnID{0}));
+    });
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+}  // namespace
+
+// Scans a single column with OpLessThan. The search value is chosen so that the given share of rows (in per mille)
+// qualifies. For ScanPath::ReferenceSegment, the scanned table is the output of a scan that selects all rows. Indexes
+// are only used by TableScan if the estimated selectivity is low enough.
+template <typename T>
+void BM_TableScan(benchmark::State& state) {
+  const auto scan_path = static_cast<ScanPath>(state.range(0));
+  const auto chunk_size = static_cast<ChunkOffset>(state.range(1));
+  const auto selectivity_per_mille = state.range(2);
+  const auto search_value = benchmark_value<T>(BENCHMARK_DISTINCT_COUNT * selectivity_per_mille / 1000);
+
+  const auto table_wrapper = create_input(benchmark_data_type<T>(), scan_path, chunk_size);
+  auto input = std::static_pointer_cast<AbstractOperator>(table_wrapper);
+  if (scan_path == ScanPath::ReferenceSegment) {
+    const auto minimum = benchmark_value<T>(0);
+    input = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, minimum);
+    input->execute();
+  }
+
+  if (scan_path == ScanPath::TableIndex) {
+    const auto table_scan = std::make_shared<TableScan>(input, ColumnID{0}, ScanType::OpLessThan, search_value);
+    table_scan->execute();
+    // Near INDEX_SELECTIVITY_THRESHOLD, the estimate decides whether the index is used.
+    if (selectivity_per_mille < 500 * TableScan::INDEX_SELECTIVITY_THRESHOLD) {
+      Assert(table_scan->used_table_index(), "Selective predicates have to be answered by the table index");
+    }
+  }
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(input, ColumnID{0}, ScanType::OpLessThan, search_value);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output()->row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BENCHMARK_ROW_COUNT));
+}
+
+template <typename T>
+void table_scan_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (auto scan_path = ScanPath::ValueSegment; scan_path <= ScanPath::TableIndex;
+       scan_path = static_cast<ScanPath>(static_cast<int64_t>(scan_path) + 1)) {
+    if (scan_path == ScanPath::FrameOfReferenceSegment && !std::is_integral_v<T>) continue;
+    // Statistics cannot estimate the selectivity of ranges of strings, so a range scan never picks the table index.
+    if (scan_path == ScanPath::TableIndex && !std::is_arithmetic_v<T>) continue;
+    for (const auto chunk_size : {10'000, 100'000}) {
+      for (const auto selectivity_per_mille : {1, 100, 500, 900}) {
+        benchmark->Args({static_cast<int64_t>(scan_path), chunk_size, selectivity_per_mille});
+      }
+    }
+  }
+  benchmark->ArgNames({"path", "chunk_size", "selectivity_per_mille"})->Unit(benchmark::kMicrosecond);
+}
+BENCHMARK_TEMPLATE(BM_TableScan, int32_t)->Apply(table_scan_arguments<int32_t>);
+BENCHMARK_TEMPLATE(BM_TableScan, int64_t)->Apply(table_scan_arguments<int64_t>);
+BENCHMARK_TEMPLATE(BM_TableScan, float)->Apply(table_scan_arguments<float>);
+BENCHMARK_TEMPLATE(BM_TableScan, double)->Apply(table_scan_arguments<double>);
+BENCHMARK_TEMPLATE(BM_TableScan, std::string)->Apply(table_scan_arguments<std::string>);
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_attribute_vector.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+void BM_DictionarySegmentConstruction(benchmark::State& state) {
+  const auto segment_size = state.range(0);
+  const auto distinct_count = state.range(1);
+
+  auto generator = std::mt19937_64{42};
+  auto distribution = std::uniform_int_distribution<int64_t>{0, distinct_count - 1};
+  const auto value_segment = std::make_shared<ValueSegment<T>>();
+  for (auto index = int64_t{0}; index < segment_size; ++index) {
+    value_segment->append(benchmark_value<T>(distribution(generator)));
+  }
+
+  for (auto _ : state) {
+    const auto dictionary_segment = DictionarySegment<T>{value_segment};
+    benchmark::DoNotOptimize(dictionary_segment.unique_values_count());
+  }
+  state.SetItemsProcessed(state.iterations() * segment_size);
+}
+
+void dictionary_construction_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto segment_size : {10'000, 100'000}) {
+    for (const auto distinct_count : {10, 1'000, 100'000}) {
+      benchmark->Args({segment_size, distinct_count});
+    }
+  }
+  benchmark->ArgNames({"size", "distinct"});
+}
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, int32_t)->Apply(dictionary_construction_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, int64_t)->Apply(dictionary_construction_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, float)->Apply(dictionary_construction_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, double)->Apply(dictionary_construction_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, std::string)->Apply(dictionary_construction_arguments);
+
+// Accesses the attribute vector through the virtual interface in a pseudo-random order, like a lookup of scattered
+// positions does.
+template <typename T>
+void BM_FixedWidthAttributeVectorGet(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  auto attribute_vector = FixedWidthAttributeVector<T>{size};
+  for (auto index = size_t{0}; index < size; ++index) {
+    attribute_vector.set(index, ValueID{static_cast<ValueID::base_type>(index % std::numeric_limits<T>::max())});
+  }
+  const AbstractAttributeVector& abstract_attribute_vector = attribute_vector;
+
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (auto index = size_t{0}; index < size; ++index) {
+      sum += abstract_attribute_vector.get((index * 7919) % size);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK_TEMPLATE(BM_FixedWidthAttributeVectorGet, uint8_t)->Arg(100'000);
+BENCHMARK_TEMPLATE(BM_FixedWidthAttributeVectorGet, uint16_t)->Arg(100'000);
+BENCHMARK_TEMPLATE(BM_FixedWidthAttributeVectorGet, uint32_t)->Arg(100'000);
+
+template <typename T>
+void BM_FixedWidthAttributeVectorSet(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  auto attribute_vector = FixedWidthAttributeVector<T>{size};
+  AbstractAttributeVector& abstract_attribute_vector = attribute_vector;
+
+  for (auto _ : state) {
+    for (auto index = size_t{0}; index < size; ++index) {
+      const auto value_id = static_cast<ValueID::base_type>(index % std::numeric_limits<T>::max());
+      abstract_attribute_vector.set(index, ValueID{value_id});
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK_TEMPLATE(BM_FixedWidthAttributeVectorSet, uint8_t)->Arg(100'000);
+BENCHMARK_TEMPLATE(BM_FixedWidthAttributeVectorSet, uint16_t)->Arg(100'000);
+BENCHMARK_TEMPLATE(BM_FixedWidthAttributeVectorSet, uint32_t)->Arg(100'000);
+
+}  // namespace opossum
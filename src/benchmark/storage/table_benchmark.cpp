@@ -0,0 +1,73 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+template <typename T>
+void BM_TableAppend(benchmark::State& state) {
+  const auto chunk_size = static_cast<ChunkOffset>(state.range(0));
+  const auto row_count = static_cast<int64_t>(state.range(1));
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(row_count);
+  for (auto number = int64_t{0}; number < row_count; ++number) {
+    values.emplace_back(benchmark_value<T>(number % BENCHMARK_DISTINCT_COUNT));
+  }
+
+  for (auto _ : state) {
+    auto table = Table{chunk_size};
+    table.add_column("a", benchmark_data_type<T>());
+    for (const auto& value : values) {
+      table.append({value});
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+BENCHMARK_TEMPLATE(BM_TableAppend, int32_t)->Args({10'000, 100'000})->Args({100'000, 100'000});
+BENCHMARK_TEMPLATE(BM_TableAppend, int64_t)->Args({10'000, 100'000})->Args({100'000, 100'000});
+BENCHMARK_TEMPLATE(BM_TableAppend, float)->Args({10'000, 100'000})->Args({100'000, 100'000});
+BENCHMARK_TEMPLATE(BM_TableAppend, double)->Args({10'000, 100'000})->Args({100'000, 100'000});
+BENCHMARK_TEMPLATE(BM_TableAppend, std::string)->Args({10'000, 100'000})->Args({100'000, 100'000});
+
+// Compresses all chunks of a fresh table with the encoding given as first argument. Creating the table is not timed.
+template <typename T>
+void BM_TableCompressChunk(benchmark::State& state) {
+  const auto encoding_type = static_cast<EncodingType>(state.range(0));
+  const auto chunk_size = static_cast<ChunkOffset>(state.range(1));
+  const auto sorted = encoding_type == EncodingType::RunLength;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    const auto table = create_benchmark_table(benchmark_data_type<T>(), chunk_size, BENCHMARK_DISTINCT_COUNT, sorted,
+                                              std::nullopt);
+    state.ResumeTiming();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->compress_chunk(chunk_id, encoding_type);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BENCHMARK_ROW_COUNT));
+}
+
+template <typename T>
+void compress_chunk_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference,
+                                   EncodingType::Automatic}) {
+    if (encoding_type == EncodingType::FrameOfReference && !std::is_integral_v<T>) continue;
+    for (const auto chunk_size : {10'000, 100'000}) {
+      benchmark->Args({static_cast<int64_t>(encoding_type), chunk_size});
+    }
+  }
+  benchmark->ArgNames({"encoding", "chunk_size"})->Unit(benchmark::kMillisecond);
+}
+BENCHMARK_TEMPLATE(BM_TableCompressChunk, int32_t)->Apply(compress_chunk_arguments<int32_t>);
+BENCHMARK_TEMPLATE(BM_TableCompressChunk, int64_t)->Apply(compress_chunk_arguments<int64_t>);
+BENCHMARK_TEMPLATE(BM_TableCompressChunk, float)->Apply(compress_chunk_arguments<float>);
+BENCHMARK_TEMPLATE(BM_TableCompressChunk, double)->Apply(compress_chunk_arguments<double>);
+BENCHMARK_TEMPLATE(BM_TableCompressChunk, std::string)->Apply(compress_chunk_arguments<std::string>);
+
+}  // namespace opossum
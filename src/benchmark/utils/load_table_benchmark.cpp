@@ -0,0 +1,38 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+// Writes a .tbl file with an int, a float, and a string column to a temporary file and loads it repeatedly.
+void BM_LoadTable(benchmark::State& state) {
+  const auto row_count = state.range(0);
+  const auto file_name =
+      (std::filesystem::temp_directory_path() / ("hyrise_load_table_benchmark_" + std::to_string(row_count) + ".tbl"))
+          .string();
+  {
+    auto file = std::ofstream{file_name};
+    file << "a|b|c\nint|float|string\n";
+    for (auto number = int64_t{0}; number < row_count; ++number) {
+      const auto value = number % BENCHMARK_DISTINCT_COUNT;
+      file << value << '|' << static_cast<float>(value) / 4.0f << '|' << benchmark_value<std::string>(value) << '\n';
+    }
+  }
+
+  for (auto _ : state) {
+    const auto table = load_table(file_name, ChunkOffset{10'000});
+    benchmark::DoNotOptimize(table->row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+  std::remove(file_name.c_str());
+}
+BENCHMARK(BM_LoadTable)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
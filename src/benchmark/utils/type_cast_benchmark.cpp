@@ -0,0 +1,43 @@
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "all_type_variant.hpp"
+#include "micro_benchmark_utils.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+// Converts BENCHMARK_DISTINCT_COUNT values of type Source, held in AllTypeVariants, to Target.
+template <typename Source, typename Target>
+void BM_TypeCast(benchmark::State& state) {
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(BENCHMARK_DISTINCT_COUNT);
+  for (auto number = int64_t{0}; number < BENCHMARK_DISTINCT_COUNT; ++number) {
+    if constexpr (std::is_same_v<Source, std::string>) {
+      // Strings without padding, so that they can be parsed as numbers.
+      values.emplace_back(std::to_string(number));
+    } else {
+      values.emplace_back(static_cast<Source>(number));
+    }
+  }
+
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(type_cast<Target>(value));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_DISTINCT_COUNT);
+}
+BENCHMARK_TEMPLATE(BM_TypeCast, int32_t, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeCast, int32_t, int64_t);
+BENCHMARK_TEMPLATE(BM_TypeCast, int64_t, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeCast, int32_t, float);
+BENCHMARK_TEMPLATE(BM_TypeCast, double, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeCast, std::string, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeCast, std::string, double);
+BENCHMARK_TEMPLATE(BM_TypeCast, int32_t, std::string);
+BENCHMARK_TEMPLATE(BM_TypeCast, double, std::string);
+
+}  // namespace opossum
@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "memory/query_arena.hpp"
+#include "memory/query_memory_tracker.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_queries.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT
+
+// Generates the TPC-H tables, executes the plans of tpch_queries() repeatedly, and reports the latency distribution of
+// each query on stdout and, optionally, as a JSON file. Usage:
+//
+//   hyriseTpchRunner [--scale 0.1] [--runs 10] [--queries Q1,Q6] [--encoding Dictionary] [--cores 0]
+//                    [--chunk-size 100000] [--memory-limit 1000000000] [--output result.json]
+//
+// --cores 0 executes the queries without a scheduler, i.e., in the main thread. --memory-limit aborts queries whose
+// operators report more memory than the given number of bytes (see QueryMemoryTracker).
+
+namespace {
+
+struct RunnerConfig {
+  float scale_factor = 0.1f;
+  size_t runs = 10;
+  std::vector<std::string> query_names;
+  std::optional<EncodingType> encoding_type;
+  uint32_t cores = 0;
+  ChunkOffset chunk_size = TpchTableGenerator::DEFAULT_CHUNK_SIZE;
+  size_t memory_limit = QueryMemoryTracker::UNLIMITED;
+  std::string output_path;
+};
+
+struct QueryResult {
+  std::string name;
+  ChunkOffset output_row_count = 0;
+  // Maximum over all runs of the memory the query's operators reported (see QueryMemoryTracker).
+  size_t peak_memory_usage = 0;
+  // Latencies of all runs in milliseconds, sorted ascending.
+  std::vector<double> latencies;
+};
+
+EncodingType parse_encoding_type(const std::string& name) {
+  static const auto encoding_types = std::map<std::string, EncodingType>{
+      {"Unencoded", EncodingType::Unencoded},   {"Dictionary", EncodingType::Dictionary},
+      {"RunLength", EncodingType::RunLength},   {"FrameOfReference", EncodingType::FrameOfReference},
+      {"Automatic", EncodingType::Automatic}};
+  const auto iter = encoding_types.find(name);
+  Assert(iter != encoding_types.end(), "Unknown encoding " + name);
+  return iter->second;
+}
+
+RunnerConfig parse_arguments(const int argc, char* argv[]) {
+  auto config = RunnerConfig{};
+  for (auto argument_index = 1; argument_index < argc; argument_index += 2) {
+    const auto argument = std::string{argv[argument_index]};
+    Assert(argument_index + 1 < argc, "Missing value for " + argument);
+    const auto value = std::string{argv[argument_index + 1]};
+
+    if (argument == "--scale") {
+      config.scale_factor = std::stof(value);
+    } else if (argument == "--runs") {
+      config.runs = std::stoul(value);
+    } else if (argument == "--queries") {
+      auto stream = std::stringstream{value};
+      for (auto name = std::string{}; std::getline(stream, name, ',');) {
+        config.query_names.emplace_back(name);
+      }
+    } else if (argument == "--encoding") {
+      config.encoding_type = parse_encoding_type(value);
+    } else if (argument == "--cores") {
+      config.cores = static_cast<uint32_t>(std::stoul(value));
+    } else if (argument == "--chunk-size") {
+      config.chunk_size = static_cast<ChunkOffset>(std::stoul(value));
+    } else if (argument == "--memory-limit") {
+      config.memory_limit = std::stoul(value);
+    } else if (argument == "--output") {
+      config.output_path = value;
+    } else {
+      Fail("Unknown argument " + argument);
+    }
+  }
+  Assert(config.runs > 0, "At least one run is required");
+  return config;
+}
+
+// Nearest-rank percentile of the sorted latencies.
+double percentile(const std::vector<double>& sorted_latencies, const double percent) {
+  const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(sorted_latencies.size())));
+  return sorted_latencies[std::max(rank, size_t{1}) - 1];
+}
+
+double mean(const std::vector<double>& latencies) {
+  return std::accumulate(latencies.begin(), latencies.end(), 0.0) / static_cast<double>(latencies.size());
+}
+
+QueryResult run_query(const TpchQuery& query, const RunnerConfig& config) {
+  auto result = QueryResult{query.name, 0, 0, {}};
+  for (auto run = size_t{0}; run < config.runs; ++run) {
+    // Each run allocates its intermediates from its own arena, which is released with the plan and its tasks. Runs
+    // that exceed the memory limit fail.
+    const auto memory_resource_scope = ScopedMemoryResource{std::make_shared<QueryArena>()};
+    const auto memory_tracker = std::make_shared<QueryMemoryTracker>(config.memory_limit);
+    const auto memory_tracker_scope = ScopedQueryMemoryTracker{memory_tracker};
+
+    // Plans are created outside of the measurement, as they are cheap and not part of the execution.
+    const auto plan = query.create_plan();
+    const auto tasks = OperatorTask::make_tasks_from_operator(plan);
+
+    const auto begin = std::chrono::steady_clock::now();
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    const auto end = std::chrono::steady_clock::now();
+
+    result.latencies.emplace_back(std::chrono::duration<double, std::milli>(end - begin).count());
+    result.output_row_count = plan->get_output()->row_count();
+    result.peak_memory_usage = std::max(result.peak_memory_usage, memory_tracker->peak());
+  }
+  std::sort(result.latencies.begin(), result.latencies.end());
+  return result;
+}
+
+void write_json(const RunnerConfig& config, const double generation_seconds, const std::vector<QueryResult>& results) {
+  auto file = std::ofstream{config.output_path};
+  Assert(file.is_open(), "Cannot open " + config.output_path);
+
+  file << std::fixed << std::setprecision(4) << "{\n";
+  file << "  \"scale_factor\": " << config.scale_factor << ",\n";
+  file << "  \"runs\": " << config.runs << ",\n";
+  file << "  \"cores\": " << config.cores << ",\n";
+  file << "  \"chunk_size\": " << config.chunk_size << ",\n";
+  file << "  \"encoding\": \"";
+  if (config.encoding_type) {
+    file << *config.encoding_type;
+  } else {
+    file << EncodingType::Unencoded;
+  }
+  file << "\",\n";
+  file << "  \"generation_seconds\": " << generation_seconds << ",\n";
+  file << "  \"queries\": [";
+  for (auto result_index = size_t{0}; result_index < results.size(); ++result_index) {
+    const auto& result = results[result_index];
+    file << (result_index == 0 ? "\n" : ",\n");
+    file << "    {\n";
+    file << "      \"name\": \"" << result.name << "\",\n";
+    file << "      \"output_rows\": " << result.output_row_count << ",\n";
+    file << "      \"peak_memory_bytes\": " << result.peak_memory_usage << ",\n";
+    file << "      \"latency_ms\": {\"min\": " << result.latencies.front() << ", \"max\": " << result.latencies.back()
+         << ", \"mean\": " << mean(result.latencies) << ", \"p50\": " << percentile(result.latencies, 50)
+         << ", \"p90\": " << percentile(result.latencies, 90) << ", \"p99\": " << percentile(result.latencies, 99)
+         << "},\n";
+    file << "      \"runs_ms\": [";
+    for (auto run = size_t{0}; run < result.latencies.size(); ++run) {
+      file << (run == 0 ? "" : ", ") << result.latencies[run];
+    }
+    file << "]\n";
+    file << "    }";
+  }
+  file << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto config = parse_arguments(argc, argv);
+
+  auto queries = std::vector<TpchQuery>{};
+  for (const auto& query : tpch_queries()) {
+    if (config.query_names.empty() ||
+        std::find(config.query_names.begin(), config.query_names.end(), query.name) != config.query_names.end()) {
+      queries.emplace_back(query);
+    }
+  }
+  Assert(!queries.empty(), "None of the given queries is supported");
+
+  std::cout << "Generating TPC-H tables with scale factor " << config.scale_factor << std::endl;
+  const auto generation_begin = std::chrono::steady_clock::now();
+  TpchTableGenerator{config.scale_factor, config.chunk_size}.generate_and_store(config.encoding_type);
+  const auto generation_seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - generation_begin).count();
+  std::cout << "Generated tables in " << generation_seconds << " s" << std::endl;
+
+  if (config.cores > 0) {
+    CurrentScheduler::set(std::make_shared<Scheduler>(config.cores));
+  }
+
+  auto results = std::vector<QueryResult>{};
+  for (const auto& query : queries) {
+    try {
+      results.emplace_back(run_query(query, config));
+    } catch (const std::exception& exception) {
+      // E.g., the query exceeded the memory limit.
+      std::cerr << query.name << " failed: " << exception.what() << std::endl;
+      CurrentScheduler::set(nullptr);
+      return 1;
+    }
+    const auto& result = results.back();
+    std::cout << std::fixed << std::setprecision(3) << std::setw(4) << result.name << ": " << std::setw(9)
+              << result.output_row_count << " rows, mean " << mean(result.latencies) << " ms, p50 "
+              << percentile(result.latencies, 50) << " ms, p90 " << percentile(result.latencies, 90) << " ms, p99 "
+              << percentile(result.latencies, 99) << " ms, peak memory " << result.peak_memory_usage << " bytes"
+              << std::endl;
+  }
+
+  CurrentScheduler::set(nullptr);
+
+  if (!config.output_path.empty()) {
+    write_json(config, generation_seconds, results);
+    std::cout << "Wrote results to " << config.output_path << std::endl;
+  }
+  return 0;
+}
@@ -1,16 +1,22 @@
 #pragma once
 
 #include <cstdint>
+#include <ostream>
 #include <string>
 #include <vector>
 
 #include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not_equal.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/size.hpp>
+#include <boost/hana/take_while.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/zip.hpp>
+#include <boost/mpl/push_back.hpp>
 #include <boost/mpl/push_front.hpp>
 #include <boost/variant.hpp>
 
@@ -24,6 +30,17 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
+// Represents NULL in an AllTypeVariant. NULL is not one of the data types, but every column can be nullable (see
+// Table::add_column). Predicates never match NULL. The comparison operators below treat all NULLs as equal, so that
+// variants holding NULL can be compared and sorted, e.g., in tests.
+struct NullValue {};
+
+inline bool operator==(const NullValue&, const NullValue&) { return true; }
+inline bool operator!=(const NullValue&, const NullValue&) { return false; }
+inline bool operator<(const NullValue&, const NullValue&) { return false; }
+
+inline std::ostream& operator<<(std::ostream& stream, const NullValue&) { return stream << "NULL"; }
+
 namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
@@ -60,8 +77,17 @@ static constexpr auto data_types = hana::transform(data_types_as_tuples, to_pair
 // Converts tuple to mpl vector
 using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
 
-// Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+// Creates boost::variant from mpl vector. NullValue comes last, so that the index of each data type in the variant
+// (i.e., AllTypeVariant::which()) equals its index in types.
+using AllTypeVariant =
+    typename boost::make_variant_over<boost::mpl::push_back<TypesAsMplVector, NullValue>::type>::type;
+
+// Returns the index of type T in an Iterable
+template <typename Sequence, typename T>
+constexpr auto index_of(Sequence const& sequence, T const& element) {
+  constexpr auto size = decltype(hana::size(hana::take_while(sequence, hana::not_equal.to(element)))){};
+  return static_cast<size_t>(decltype(size)::value);
+}
 
 }  // namespace detail
 
@@ -70,6 +96,15 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// Index of NullValue in AllTypeVariant
+static constexpr auto NULL_TYPE_INDEX = static_cast<size_t>(decltype(hana::size(types))::value);
+
+static const auto NULL_VALUE = AllTypeVariant{NullValue{}};
+
+inline bool variant_is_null(const AllTypeVariant& value) {
+  return static_cast<size_t>(value.which()) == NULL_TYPE_INDEX;
+}
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
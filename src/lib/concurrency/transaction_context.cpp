@@ -0,0 +1,95 @@
+#include "transaction_context.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+    : _transaction_id(transaction_id), _snapshot_commit_id(snapshot_commit_id) {}
+
+TransactionContext::~TransactionContext() {
+  if (_phase == TransactionPhase::Active || _phase == TransactionPhase::Conflicted) rollback();
+}
+
+TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
+
+CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
+
+TransactionPhase TransactionContext::phase() const { return _phase; }
+
+CommitID TransactionContext::commit_id() const {
+  Assert(_phase == TransactionPhase::Committed, "Transaction is not committed");
+  return _commit_id;
+}
+
+void TransactionContext::register_insert(const std::shared_ptr<Table>& table, const RowID row_id) {
+  Assert(_phase == TransactionPhase::Active, "Transaction is not active");
+  const auto lock = std::lock_guard{_changes_mutex};
+  _inserts.emplace_back(table, row_id);
+}
+
+void TransactionContext::register_delete(const std::shared_ptr<const Table>& table, const RowID row_id) {
+  Assert(_phase == TransactionPhase::Active, "Transaction is not active");
+  const auto lock = std::lock_guard{_changes_mutex};
+  _deletes.emplace_back(table, row_id);
+}
+
+void TransactionContext::mark_as_conflicted() {
+  Assert(_phase == TransactionPhase::Active || _phase == TransactionPhase::Conflicted, "Transaction is not active");
+  _phase = TransactionPhase::Conflicted;
+}
+
+void TransactionContext::commit() {
+  Assert(_phase == TransactionPhase::Active, "Transaction is not active");
+  auto& transaction_manager = TransactionManager::get();
+  transaction_manager._commit([&](const CommitID commit_id) {
+    _commit_id = commit_id;
+    for (const auto& [table, row_id] : _inserts) {
+      const auto& mvcc_data = table->get_chunk(row_id.chunk_id)->mvcc_data();
+      mvcc_data->set_begin_cid(row_id.chunk_offset, commit_id);
+      mvcc_data->set_tid(row_id.chunk_offset, INVALID_TRANSACTION_ID);
+    }
+    // Deleted rows stay locked, so no other transaction can delete them again.
+    for (const auto& [table, row_id] : _deletes) {
+      table->get_chunk(row_id.chunk_id)->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
+    }
+  });
+  _phase = TransactionPhase::Committed;
+  transaction_manager._deregister_transaction(_snapshot_commit_id);
+
+  // Rows that the transaction inserted and deleted again have an end commit id of 0 (see Delete).
+  for (const auto& [table, row_id] : _inserts) {
+    const auto chunk = table->get_chunk(row_id.chunk_id);
+    if (chunk->mvcc_data()->end_cid(row_id.chunk_offset) == 0) chunk->increase_invalid_row_count(1);
+  }
+  for (const auto& [table, row_id] : _deletes) {
+    table->get_chunk(row_id.chunk_id)->increase_invalid_row_count(1);
+  }
+}
+
+void TransactionContext::rollback() {
+  Assert(_phase == TransactionPhase::Active || _phase == TransactionPhase::Conflicted, "Transaction is not active");
+  for (const auto& [table, row_id] : _inserts) {
+    // An end commit id of 0 hides the row from all transactions, even though it was never visible.
+    const auto chunk = table->get_chunk(row_id.chunk_id);
+    const auto& mvcc_data = chunk->mvcc_data();
+    mvcc_data->set_end_cid(row_id.chunk_offset, CommitID{0});
+    mvcc_data->set_tid(row_id.chunk_offset, INVALID_TRANSACTION_ID);
+    chunk->increase_invalid_row_count(1);
+  }
+  for (const auto& [table, row_id] : _deletes) {
+    table->get_chunk(row_id.chunk_id)->mvcc_data()->set_tid(row_id.chunk_offset, INVALID_TRANSACTION_ID);
+  }
+  _phase = TransactionPhase::RolledBack;
+  TransactionManager::get()._deregister_transaction(_snapshot_commit_id);
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// A transaction is Conflicted if it tried to delete a row that another transaction deleted or is deleting. It cannot
+// commit and has to be rolled back.
+enum class TransactionPhase { Active, Conflicted, Committed, RolledBack };
+
+// A TransactionContext represents a running transaction, see TransactionManager::new_transaction_context. Operators
+// that read or modify MVCC tables need it (see AbstractOperator::set_transaction_context). The transaction reads the
+// snapshot of its snapshot commit id and its own changes, which become visible to others once it commits.
+class TransactionContext : private Noncopyable {
+ public:
+  // Use TransactionManager::new_transaction_context to start transactions.
+  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id);
+
+  // Rolls the transaction back unless it was committed or rolled back before.
+  ~TransactionContext();
+
+  TransactionID transaction_id() const;
+
+  // Returns the id of the last commit the transaction sees.
+  CommitID snapshot_commit_id() const;
+
+  TransactionPhase phase() const;
+
+  // Returns the commit id that the transaction committed with. Only valid for committed transactions.
+  CommitID commit_id() const;
+
+  // Records that the transaction appended the row to the table. Operators call this for every row they insert, so that
+  // commit and rollback can update the row's MVCC data.
+  void register_insert(const std::shared_ptr<Table>& table, const RowID row_id);
+
+  // Records that the transaction locked the row of the table for deletion (see MvccData::compare_exchange_tid).
+  void register_delete(const std::shared_ptr<const Table>& table, const RowID row_id);
+
+  // Called by operators that ran into a write conflict. The transaction has to be rolled back afterwards.
+  void mark_as_conflicted();
+
+  // Makes the changes of the transaction visible to transactions that start afterwards.
+  void commit();
+
+  // Discards the changes of the transaction. Inserted rows stay in their tables but are never visible, and deleted
+  // rows are unlocked.
+  void rollback();
+
+ protected:
+  const TransactionID _transaction_id;
+  const CommitID _snapshot_commit_id;
+  TransactionPhase _phase{TransactionPhase::Active};
+  CommitID _commit_id{MAX_COMMIT_ID};
+
+  // Operators of the transaction may run concurrently, so changes are registered under a mutex.
+  std::mutex _changes_mutex;
+  std::vector<std::pair<std::shared_ptr<Table>, RowID>> _inserts;
+  std::vector<std::pair<std::shared_ptr<const Table>, RowID>> _deletes;
+};
+
+}  // namespace opossum
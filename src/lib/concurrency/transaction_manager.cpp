@@ -0,0 +1,47 @@
+#include "transaction_manager.hpp"
+
+#include <memory>
+#include <mutex>
+
+#include "transaction_context.hpp"
+
+namespace opossum {
+
+TransactionManager& TransactionManager::get() {
+  static TransactionManager instance;
+  return instance;
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
+  // Taking the snapshot under the lock ensures that lowest_active_snapshot_commit_id never misses a transaction that
+  // is about to start with a lower snapshot.
+  const auto lock = std::lock_guard{_active_transactions_mutex};
+  const auto snapshot_commit_id = _last_commit_id.load();
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+  return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id);
+}
+
+CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
+
+CommitID TransactionManager::lowest_active_snapshot_commit_id() const {
+  const auto lock = std::lock_guard{_active_transactions_mutex};
+  if (_active_snapshot_commit_ids.empty()) return MAX_COMMIT_ID;
+  return *_active_snapshot_commit_ids.cbegin();
+}
+
+void TransactionManager::reset() {
+  const auto commit_lock = std::lock_guard{_commit_mutex};
+  const auto active_transactions_lock = std::lock_guard{_active_transactions_mutex};
+  _next_transaction_id = 1;
+  _last_commit_id = 0;
+  _active_snapshot_commit_ids.clear();
+}
+
+void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
+  const auto lock = std::lock_guard{_active_transactions_mutex};
+  // Transactions that were started before a reset are not registered anymore.
+  const auto iter = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (iter != _active_snapshot_commit_ids.end()) _active_snapshot_commit_ids.erase(iter);
+}
+
+}  // namespace opossum
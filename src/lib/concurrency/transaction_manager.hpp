@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+// The TransactionManager is a singleton that hands out transaction ids and commit ids. Commit ids are assigned in the
+// order in which transactions commit. A transaction sees the rows of all transactions that committed before it started,
+// i.e., whose commit id is at most the last commit id at that time (its snapshot commit id).
+class TransactionManager : private Noncopyable {
+ public:
+  static TransactionManager& get();
+
+  // Starts a new transaction.
+  std::shared_ptr<TransactionContext> new_transaction_context();
+
+  // Returns the commit id of the transaction that committed last. Rows that were appended without a transaction have
+  // commit id 0, which is visible to all transactions.
+  CommitID last_commit_id() const;
+
+  // Returns the lowest snapshot commit id of all active transactions, or MAX_COMMIT_ID if there are none. Rows that
+  // were invalidated before this commit id are not visible to any current or future transaction.
+  CommitID lowest_active_snapshot_commit_id() const;
+
+  // Resets the transaction and commit ids, used especially in tests.
+  void reset();
+
+  TransactionManager(TransactionManager&&) = delete;
+
+ protected:
+  // The transaction context commits through the manager, so that commit ids are assigned and published in order, and
+  // deregisters once it is committed or rolled back.
+  friend class TransactionContext;
+
+  TransactionManager() = default;
+
+  // Assigns the next commit id, calls the functor with it to make the transaction's changes visible, and publishes the
+  // commit id afterwards. Thus, transactions that start later see either all or none of the changes.
+  template <typename Functor>
+  void _commit(const Functor& functor) {
+    const auto lock = std::lock_guard{_commit_mutex};
+    const auto commit_id = _last_commit_id.load() + 1;
+    functor(commit_id);
+    _last_commit_id = commit_id;
+  }
+
+  void _deregister_transaction(const CommitID snapshot_commit_id);
+
+  std::atomic<TransactionID> _next_transaction_id{1};
+  std::atomic<CommitID> _last_commit_id{0};
+  std::mutex _commit_mutex;
+
+  // Snapshot commit ids of the transactions that are neither committed nor rolled back.
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_transactions_mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#include "query_arena.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace opossum {
+
+namespace {
+
+thread_local std::shared_ptr<std::pmr::memory_resource> current_resource;
+
+std::atomic<uint64_t> next_arena_id{0};
+
+}  // namespace
+
+struct QueryArena::ThreadBuffer {
+  explicit ThreadBuffer(const size_t initial_size) : resource(initial_size) {}
+
+  std::pmr::monotonic_buffer_resource resource;
+  // Only written by the owning thread, but read by allocated_bytes() from any thread.
+  std::atomic<size_t> allocated_bytes{0};
+};
+
+thread_local uint64_t QueryArena::_cached_arena_id = std::numeric_limits<uint64_t>::max();
+thread_local QueryArena::ThreadBuffer* QueryArena::_cached_thread_buffer = nullptr;
+
+QueryArena::QueryArena(const size_t initial_size) : _initial_size(initial_size), _id(next_arena_id++) {}
+
+QueryArena::~QueryArena() = default;
+
+size_t QueryArena::allocated_bytes() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  auto allocated_bytes = size_t{0};
+  for (const auto& [thread_id, thread_buffer] : _thread_buffers) {
+    allocated_bytes += thread_buffer->allocated_bytes.load(std::memory_order_relaxed);
+  }
+  return allocated_bytes;
+}
+
+QueryArena::ThreadBuffer& QueryArena::_thread_buffer() {
+  if (_cached_arena_id == _id) return *_cached_thread_buffer;
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  auto& thread_buffer = _thread_buffers[std::this_thread::get_id()];
+  if (!thread_buffer) thread_buffer = std::make_unique<ThreadBuffer>(_initial_size);
+  _cached_arena_id = _id;
+  _cached_thread_buffer = thread_buffer.get();
+  return *thread_buffer;
+}
+
+void* QueryArena::do_allocate(const size_t bytes, const size_t alignment) {
+  auto& thread_buffer = _thread_buffer();
+  thread_buffer.allocated_bytes.store(thread_buffer.allocated_bytes.load(std::memory_order_relaxed) + bytes,
+                                      std::memory_order_relaxed);
+  return thread_buffer.resource.allocate(bytes, alignment);
+}
+
+void QueryArena::do_deallocate(void* /*pointer*/, const size_t /*bytes*/, const size_t /*alignment*/) {
+  // Memory is only released when the arena is destroyed.
+}
+
+bool QueryArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+
+std::shared_ptr<std::pmr::memory_resource> current_memory_resource() {
+  if (current_resource) return current_resource;
+  // The default resource lives as long as the program, so the pointer does not own it.
+  return std::shared_ptr<std::pmr::memory_resource>{std::shared_ptr<void>{}, std::pmr::get_default_resource()};
+}
+
+ScopedMemoryResource::ScopedMemoryResource(const std::shared_ptr<std::pmr::memory_resource>& resource)
+    : _previous_resource(std::move(current_resource)) {
+  current_resource = resource;
+}
+
+ScopedMemoryResource::~ScopedMemoryResource() { current_resource = std::move(_previous_resource); }
+
+}  // namespace opossum
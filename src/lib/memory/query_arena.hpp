@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// QueryArena is a monotonic memory resource that the intermediate results of a single query, i.e., the output tables,
+// chunks, ReferenceSegments, and PosLists of its operators, are allocated from. Deallocation is a no-op, all memory is
+// released at once when the arena is destroyed. This avoids a global allocator call for every intermediate and the
+// contention that comes with it when many queries run concurrently.
+//
+// The jobs of a query may run on different workers. To not serialize their allocations, every thread that allocates
+// from the arena gets its own monotonic buffer. Each thread remembers the buffer of the arena it used last, so a lock
+// is only taken when a thread switches between arenas, e.g., on its first allocation for a query. See
+// BM_ConcurrentAllocation for a comparison with the global allocator.
+//
+// An arena is installed for the calling thread via ScopedMemoryResource. Tasks created while it is installed take it
+// with them (see AbstractTask), so all operators and jobs of a query allocate from it:
+//
+//   const auto arena = std::make_shared<QueryArena>();
+//   const auto scope = ScopedMemoryResource{arena};
+//   const auto plan = ...;
+//   CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(plan));
+//
+// Tasks share the ownership of their resource, as workers may release a task (and with it the operator and its
+// output) only after the query is done. Everything else allocated from the arena, e.g., result tables that are kept,
+// must not outlive the last owner of the arena. As memory is never reused, streaming Pipelines over large inputs
+// should not run inside an arena.
+class QueryArena : public std::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_INITIAL_SIZE = size_t{64 * 1024};
+
+  // The initial size applies to the buffer of each thread.
+  explicit QueryArena(const size_t initial_size = DEFAULT_INITIAL_SIZE);
+  ~QueryArena() override;
+
+  // Returns the number of bytes that were requested from the arena so far.
+  size_t allocated_bytes() const;
+
+ protected:
+  void* do_allocate(const size_t bytes, const size_t alignment) override;
+  void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  struct ThreadBuffer;
+
+  // Returns the buffer of the calling thread and creates it on the thread's first allocation.
+  ThreadBuffer& _thread_buffer();
+
+  const size_t _initial_size;
+  // Identifies the arena in the per-thread cache. Unlike its address, it is not reused by later arenas.
+  const uint64_t _id;
+
+  mutable std::mutex _mutex;
+  std::unordered_map<std::thread::id, std::unique_ptr<ThreadBuffer>> _thread_buffers;
+
+  // The arena that the calling thread allocated from last and its buffer of that arena. The buffer is only used if the
+  // ids match, so the cache never refers to the buffer of a destroyed arena.
+  static thread_local uint64_t _cached_arena_id;
+  static thread_local ThreadBuffer* _cached_thread_buffer;
+};
+
+// Returns the memory resource that intermediates are allocated from in the calling thread. Without a
+// ScopedMemoryResource, this is a non-owning pointer to std::pmr::get_default_resource(), i.e., the global allocator.
+std::shared_ptr<std::pmr::memory_resource> current_memory_resource();
+
+// Installs a memory resource for the calling thread for the lifetime of the object and restores the previous one
+// afterwards. Scopes can be nested.
+class ScopedMemoryResource : private Noncopyable {
+ public:
+  explicit ScopedMemoryResource(const std::shared_ptr<std::pmr::memory_resource>& resource);
+  ~ScopedMemoryResource();
+
+ protected:
+  std::shared_ptr<std::pmr::memory_resource> _previous_resource;
+};
+
+// Creates an object that, including the control block of the shared_ptr, lives in the current memory resource.
+// Allocator-aware members, such as the std::pmr::vector of a PosList, allocate from the same resource.
+template <typename T, typename... Args>
+std::shared_ptr<T> make_shared_intermediate(Args&&... args) {
+  return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>{current_memory_resource().get()},
+                                 std::forward<Args>(args)...);
+}
+
+}  // namespace opossum
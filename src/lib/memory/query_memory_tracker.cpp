@@ -0,0 +1,59 @@
+#include "query_memory_tracker.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+thread_local std::shared_ptr<QueryMemoryTracker> current_tracker;
+
+}  // namespace
+
+QueryMemoryTracker::QueryMemoryTracker(const size_t limit) : _limit(limit) {}
+
+size_t QueryMemoryTracker::limit() const { return _limit; }
+
+size_t QueryMemoryTracker::used() const { return _used; }
+
+size_t QueryMemoryTracker::peak() const { return _peak; }
+
+void QueryMemoryTracker::reserve(const size_t bytes) {
+  if (!try_reserve(bytes)) {
+    Fail("Query exceeded its memory limit of " + std::to_string(_limit) + " bytes (" + std::to_string(_used) +
+         " bytes used, " + std::to_string(bytes) + " bytes requested)");
+  }
+}
+
+bool QueryMemoryTracker::try_reserve(const size_t bytes) {
+  auto used = _used.load();
+  do {
+    if (bytes > _limit - used) return false;
+  } while (!_used.compare_exchange_weak(used, used + bytes));
+
+  const auto new_used = used + bytes;
+  auto peak = _peak.load();
+  while (peak < new_used && !_peak.compare_exchange_weak(peak, new_used)) {
+  }
+  return true;
+}
+
+void QueryMemoryTracker::release(const size_t bytes) {
+  [[maybe_unused]] const auto used = _used.fetch_sub(bytes);
+  DebugAssert(used >= bytes, "Released more memory than was reserved");
+}
+
+std::shared_ptr<QueryMemoryTracker> current_query_memory_tracker() { return current_tracker; }
+
+ScopedQueryMemoryTracker::ScopedQueryMemoryTracker(const std::shared_ptr<QueryMemoryTracker>& tracker)
+    : _previous_tracker(std::move(current_tracker)) {
+  current_tracker = tracker;
+}
+
+ScopedQueryMemoryTracker::~ScopedQueryMemoryTracker() { current_tracker = std::move(_previous_tracker); }
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// QueryMemoryTracker accounts for the memory a single query uses and enforces a limit on it. Operators report into the
+// tracker that is current in their thread (see ScopedQueryMemoryTracker). Like the memory resource, tasks take the
+// tracker of the thread that created them with them (see AbstractTask), so a query's operators and jobs report into
+// the same tracker on any worker.
+//
+// Operators such as TableScan reserve the memory of their output while building it, before allocating each part.
+// For all others, AbstractOperator::execute reports the memory usage of the output once it is complete. Operators may
+// additionally report the memory of their temporary data structures, e.g., hash tables, and release it once they are
+// done. Operators that can spill to disk use try_reserve and spill if it fails, all others use reserve, which aborts
+// the query by throwing if the limit would be exceeded. The exception is passed on to whoever waits for the query's
+// tasks (see CurrentScheduler::schedule_and_wait_for_tasks).
+class QueryMemoryTracker : private Noncopyable {
+ public:
+  static constexpr auto UNLIMITED = std::numeric_limits<size_t>::max();
+
+  explicit QueryMemoryTracker(const size_t limit = UNLIMITED);
+
+  size_t limit() const;
+
+  // Returns the number of bytes that are currently reserved.
+  size_t used() const;
+
+  // Returns the maximum number of bytes that were reserved at any time.
+  size_t peak() const;
+
+  // Reserves the given number of bytes. Fails if this would exceed the limit, nothing is reserved in that case.
+  void reserve(const size_t bytes);
+
+  // Reserves the given number of bytes if this does not exceed the limit. Returns whether the bytes were reserved.
+  bool try_reserve(const size_t bytes);
+
+  // Releases previously reserved bytes.
+  void release(const size_t bytes);
+
+ protected:
+  const size_t _limit;
+  std::atomic<size_t> _used{0};
+  std::atomic<size_t> _peak{0};
+};
+
+// Returns the tracker that operators in the calling thread report into, or nullptr if their memory is not tracked.
+std::shared_ptr<QueryMemoryTracker> current_query_memory_tracker();
+
+// Installs a tracker for the calling thread for the lifetime of the object and restores the previous one afterwards.
+class ScopedQueryMemoryTracker : private Noncopyable {
+ public:
+  explicit ScopedQueryMemoryTracker(const std::shared_ptr<QueryMemoryTracker>& tracker);
+  ~ScopedQueryMemoryTracker();
+
+ protected:
+  std::shared_ptr<QueryMemoryTracker> _previous_tracker;
+};
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#include "spill_file.hpp"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+using RecordSize = uint32_t;
+
+template <typename T>
+void append_raw(std::string& buffer, const T value) {
+  const auto offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+T consume_raw(std::string_view& buffer) {
+  DebugAssert(buffer.size() >= sizeof(T), "Encoded value is truncated");
+  auto value = T{};
+  std::memcpy(&value, buffer.data(), sizeof(T));
+  buffer.remove_prefix(sizeof(T));
+  return value;
+}
+
+}  // namespace
+
+SpillFile::SpillFile() {
+  auto path = (std::filesystem::temp_directory_path() / "hyrise_spill_XXXXXX").string();
+  const auto file_descriptor = mkstemp(path.data());
+  Assert(file_descriptor != -1, "Cannot create spill file " + path);
+  unlink(path.c_str());
+
+  _file = fdopen(file_descriptor, "w+b");
+  if (!_file) {
+    close(file_descriptor);
+    Fail("Cannot open spill file " + path);
+  }
+}
+
+SpillFile::~SpillFile() { std::fclose(_file); }
+
+void SpillFile::write(const std::string_view record) {
+  Assert(!_is_reading, "Records cannot be written once reading started");
+  const auto size = static_cast<RecordSize>(record.size());
+  DebugAssert(size == record.size(), "Record is too large");
+
+  const auto written = std::fwrite(&size, sizeof(size), 1, _file) + std::fwrite(record.data(), 1, size, _file);
+  Assert(written == size + 1, "Cannot write to spill file");
+  ++_record_count;
+  _byte_count += sizeof(size) + size;
+}
+
+bool SpillFile::read(std::string& record) {
+  if (!_is_reading) {
+    Assert(std::fseek(_file, 0, SEEK_SET) == 0, "Cannot rewind spill file");
+    _is_reading = true;
+  }
+
+  auto size = RecordSize{0};
+  if (std::fread(&size, sizeof(size), 1, _file) != 1) {
+    Assert(std::feof(_file), "Cannot read from spill file");
+    return false;
+  }
+  record.resize(size);
+  Assert(std::fread(record.data(), 1, size, _file) == size, "Spill file is truncated");
+  return true;
+}
+
+size_t SpillFile::record_count() const { return _record_count; }
+
+size_t SpillFile::byte_count() const { return _byte_count; }
+
+void append_encoded_value(std::string& buffer, const TaggedValue& value) {
+  buffer.push_back(static_cast<char>(value.type_index()));
+  value.visit([&](const auto& typed_value) {
+    using ValueType = std::decay_t<decltype(typed_value)>;
+    if constexpr (std::is_same_v<ValueType, std::string_view>) {
+      append_raw(buffer, static_cast<RecordSize>(typed_value.size()));
+      buffer.append(typed_value);
+    } else if constexpr (!std::is_same_v<ValueType, NullValue>) {
+      append_raw(buffer, typed_value);
+    }
+  });
+}
+
+TaggedValue decode_value(std::string_view& buffer) {
+  const auto type_index = consume_raw<uint8_t>(buffer);
+  switch (type_index) {
+    case TaggedValue::TYPE_INDEX<NullValue>:
+      return NullValue{};
+    case TaggedValue::TYPE_INDEX<int32_t>:
+      return consume_raw<int32_t>(buffer);
+    case TaggedValue::TYPE_INDEX<int64_t>:
+      return consume_raw<int64_t>(buffer);
+    case TaggedValue::TYPE_INDEX<float>:
+      return consume_raw<float>(buffer);
+    case TaggedValue::TYPE_INDEX<double>:
+      return consume_raw<double>(buffer);
+    case TaggedValue::TYPE_INDEX<std::string>: {
+      const auto size = consume_raw<RecordSize>(buffer);
+      DebugAssert(buffer.size() >= size, "Encoded string is truncated");
+      const auto value = buffer.substr(0, size);
+      buffer.remove_prefix(size);
+      return value;
+    }
+  }
+  Fail("Unknown type index in encoded value");
+}
+
+}  // namespace opossum
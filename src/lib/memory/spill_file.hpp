@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "tagged_value.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// SpillFile is a temporary file that operators write records to once their data does not fit into the memory budget
+// of the query (see QueryMemoryTracker), e.g., the rows of the groups an Aggregate could not keep in memory. Records
+// are opaque byte strings that are read back in the order they were written.
+//
+// The file is created in std::filesystem::temp_directory_path(), i.e., in TMPDIR if it is set, so that spills can be
+// directed to a local SSD. It is unlinked right away and thus removed once it is closed, even if the process crashes.
+class SpillFile : private Noncopyable {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  // Appends a record. Records cannot be written once reading started.
+  void write(const std::string_view record);
+
+  // Reads the next record into the buffer. Returns false if all records were read.
+  bool read(std::string& record);
+
+  size_t record_count() const;
+
+  // Returns the number of bytes written, including the length prefixes of the records.
+  size_t byte_count() const;
+
+ protected:
+  std::FILE* _file;
+  size_t _record_count{0};
+  size_t _byte_count{0};
+  bool _is_reading{false};
+};
+
+// Appends the value to the buffer in the compact binary format of spilled records: a single byte holding the type
+// index (see TaggedValue), followed by the raw bytes of fixed-width values or the length and the characters of
+// strings. NULL has no payload. The encoding of equal values is equal, so encoded values can serve as hash keys.
+void append_encoded_value(std::string& buffer, const TaggedValue& value);
+
+// Decodes the value at the beginning of the buffer and removes it from the buffer. Strings reference the buffer.
+TaggedValue decode_value(std::string_view& buffer);
+
+}  // namespace opossum
@@ -1,12 +1,72 @@
 #include "abstract_operator.hpp"
 
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "memory/query_memory_tracker.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/cpu_time.hpp"
+
 namespace opossum {
 
+namespace {
+
+void print_plan_node(const AbstractOperator& op, std::ostream& stream, const size_t depth) {
+  stream << std::string(depth * 2, ' ') << op.description() << " [" << op.performance_data() << "]" << std::endl;
+  if (op.left_input()) print_plan_node(*op.left_input(), stream, depth + 1);
+  if (op.right_input()) print_plan_node(*op.right_input(), stream, depth + 1);
+}
+
+}  // namespace
+
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
                                    const std::shared_ptr<const AbstractOperator> right)
     : _left_input(left), _right_input(right) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+void AbstractOperator::execute() {
+  auto performance_data = OperatorPerformanceData{};
+  const auto walltime_begin = std::chrono::steady_clock::now();
+  const auto cpu_time_begin = thread_cpu_time();
+  const auto cpu_time_counter = std::make_shared<CpuTimeCounter>();
+
+  {
+    const auto cpu_time_counter_scope = ScopedCpuTimeCounter{cpu_time_counter};
+    _output = _on_execute();
+  }
+
+  performance_data.cpu_time = thread_cpu_time() - cpu_time_begin + cpu_time_counter->cpu_time();
+  performance_data.walltime = std::chrono::steady_clock::now() - walltime_begin;
+  performance_data.executed = true;
+
+  auto forwards_input = false;
+  for (const auto& input : {_left_input, _right_input}) {
+    if (!input) continue;
+
+    const auto input_table = input->get_output();
+    performance_data.input_row_count += input_table->row_count();
+    performance_data.input_chunk_count += input_table->chunk_count();
+    forwards_input |= input_table == _output;
+  }
+
+  if (_output) {
+    performance_data.output_row_count = _output->row_count();
+    performance_data.output_chunk_count = _output->chunk_count();
+    performance_data.estimated_output_bytes = forwards_input ? 0 : _output->memory_usage();
+  }
+
+  // The outputs of a query's operators live until the query is done, so their memory is not released. Operators that
+  // do not reserve it while building the output only find out about exceeding the limit afterwards.
+  const auto memory_tracker = current_query_memory_tracker();
+  if (memory_tracker && !_outputs_existing_table() && !_reserves_output_memory()) {
+    memory_tracker->reserve(performance_data.estimated_output_bytes);
+  }
+
+  _performance_data = performance_data;
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   // TODO(student): You should place some meaningful checks here
@@ -14,6 +74,35 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::shared_ptr<const AbstractOperator> AbstractOperator::left_input() const { return _left_input; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::right_input() const { return _right_input; }
+
+std::string AbstractOperator::description() const { return name(); }
+
+bool AbstractOperator::is_pipelineable() const { return false; }
+
+std::shared_ptr<const Table> AbstractOperator::execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                             const ChunkID chunk_id) const {
+  Fail("Operator " + name() + " cannot be executed chunk by chunk");
+}
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+void AbstractOperator::set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context) {
+  _transaction_context = transaction_context;
+}
+
+const std::shared_ptr<TransactionContext>& AbstractOperator::transaction_context() const {
+  return _transaction_context;
+}
+
+void AbstractOperator::print_plan(std::ostream& stream) const { print_plan_node(*this, stream, 0); }
+
+bool AbstractOperator::_outputs_existing_table() const { return false; }
+
+bool AbstractOperator::_reserves_output_memory() const { return false; }
+
 std::shared_ptr<const Table> AbstractOperator::_left_input_table() const { return _left_input->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::_right_input_table() const { return _right_input->get_output(); }
@@ -1,14 +1,18 @@
 #pragma once
 
+#include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "operator_performance_data.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class Pipeline;
 class Table;
+class TransactionContext;
 
 // AbstractOperator is the abstract super class for all operators. All operators have up to two input tables and one
 // output table. Their lifecycle has three phases:
@@ -20,6 +24,10 @@ class Table;
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
 // Operators shall not be executed twice.
+//
+// Alternatively, a chain of operators can be executed chunk by chunk by a Pipeline. This is possible for operators that
+// produce each output chunk from a single chunk of their left input, such as TableScan. These operators override
+// is_pipelineable and execute_chunk. Within a pipeline, only the last operator has an output.
 
 class AbstractOperator : private Noncopyable {
  public:
@@ -41,11 +49,52 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> left_input() const;
   std::shared_ptr<const AbstractOperator> right_input() const;
 
+  // Returns the name of the operator, e.g., "TableScan".
+  virtual const std::string& name() const = 0;
+
+  // Returns a human-readable description of the operator including its parameters. Defaults to the name.
+  virtual std::string description() const;
+
+  // Returns the performance data recorded by execute.
+  const OperatorPerformanceData& performance_data() const;
+
+  // Returns whether the operator can be executed chunk by chunk, see above. Defaults to false.
+  virtual bool is_pipelineable() const;
+
+  // Processes the chunk with the given id of input_table and returns the result as a table that holds a single chunk,
+  // which may be empty. input_table takes the place of the left input's output. Pipelineable operators have to
+  // implement this in a thread-safe way, since pipelines process multiple chunks concurrently.
+  virtual std::shared_ptr<const Table> execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                     const ChunkID chunk_id) const;
+
+  // Sets the transaction the operator runs in. Operators that read or modify tables that use MVCC (e.g., Validate and
+  // Insert) need one. The context is not passed on to the inputs.
+  void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Returns the transaction the operator runs in, or nullptr if there is none.
+  const std::shared_ptr<TransactionContext>& transaction_context() const;
+
+  // Prints the plan rooted at this operator, one operator per line with its performance data. Inputs are indented
+  // below the operator that consumes them.
+  void print_plan(std::ostream& stream = std::cout) const;
+
  protected:
+  // The pipeline sets the output and the performance data of the last operator it executes.
+  friend class Pipeline;
+
   // Abstract method to actually execute the operator execute and get_output are split into two methods to allow for
   // easier asynchronous execution.
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  // Returns whether the output is a table that exists independently of the query, e.g., one of the StorageManager. The
+  // memory of such outputs is not reported to the QueryMemoryTracker. Defaults to false.
+  virtual bool _outputs_existing_table() const;
+
+  // Returns whether the operator reserves the memory of its output at the QueryMemoryTracker while building it, before
+  // allocating each part, so that the limit stops the allocation. Otherwise, execute reserves the estimated output size
+  // once _on_execute is done. Defaults to false.
+  virtual bool _reserves_output_memory() const;
+
   std::shared_ptr<const Table> _left_input_table() const;
   std::shared_ptr<const Table> _right_input_table() const;
 
@@ -56,6 +105,10 @@ class AbstractOperator : private Noncopyable {
 
   // Is nullptr until the operator is executed.
   std::shared_ptr<const Table> _output;
+
+  OperatorPerformanceData _performance_data;
+
+  std::shared_ptr<TransactionContext> _transaction_context;
 };
 
 }  // namespace opossum
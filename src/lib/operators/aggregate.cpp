@@ -0,0 +1,324 @@
+#include "aggregate.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "memory/query_arena.hpp"
+#include "memory/query_memory_tracker.hpp"
+#include "memory/spill_file.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "tagged_value.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+using KeySize = uint32_t;
+
+// The state of a single aggregate of a group. Which members are used depends on the aggregate function.
+struct AggregateState {
+  int64_t count{0};
+  int64_t long_sum{0};
+  double double_sum{0.0};
+  AllTypeVariant extreme{NULL_VALUE};
+};
+
+// Allows looking up groups by the string_view of an encoded key without copying it.
+struct KeyHash {
+  using is_transparent = void;
+
+  size_t operator()(const std::string_view key) const { return std::hash<std::string_view>{}(key); }
+};
+
+using GroupMap = std::unordered_map<std::string, std::vector<AggregateState>, KeyHash, std::equal_to<>>;
+
+// Compares two non-NULL values of the same type.
+bool less_than(const TaggedValue& left, const TaggedValue& right) {
+  return left.visit([&](const auto& left_value) {
+    using ValueType = std::decay_t<decltype(left_value)>;
+    if constexpr (std::is_same_v<ValueType, NullValue>) {
+      return false;
+    } else {
+      using DataType = std::conditional_t<std::is_same_v<ValueType, std::string_view>, std::string, ValueType>;
+      return left_value < right.get<DataType>();
+    }
+  });
+}
+
+void update_state(AggregateState& state, const AggregateFunction function, const TaggedValue& value) {
+  if (value.is_null()) return;
+  ++state.count;
+
+  switch (function) {
+    case AggregateFunction::Count:
+      return;
+    case AggregateFunction::Sum:
+    case AggregateFunction::Avg:
+      value.visit([&](const auto& typed_value) {
+        using ValueType = std::decay_t<decltype(typed_value)>;
+        if constexpr (std::is_integral_v<ValueType>) {
+          state.long_sum += typed_value;
+          state.double_sum += static_cast<double>(typed_value);
+        } else if constexpr (std::is_floating_point_v<ValueType>) {
+          state.double_sum += typed_value;
+        }
+      });
+      return;
+    case AggregateFunction::Min:
+      if (state.count == 1 || less_than(value, TaggedValue{state.extreme})) state.extreme = value.to_all_type_variant();
+      return;
+    case AggregateFunction::Max:
+      if (state.count == 1 || less_than(TaggedValue{state.extreme}, value)) state.extreme = value.to_all_type_variant();
+      return;
+  }
+}
+
+// Group keys compare the encoded bytes of the values. Floating-point values that are equal but differ in their bytes,
+// i.e., 0.0 and -0.0, are mapped to the same representation, and so are all NaNs, so that they form a single group.
+TaggedValue normalize_group_value(const TaggedValue& value) {
+  return value.visit([&](const auto& typed_value) -> TaggedValue {
+    using ValueType = std::decay_t<decltype(typed_value)>;
+    if constexpr (std::is_floating_point_v<ValueType>) {
+      if (std::isnan(typed_value)) return std::numeric_limits<ValueType>::quiet_NaN();
+      if (typed_value == ValueType{0}) return ValueType{0};
+    }
+    return value;
+  });
+}
+
+// The returned value may reference the state, so it must not outlive it.
+TaggedValue final_value(const AggregateState& state, const AggregateFunction function, const std::string& column_type) {
+  if (function == AggregateFunction::Count) return state.count;
+  if (state.count == 0) return NullValue{};
+
+  switch (function) {
+    case AggregateFunction::Sum:
+      if (column_type == "int" || column_type == "long") return state.long_sum;
+      return state.double_sum;
+    case AggregateFunction::Avg:
+      return state.double_sum / static_cast<double>(state.count);
+    default:
+      return TaggedValue{state.extreme};
+  }
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& stream, const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return stream << "COUNT";
+    case AggregateFunction::Sum:
+      return stream << "SUM";
+    case AggregateFunction::Avg:
+      return stream << "AVG";
+    case AggregateFunction::Min:
+      return stream << "MIN";
+    case AggregateFunction::Max:
+      return stream << "MAX";
+  }
+  return stream;
+}
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator>& in,
+                     const std::vector<ColumnID>& group_by_column_ids,
+                     const std::vector<AggregateColumnDefinition>& aggregates)
+    : AbstractOperator(in), _group_by_column_ids(group_by_column_ids), _aggregates(aggregates) {}
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::string& Aggregate::name() const {
+  static const auto name = std::string{"Aggregate"};
+  return name;
+}
+
+std::string Aggregate::description() const {
+  auto stream = std::stringstream{};
+  stream << name() << " (group by";
+  for (const auto column_id : _group_by_column_ids) {
+    stream << " #" << column_id;
+  }
+  stream << ";";
+  for (const auto& aggregate : _aggregates) {
+    stream << " " << aggregate.function << "(#" << aggregate.column_id << ")";
+  }
+  stream << ")";
+  return stream.str();
+}
+
+size_t Aggregate::spilled_row_count() const { return _spilled_row_count; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _left_input_table();
+  auto output_table = _create_output_table_definition(*input_table);
+  auto& output_chunk = *output_table->get_chunk(ChunkID{0});
+
+  _aggregate_column_types.clear();
+  for (const auto& aggregate : _aggregates) {
+    _aggregate_column_types.push_back(input_table->column_type(aggregate.column_id));
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_id = ChunkID{0};
+  auto chunk_offset = ChunkOffset{0};
+  auto chunk = chunk_count > 0 ? input_table->get_chunk(chunk_id) : nullptr;
+  const auto next_row = [&](std::string& row) {
+    while (chunk && chunk_offset >= chunk->size()) {
+      ++chunk_id;
+      chunk_offset = ChunkOffset{0};
+      chunk = chunk_id < chunk_count ? input_table->get_chunk(chunk_id) : nullptr;
+    }
+    if (!chunk) return false;
+
+    row.resize(sizeof(KeySize));
+    for (const auto column_id : _group_by_column_ids) {
+      // The value owns the characters of strings, so it has to be kept until the string is encoded.
+      const auto value = (*chunk->get_segment(column_id))[chunk_offset];
+      append_encoded_value(row, normalize_group_value(value));
+    }
+    const auto key_size = static_cast<KeySize>(row.size() - sizeof(KeySize));
+    std::memcpy(row.data(), &key_size, sizeof(KeySize));
+
+    for (const auto& aggregate : _aggregates) {
+      const auto value = (*chunk->get_segment(aggregate.column_id))[chunk_offset];
+      append_encoded_value(row, value);
+    }
+    ++chunk_offset;
+    return true;
+  };
+  _aggregate(next_row, 0, output_chunk);
+
+  // Like in SQL, aggregates without group-by columns return a row even if there is no input row.
+  if (_group_by_column_ids.empty() && output_chunk.size() == 0) {
+    auto values = std::vector<TaggedValue>{};
+    for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+      values.push_back(final_value(AggregateState{}, _aggregates[aggregate_index].function,
+                                   _aggregate_column_types[aggregate_index]));
+    }
+    output_chunk.append(values);
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> Aggregate::_create_output_table_definition(const Table& input_table) const {
+  auto output_table = make_shared_intermediate<Table>();
+  for (const auto column_id : _group_by_column_ids) {
+    output_table->add_column(input_table.column_name(column_id), input_table.column_type(column_id),
+                             input_table.column_is_nullable(column_id));
+  }
+
+  for (const auto& aggregate : _aggregates) {
+    const auto& column_type = input_table.column_type(aggregate.column_id);
+    auto name = std::stringstream{};
+    name << aggregate.function << "(" << input_table.column_name(aggregate.column_id) << ")";
+
+    switch (aggregate.function) {
+      case AggregateFunction::Count:
+        output_table->add_column(name.str(), "long");
+        break;
+      case AggregateFunction::Sum:
+        Assert(column_type != "string", "Cannot compute the sum of a string column");
+        output_table->add_column(name.str(), column_type == "int" || column_type == "long" ? "long" : "double", true);
+        break;
+      case AggregateFunction::Avg:
+        Assert(column_type != "string", "Cannot compute the average of a string column");
+        output_table->add_column(name.str(), "double", true);
+        break;
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        output_table->add_column(name.str(), column_type, true);
+        break;
+    }
+  }
+  return output_table;
+}
+
+void Aggregate::_aggregate(const RowSource& next_row, const size_t level, Chunk& output_chunk) {
+  Assert(level * SPILL_PARTITION_BITS < sizeof(size_t) * 8, "Aggregate cannot split spilled partitions any further");
+  const auto tracker = current_query_memory_tracker();
+  const auto aggregate_count = _aggregates.size();
+
+  auto groups = GroupMap{};
+  auto reserved_bytes = size_t{0};
+  // Empty until the first group does not fit into the memory limit.
+  auto partitions = std::vector<std::unique_ptr<SpillFile>>{};
+
+  auto row = std::string{};
+  while (next_row(row)) {
+    auto buffer = std::string_view{row};
+    auto key_size = KeySize{0};
+    std::memcpy(&key_size, buffer.data(), sizeof(KeySize));
+    buffer.remove_prefix(sizeof(KeySize));
+    const auto key = buffer.substr(0, key_size);
+    buffer.remove_prefix(key_size);
+
+    auto group = groups.find(key);
+    if (group == groups.end()) {
+      const auto group_bytes = sizeof(std::string) + key.size() + aggregate_count * sizeof(AggregateState) +
+                               GROUP_OVERHEAD;
+      if (partitions.empty() && tracker && !tracker->try_reserve(group_bytes)) {
+        // A single group has to fit, otherwise spilling cannot make progress.
+        if (groups.empty()) tracker->reserve(group_bytes);
+        for (auto partition_index = size_t{0}; partition_index < SPILL_PARTITION_COUNT; ++partition_index) {
+          partitions.push_back(std::make_unique<SpillFile>());
+        }
+      }
+
+      if (!partitions.empty()) {
+        const auto hash = KeyHash{}(key) >> (level * SPILL_PARTITION_BITS);
+        partitions[hash % SPILL_PARTITION_COUNT]->write(row);
+        ++_spilled_row_count;
+        continue;
+      }
+
+      if (tracker) reserved_bytes += group_bytes;
+      group = groups.emplace(std::string{key}, std::vector<AggregateState>(aggregate_count)).first;
+    }
+
+    auto& states = group->second;
+    for (auto aggregate_index = size_t{0}; aggregate_index < aggregate_count; ++aggregate_index) {
+      update_state(states[aggregate_index], _aggregates[aggregate_index].function, decode_value(buffer));
+    }
+  }
+
+  auto values = std::vector<TaggedValue>{};
+  for (const auto& [key, states] : groups) {
+    values.clear();
+    auto key_buffer = std::string_view{key};
+    for (auto group_by_index = size_t{0}; group_by_index < _group_by_column_ids.size(); ++group_by_index) {
+      values.push_back(decode_value(key_buffer));
+    }
+    for (auto aggregate_index = size_t{0}; aggregate_index < aggregate_count; ++aggregate_index) {
+      values.push_back(final_value(states[aggregate_index], _aggregates[aggregate_index].function,
+                                   _aggregate_column_types[aggregate_index]));
+    }
+    output_chunk.append(values);
+  }
+
+  groups.clear();
+  if (tracker) tracker->release(reserved_bytes);
+
+  for (auto& partition : partitions) {
+    if (partition->record_count() > 0) {
+      _aggregate([&](std::string& spilled_row) { return partition->read(spilled_row); }, level + 1, output_chunk);
+    }
+    partition.reset();
+  }
+}
+
+}  // namespace opossum
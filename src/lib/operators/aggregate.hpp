@@ -0,0 +1,86 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+enum class AggregateFunction { Count, Sum, Avg, Min, Max };
+
+std::ostream& operator<<(std::ostream& stream, const AggregateFunction function);
+
+struct AggregateColumnDefinition {
+  ColumnID column_id;
+  AggregateFunction function;
+};
+
+// Operator that groups the rows of its input by the values of the group-by columns and computes the aggregates of each
+// group. The output holds one row per group: the values of the group-by columns, followed by one column per aggregate.
+// Without group-by columns, the output holds a single row, even if the input is empty. Like in SQL, NULL values form
+// a group of their own and are ignored by the aggregates. Aggregates of groups without any non-NULL value are NULL,
+// except for Count, which is 0.
+//
+// Count returns a long. Sum returns a long for int and long columns and a double for float and double columns. Avg
+// returns a double. Min and Max return the type of the aggregated column. Only Count, Min, and Max support strings.
+//
+// The groups are kept in a hash table, whose memory is reserved in the current QueryMemoryTracker. Once a new group
+// does not fit into the query's memory limit anymore, the aggregate spills: rows of groups that are in the hash table
+// are still aggregated in memory, whereas the rows of all other groups are written to one of SPILL_PARTITION_COUNT
+// SpillFiles, chosen by the hash of the group. After the groups in memory were emitted and their memory was released,
+// each partition is aggregated the same way, spilling recursively if necessary. Each level uses different bits of the
+// hash, so that the groups of a partition are split up further.
+class Aggregate : public AbstractOperator {
+ public:
+  static constexpr auto SPILL_PARTITION_BITS = size_t{4};
+  static constexpr auto SPILL_PARTITION_COUNT = size_t{1} << SPILL_PARTITION_BITS;
+
+  // Estimated memory usage of a group in the hash table in addition to its key and aggregate states.
+  static constexpr auto GROUP_OVERHEAD = size_t{64};
+
+  Aggregate(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& group_by_column_ids,
+            const std::vector<AggregateColumnDefinition>& aggregates);
+
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+
+  const std::string& name() const override;
+
+  std::string description() const override;
+
+  // Returns the number of rows that were written to SpillFiles, summed over all levels of recursion.
+  size_t spilled_row_count() const;
+
+ protected:
+  // Encoded rows consist of the length of the encoded group key, the group key, and the aggregated values. The values
+  // are encoded with append_encoded_value, which is also the format of spilled rows.
+  using RowSource = std::function<bool(std::string& row)>;
+
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table_definition(const Table& input_table) const;
+
+  // Aggregates the rows of the source and appends one row per group to the output chunk. level is the depth of
+  // recursion, i.e., 0 for the input table.
+  void _aggregate(const RowSource& next_row, const size_t level, Chunk& output_chunk);
+
+  const std::vector<ColumnID> _group_by_column_ids;
+  const std::vector<AggregateColumnDefinition> _aggregates;
+
+  // Types of the aggregated columns, set by _on_execute.
+  std::vector<std::string> _aggregate_column_types;
+
+  size_t _spilled_row_count{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include "delete.hpp"
+
+#include <memory>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Delete::Delete(const std::shared_ptr<const AbstractOperator>& rows_to_delete) : AbstractOperator(rows_to_delete) {}
+
+const std::string& Delete::name() const {
+  static const auto name = std::string{"Delete"};
+  return name;
+}
+
+std::shared_ptr<const Table> Delete::_on_execute() {
+  Assert(_transaction_context, "Delete needs a transaction context");
+  const auto transaction_id = _transaction_context->transaction_id();
+  const auto input_table = _left_input_table();
+
+  const auto chunk_count = input_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+
+    // All columns reference the same rows, so the position list of the first one is sufficient.
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    Assert(segment, "Delete needs ReferenceSegments as input");
+    const auto& table = segment->referenced_table();
+    Assert(table->uses_mvcc(), "Delete can only be used on tables that use MVCC");
+
+    for (const auto& row_id : *segment->pos_list()) {
+      const auto& mvcc_data = table->get_chunk(row_id.chunk_id)->mvcc_data();
+      auto expected = INVALID_TRANSACTION_ID;
+      if (mvcc_data->compare_exchange_tid(row_id.chunk_offset, expected, transaction_id)) {
+        _transaction_context->register_delete(table, row_id);
+        continue;
+      }
+
+      if (expected != transaction_id) {
+        // Another transaction holds the lock, either because it is deleting the row or because it already deleted it.
+        _transaction_context->mark_as_conflicted();
+        return nullptr;
+      }
+
+      // Our own transaction inserted the row (or deleted it already). Uncommitted rows that are deleted again get an
+      // end commit id of 0, which hides them from everyone, including after the commit.
+      if (mvcc_data->begin_cid(row_id.chunk_offset) == MAX_COMMIT_ID) {
+        mvcc_data->set_end_cid(row_id.chunk_offset, CommitID{0});
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace opossum
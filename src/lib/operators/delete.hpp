@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Operator that deletes the rows its input references from their table, which has to use MVCC. The input has to
+// consist of ReferenceSegments, usually the output of a Validate followed by TableScans. Delete has no output.
+//
+// The rows are locked for the transaction of the operator (see set_transaction_context) and invalidated once it
+// commits: their end commit id acts as a tombstone that hides them from later snapshots. If another transaction
+// deleted or is deleting one of the rows, the transaction is marked as conflicted (see TransactionContext) and has to
+// be rolled back.
+class Delete : public AbstractOperator {
+ public:
+  explicit Delete(const std::shared_ptr<const AbstractOperator>& rows_to_delete);
+
+  const std::string& name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
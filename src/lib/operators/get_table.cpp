@@ -0,0 +1,25 @@
+#include "get_table.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+GetTable::GetTable(const std::string& name) : _table_name(name) {}
+
+const std::string& GetTable::table_name() const { return _table_name; }
+
+const std::string& GetTable::name() const {
+  static const auto name = std::string{"GetTable"};
+  return name;
+}
+
+std::string GetTable::description() const { return name() + " (" + _table_name + ")"; }
+
+std::shared_ptr<const Table> GetTable::_on_execute() { return StorageManager::get().get_table(_table_name); }
+
+bool GetTable::_outputs_existing_table() const { return true; }
+
+}  // namespace opossum
@@ -11,20 +11,20 @@ namespace opossum {
 // Operator to retrieve a table from the StorageManager by specifying its name.
 class GetTable : public AbstractOperator {
  public:
-  explicit GetTable(const std::string& name) {
-    // TODO(student) implement it in a source file and change this to a declaration.
-  }
+  explicit GetTable(const std::string& name);
 
-  const std::string& table_name() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  const std::string& table_name() const;
+
+  const std::string& name() const override;
+
+  std::string description() const override;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  std::shared_ptr<const Table> _on_execute() override;
+
+  bool _outputs_existing_table() const override;
+
+  const std::string _table_name;
 };
 
 }  // namespace opossum
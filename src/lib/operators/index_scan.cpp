@@ -0,0 +1,148 @@
+#include "index_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "memory/query_arena.hpp"
+#include "memory/query_memory_tracker.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value,
+                     std::optional<std::vector<ChunkID>> included_chunk_ids)
+    : AbstractOperator(in),
+      _column_id(column_id),
+      _scan_type(scan_type),
+      _search_value(search_value),
+      _included_chunk_ids(std::move(included_chunk_ids)) {}
+
+const std::string& IndexScan::name() const {
+  static const auto name = std::string{"IndexScan"};
+  return name;
+}
+
+std::string IndexScan::description() const {
+  auto stream = std::stringstream{};
+  stream << name() << " (column #" << _column_id << " " << _scan_type << " " << _search_value << ")";
+  return stream.str();
+}
+
+void IndexScan::scan_index(const BaseIndex& index, const ScanType scan_type, const AllTypeVariant& search_value,
+                           std::vector<ChunkOffset>& matches) {
+  const auto previous_match_count = matches.size();
+  const auto append = [&](const auto begin, const auto end) { matches.insert(matches.end(), begin, end); };
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      append(index.lower_bound({search_value}), index.upper_bound({search_value}));
+      break;
+    case ScanType::OpNotEquals:
+      append(index.cbegin(), index.lower_bound({search_value}));
+      append(index.upper_bound({search_value}), index.cend());
+      break;
+    case ScanType::OpLessThan:
+      append(index.cbegin(), index.lower_bound({search_value}));
+      break;
+    case ScanType::OpLessThanEquals:
+      append(index.cbegin(), index.upper_bound({search_value}));
+      break;
+    case ScanType::OpGreaterThan:
+      append(index.upper_bound({search_value}), index.cend());
+      break;
+    case ScanType::OpGreaterThanEquals:
+      append(index.lower_bound({search_value}), index.cend());
+      break;
+    case ScanType::OpIsNull:
+    case ScanType::OpIsNotNull:
+      Fail("Indexes do not contain NULL values and cannot answer NULL scans");
+  }
+
+  // The index orders the offsets by value. Output chunks have to preserve the order of the input, so the offsets are
+  // sorted unless they all belong to the same value and are thus already in order.
+  if (scan_type != ScanType::OpEquals) {
+    std::sort(matches.begin() + previous_match_count, matches.end());
+  }
+}
+
+std::shared_ptr<const Table> IndexScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  const auto column_count = input_table->column_count();
+  Assert(_column_id < column_count, "Scanned column does not exist");
+
+  auto output_table = make_shared_intermediate<Table>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_is_nullable(column_id));
+  }
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  if (_included_chunk_ids) {
+    chunk_ids = *_included_chunk_ids;
+  } else {
+    chunk_ids.reserve(input_table->chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      chunk_ids.push_back(chunk_id);
+    }
+  }
+
+  // Each chunk is looked up by its own job. The output chunks are emplaced in the order of the included chunk ids.
+  // Each position list is reserved before it is allocated (see AbstractOperator::_reserves_output_memory).
+  const auto memory_tracker = current_query_memory_tracker();
+  auto pos_lists = std::vector<std::shared_ptr<PosList>>(chunk_ids.size());
+  auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+  jobs.reserve(chunk_ids.size());
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_ids.size(); ++chunk_index) {
+    const auto chunk_id = chunk_ids[chunk_index];
+    const auto chunk = input_table->get_chunk(chunk_id);
+    const auto indexes = chunk->get_indexes(std::vector<ColumnID>{_column_id});
+    Assert(!indexes.empty(), "IndexScan requires an index on the scanned column of every included chunk");
+
+    jobs.push_back(std::make_shared<JobTask>([&, index = indexes.front(), chunk_index, chunk_id] {
+      auto matches = std::vector<ChunkOffset>{};
+      scan_index(*index, _scan_type, _search_value, matches);
+      if (matches.empty()) return;
+
+      if (memory_tracker) memory_tracker->reserve(matches.size() * sizeof(RowID));
+      auto pos_list = make_shared_intermediate<PosList>();
+      pos_list->reserve(matches.size());
+      for (const auto chunk_offset : matches) {
+        pos_list->push_back(RowID{chunk_id, chunk_offset});
+      }
+      pos_lists[chunk_index] = pos_list;
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  const auto emplace_output_chunk = [&](const std::shared_ptr<PosList>& pos_list) {
+    auto output_chunk = make_shared_intermediate<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_chunk->add_segment(make_shared_intermediate<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+    output_table->emplace_chunk(output_chunk);
+  };
+
+  for (const auto& pos_list : pos_lists) {
+    if (pos_list) emplace_output_chunk(pos_list);
+  }
+
+  // Consumers expect every chunk to hold one segment per column, even if no row matched at all.
+  if (output_table->row_count() == 0) emplace_output_chunk(make_shared_intermediate<PosList>());
+
+  return output_table;
+}
+
+bool IndexScan::_reserves_output_memory() const { return true; }
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseIndex;
+
+// Operator that filters its input table like a TableScan, but looks up the matching rows in the chunk indexes (see
+// Chunk::create_index) on the scanned column instead of scanning the segments. The output consists of
+// ReferenceSegments that reference the input table, one output chunk per included chunk with matches.
+//
+// All included chunks need an index on the scanned column. If no chunk ids are given, all chunks are included.
+// TableScan uses index lookups on its own where they are estimated to be cheaper than a scan, so IndexScan is mostly
+// useful if the caller knows better.
+class IndexScan : public AbstractOperator {
+ public:
+  IndexScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value, std::optional<std::vector<ChunkID>> included_chunk_ids = std::nullopt);
+
+  const std::string& name() const override;
+
+  std::string description() const override;
+
+  // Appends the offsets of all rows of the indexed chunk for which "value <scan_type> search_value" holds to matches,
+  // in ascending order. Indexes do not contain NULL values, so NULL scan types are not supported.
+  static void scan_index(const BaseIndex& index, const ScanType scan_type, const AllTypeVariant& search_value,
+                         std::vector<ChunkOffset>& matches);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  bool _reserves_output_memory() const override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  const std::optional<std::vector<ChunkID>> _included_chunk_ids;
+};
+
+}  // namespace opossum
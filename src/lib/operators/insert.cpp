@@ -0,0 +1,56 @@
+#include "insert.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert)
+    : AbstractOperator(values_to_insert), _target_table_name(target_table_name) {}
+
+const std::string& Insert::target_table_name() const { return _target_table_name; }
+
+const std::string& Insert::name() const {
+  static const auto name = std::string{"Insert"};
+  return name;
+}
+
+std::string Insert::description() const { return name() + " (" + _target_table_name + ")"; }
+
+std::shared_ptr<const Table> Insert::_on_execute() {
+  Assert(_transaction_context, "Insert needs a transaction context");
+  const auto target_table = StorageManager::get().get_table(_target_table_name);
+  Assert(target_table->uses_mvcc(), "Insert can only be used on tables that use MVCC");
+  const auto input_table = _left_input_table();
+  const auto column_count = input_table->column_count();
+  Assert(column_count == target_table->column_count(), "Inserted rows have to match the columns of the target table");
+
+  const auto transaction_id = _transaction_context->transaction_id();
+  // The tagged values reference the strings of the variants, which therefore have to stay alive until the row is
+  // appended.
+  auto variants = std::vector<AllTypeVariant>(column_count);
+  auto values = std::vector<TaggedValue>{};
+  values.reserve(column_count);
+  const auto chunk_count = input_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      values.clear();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        variants[column_id] = (*chunk->get_segment(column_id))[chunk_offset];
+        values.emplace_back(variants[column_id]);
+      }
+      _transaction_context->register_insert(target_table, target_table->append(values, transaction_id));
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Operator that appends the rows of its input table to the table with the given name in the StorageManager, which has
+// to use MVCC. The rows belong to the transaction of the operator (see set_transaction_context) and become visible to
+// other transactions once it commits. Insert has no output.
+class Insert : public AbstractOperator {
+ public:
+  Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert);
+
+  const std::string& target_table_name() const;
+
+  const std::string& name() const override;
+
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _target_table_name;
+};
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#include "operator_performance_data.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace opossum {
+
+void OperatorPerformanceData::output_to_stream(std::ostream& stream) const {
+  if (!executed) {
+    stream << "not executed";
+    return;
+  }
+
+  const auto to_milliseconds = [](const std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+
+  stream << "walltime: " << to_milliseconds(walltime) << " ms, cpu time: " << to_milliseconds(cpu_time) << " ms, ";
+  stream << "input: " << input_row_count << " rows in " << input_chunk_count << " chunks, ";
+  stream << "output: " << output_row_count << " rows in " << output_chunk_count << " chunks (" << estimated_output_bytes
+         << " bytes)";
+}
+
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data) {
+  performance_data.output_to_stream(stream);
+  return stream;
+}
+
+}  // namespace opossum
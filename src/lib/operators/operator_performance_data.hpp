@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+namespace opossum {
+
+// Performance data that AbstractOperator::execute records for every operator. Times are measured around _on_execute,
+// i.e., they do not include the execution of the input operators.
+struct OperatorPerformanceData {
+  // Prints the data in a single line, e.g., for plan dumps.
+  void output_to_stream(std::ostream& stream) const;
+
+  bool executed = false;
+
+  std::chrono::nanoseconds walltime{0};
+
+  // CPU time of the thread that executed the operator plus the CPU time of the operator's jobs that ran on other
+  // threads (see CpuTimeCounter).
+  std::chrono::nanoseconds cpu_time{0};
+
+  // Sums over the left and the right input table.
+  uint64_t input_row_count = 0;
+  uint64_t input_chunk_count = 0;
+
+  uint64_t output_row_count = 0;
+  uint64_t output_chunk_count = 0;
+
+  // Estimated size of the output table (see Table::memory_usage). This is not the number of bytes the operator
+  // allocated: temporary data structures and allocator overhead are not included. Operators that forward their input
+  // table report 0. Operators that forward a stored table (e.g., GetTable) report the size of that table.
+  uint64_t estimated_output_bytes = 0;
+};
+
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data);
+
+}  // namespace opossum
@@ -0,0 +1,140 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "memory/query_arena.hpp"
+#include "memory/query_memory_tracker.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/cpu_time.hpp"
+
+namespace opossum {
+
+Pipeline::Pipeline(const std::shared_ptr<AbstractOperator>& root) {
+  auto op = root;
+  while (op && op->is_pipelineable()) {
+    _operators.push_back(op);
+    // See OperatorTask for why the constness of inputs is cast away.
+    op = std::const_pointer_cast<AbstractOperator>(op->left_input());
+  }
+  Assert(!_operators.empty(), "Root operator of a pipeline has to be pipelineable");
+  Assert(op, "Pipeline needs a source operator");
+
+  _source = op;
+  std::reverse(_operators.begin(), _operators.end());
+}
+
+void Pipeline::execute() {
+  const auto walltime_begin = std::chrono::steady_clock::now();
+  const auto cpu_time_begin = thread_cpu_time();
+  const auto cpu_time_counter = std::make_shared<CpuTimeCounter>();
+
+  const auto source_table = _execute_source();
+
+  auto outputs = std::vector<std::shared_ptr<const Table>>(source_table->chunk_count());
+  {
+    // Like AbstractOperator::execute, the root counts the CPU time of the jobs that other threads execute.
+    const auto cpu_time_counter_scope = ScopedCpuTimeCounter{cpu_time_counter};
+    execute([&outputs](const ChunkID source_chunk_id, const std::shared_ptr<const Table>& output) {
+      // Each entry is only written by the job that processes the corresponding chunk.
+      outputs[source_chunk_id] = output;
+    });
+  }
+
+  const auto& root = _operators.back();
+  auto output_table = make_shared_intermediate<Table>();
+  const auto& first_output = *outputs.front();
+  const auto column_count = first_output.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(first_output.column_name(column_id), first_output.column_type(column_id),
+                                        first_output.column_is_nullable(column_id));
+  }
+
+  // The segments are shared with the per-chunk results, only the chunks wrapping them are recreated.
+  const auto emplace_output_chunk = [&](const Table& output) {
+    const auto& output_chunk = *output.get_chunk(ChunkID{0});
+    auto chunk = make_shared_intermediate<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      chunk->add_segment(output_chunk.get_segment(column_id));
+    }
+    output_table->emplace_chunk(chunk);
+  };
+
+  for (const auto& output : outputs) {
+    if (output->row_count() > 0) emplace_output_chunk(*output);
+  }
+
+  // Like the regular execution, an empty result still holds a chunk with one segment per column.
+  if (output_table->row_count() == 0) emplace_output_chunk(first_output);
+
+  root->_output = output_table;
+
+  auto& performance_data = root->_performance_data;
+  performance_data = OperatorPerformanceData{};
+  performance_data.executed = true;
+  performance_data.walltime = std::chrono::steady_clock::now() - walltime_begin;
+  performance_data.cpu_time = thread_cpu_time() - cpu_time_begin + cpu_time_counter->cpu_time();
+  performance_data.input_row_count = source_table->row_count();
+  performance_data.input_chunk_count = source_table->chunk_count();
+  performance_data.output_row_count = output_table->row_count();
+  performance_data.output_chunk_count = output_table->chunk_count();
+  performance_data.estimated_output_bytes = output_table->memory_usage();
+
+  // The output shares the segments of the per-chunk results, which are reserved already if the root reserves its output
+  // while building it.
+  const auto memory_tracker = current_query_memory_tracker();
+  if (memory_tracker && !root->_reserves_output_memory()) {
+    memory_tracker->reserve(performance_data.estimated_output_bytes);
+  }
+}
+
+void Pipeline::execute(const Sink& sink) {
+  const auto source_table = _execute_source();
+  const auto chunk_count = source_table->chunk_count();
+
+  auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto source_chunk_id = ChunkID{0}; source_chunk_id < chunk_count; ++source_chunk_id) {
+    jobs.push_back(std::make_shared<JobTask>([&, source_chunk_id] {
+      // The first operator reads the chunk from the source's output, all others read the single chunk of the
+      // intermediate result of their predecessor.
+      // Intermediate results are dropped once the next operator consumed them. Thus, the memory that their operator
+      // reserved for them is released again.
+      const auto memory_tracker = current_query_memory_tracker();
+      auto intermediate = source_table;
+      auto chunk_id = source_chunk_id;
+      auto intermediate_is_reserved = false;
+      for (const auto& op : _operators) {
+        const auto output = op->execute_chunk(intermediate, chunk_id);
+        if (intermediate_is_reserved && output != intermediate) memory_tracker->release(intermediate->memory_usage());
+        intermediate = output;
+        intermediate_is_reserved = memory_tracker && op->_reserves_output_memory();
+        chunk_id = ChunkID{0};
+      }
+      sink(source_chunk_id, intermediate);
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+std::shared_ptr<const Table> Pipeline::_execute_source() {
+  if (!_source->performance_data().executed) {
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(_source));
+  }
+  return _source->get_output();
+}
+
+const std::shared_ptr<AbstractOperator>& Pipeline::source() const { return _source; }
+
+const std::vector<std::shared_ptr<AbstractOperator>>& Pipeline::operators() const { return _operators; }
+
+}  // namespace opossum
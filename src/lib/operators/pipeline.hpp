@@ -0,0 +1,49 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+// Executes a chain of pipelineable operators (see AbstractOperator) chunk at a time. Each chunk of the source's output
+// is pushed through all operators of the chain before the next one is processed. Thus, intermediate results only ever
+// exist for a single chunk and stay cache-resident instead of being materialized as full tables.
+//
+// The chain starts at the last operator (the root) and follows the left inputs as long as the operators are
+// pipelineable. The first operator that is not pipelineable is the source. It is executed in the regular way unless it
+// was executed before. Chunks are processed by one job each, so that the CurrentScheduler can run them in parallel.
+class Pipeline : private Noncopyable {
+ public:
+  // Receives the result of the root operator for a single chunk of the source, as a table holding one chunk. Sinks
+  // may be called concurrently and in any order.
+  using Sink = std::function<void(const ChunkID source_chunk_id, const std::shared_ptr<const Table>& output)>;
+
+  explicit Pipeline(const std::shared_ptr<AbstractOperator>& root);
+
+  // Executes the pipeline and materializes the output of the root operator, which is afterwards available via its
+  // get_output. The outputs of the other operators of the chain are never created.
+  void execute();
+
+  // Executes the pipeline and streams the results to the sink instead of materializing them.
+  void execute(const Sink& sink);
+
+  const std::shared_ptr<AbstractOperator>& source() const;
+
+  // The pipelined operators, starting with the consumer of the source and ending with the root.
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+ protected:
+  // Executes the source (and everything below it) unless this already happened, and returns its output.
+  std::shared_ptr<const Table> _execute_source();
+
+  std::shared_ptr<AbstractOperator> _source;
+  std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+}  // namespace opossum
@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include <boost/lexical_cast.hpp>
+
 #include "operators/table_wrapper.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/table.hpp"
@@ -22,6 +24,11 @@ void Print::print(std::shared_ptr<const Table>& table, std::ostream& out) {
   Print(table_wrapper, out).execute();
 }
 
+const std::string& Print::name() const {
+  static const auto name = std::string{"Print"};
+  return name;
+}
+
 std::shared_ptr<const Table> Print::_on_execute() {
   auto widths = _column_string_widths(8, 20, _left_input_table());
 
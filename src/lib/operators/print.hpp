@@ -18,6 +18,8 @@ class Print : public AbstractOperator {
 
   static void print(std::shared_ptr<const Table>& table, std::ostream& out = std::cout);
 
+  const std::string& name() const override;
+
  protected:
   std::vector<uint16_t> _column_string_widths(uint16_t min, uint16_t max,
                                               const std::shared_ptr<const Table>& table) const;
@@ -0,0 +1,287 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "index_scan.hpp"
+#include "memory/query_arena.hpp"
+#include "memory/query_memory_tracker.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/segment_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/base_table_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "table_scan_impl.hpp"
+
+namespace opossum {
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+const std::string& TableScan::name() const {
+  static const auto name = std::string{"TableScan"};
+  return name;
+}
+
+std::string TableScan::description() const {
+  auto stream = std::stringstream{};
+  stream << name() << " (column #" << _column_id << " " << _scan_type << " " << _search_value << ")";
+  return stream.str();
+}
+
+bool TableScan::is_pipelineable() const { return true; }
+
+bool TableScan::used_table_index() const { return _used_table_index; }
+
+std::shared_ptr<const Table> TableScan::execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                      const ChunkID chunk_id) const {
+  auto output_table = _create_output_table_definition(*input_table);
+  const auto impl = _create_impl(*input_table);
+
+  const auto chunk = input_table->get_chunk(chunk_id);
+  auto matches = std::vector<ChunkOffset>{};
+  if (_can_be_pruned(*chunk)) {
+    // No row can match, the output chunk stays empty.
+  } else if (const auto index = _find_index(*chunk)) {
+    IndexScan::scan_index(*index, _scan_type, _search_value, matches);
+  } else {
+    impl->scan_segment(*chunk->get_segment(_column_id), 0, chunk->size(), matches);
+  }
+  output_table->emplace_chunk(create_output_chunk(input_table, chunk_id, matches));
+
+  return output_table;
+}
+
+bool TableScan::_reserves_output_memory() const { return true; }
+
+std::shared_ptr<Table> TableScan::_create_output_table_definition(const Table& input_table) const {
+  const auto column_count = input_table.column_count();
+  Assert(_column_id < column_count, "Scanned column does not exist");
+
+  auto output_table = make_shared_intermediate<Table>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                        input_table.column_is_nullable(column_id));
+  }
+  return output_table;
+}
+
+std::shared_ptr<const BaseTableScanImpl> TableScan::_create_impl(const Table& input_table) const {
+  auto impl = std::shared_ptr<const BaseTableScanImpl>{};
+  resolve_data_type(input_table.column_type(_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    impl = std::make_shared<TableScanImpl<ColumnDataType>>(_scan_type, _search_value);
+  });
+  return impl;
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  auto output_table = _create_output_table_definition(*input_table);
+
+  const auto table_index = _find_table_index(*input_table);
+  _used_table_index = table_index != nullptr;
+  if (table_index) {
+    _scan_table_index(input_table, *table_index, *output_table);
+  } else {
+    _scan_chunks(input_table, *output_table);
+  }
+
+  // Consumers expect every chunk to hold one segment per column, even if no row matched at all.
+  if (output_table->row_count() == 0) {
+    output_table->emplace_chunk(create_output_chunk(input_table, ChunkID{0}, {}));
+  }
+
+  return output_table;
+}
+
+void TableScan::_scan_chunks(const std::shared_ptr<const Table>& input_table, Table& output_table) const {
+  const auto impl = _create_impl(*input_table);
+
+  // Each chunk is split into morsels of at most MORSEL_SIZE rows that are scanned by independent jobs. Once all morsels
+  // of a chunk are done, another job stitches their matches together in order and creates the output chunk. Chunks with
+  // a usable index are answered by a single lookup instead.
+  const auto chunk_count = input_table->chunk_count();
+  auto morsel_matches = std::vector<std::vector<std::vector<ChunkOffset>>>(chunk_count);
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    if (chunk_size == 0 || _can_be_pruned(*chunk)) continue;
+
+    const auto segment = chunk->get_segment(_column_id);
+    const auto index = _find_index(*chunk);
+    const auto morsel_count = index ? ChunkOffset{1} : (chunk_size + MORSEL_SIZE - 1) / MORSEL_SIZE;
+    auto& chunk_matches = morsel_matches[chunk_id];
+    chunk_matches.resize(morsel_count);
+
+    const auto output_job = std::make_shared<JobTask>([&input_table, &chunk_matches, &output_chunks, chunk_id] {
+      auto& matches = chunk_matches.front();
+      const auto morsel_count = chunk_matches.size();
+      for (auto morsel_index = size_t{1}; morsel_index < morsel_count; ++morsel_index) {
+        matches.insert(matches.end(), chunk_matches[morsel_index].cbegin(), chunk_matches[morsel_index].cend());
+      }
+      if (matches.empty()) return;
+
+      output_chunks[chunk_id] = create_output_chunk(input_table, chunk_id, matches);
+    });
+
+    for (auto morsel_index = ChunkOffset{0}; morsel_index < morsel_count; ++morsel_index) {
+      const auto begin_offset = morsel_index * MORSEL_SIZE;
+      const auto end_offset = std::min(begin_offset + MORSEL_SIZE, chunk_size);
+      auto& matches = chunk_matches[morsel_index];
+
+      const auto morsel_job = std::make_shared<JobTask>([&, segment, index, begin_offset, end_offset] {
+        if (index) {
+          IndexScan::scan_index(*index, _scan_type, _search_value, matches);
+          return;
+        }
+        impl->scan_segment(*segment, begin_offset, end_offset, matches);
+      });
+      morsel_job->set_as_predecessor_of(output_job);
+      jobs.push_back(morsel_job);
+    }
+    jobs.push_back(output_job);
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& output_chunk : output_chunks) {
+    if (output_chunk) output_table.emplace_chunk(output_chunk);
+  }
+}
+
+std::shared_ptr<const BaseTableIndex> TableScan::_find_table_index(const Table& input_table) const {
+  const auto table_index = input_table.get_index(_column_id);
+  if (!table_index || !_can_use_index()) return nullptr;
+
+  // A table index returns the matches of all chunks at once, so it only pays off if the predicate is selective on the
+  // table as a whole.
+  auto estimated_match_count = 0.0;
+  const auto chunk_count = input_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table.get_chunk(chunk_id);
+    const auto selectivity = _estimate_selectivity(*chunk);
+    if (!selectivity) {
+      if (_scan_type != ScanType::OpEquals) return nullptr;
+      continue;
+    }
+    estimated_match_count += *selectivity * chunk->size();
+  }
+  if (estimated_match_count > INDEX_SELECTIVITY_THRESHOLD * input_table.row_count()) return nullptr;
+
+  return table_index;
+}
+
+void TableScan::_scan_table_index(const std::shared_ptr<const Table>& input_table, const BaseTableIndex& table_index,
+                                  Table& output_table) const {
+  const auto pos_list = table_index.lookup(_scan_type, _search_value);
+
+  // The matches are ordered by RowID, so those of each chunk are contiguous.
+  auto matches = std::vector<ChunkOffset>{};
+  for (auto begin = pos_list.cbegin(); begin != pos_list.cend();) {
+    const auto chunk_id = begin->chunk_id;
+    matches.clear();
+    auto end = begin;
+    for (; end != pos_list.cend() && end->chunk_id == chunk_id; ++end) {
+      matches.push_back(end->chunk_offset);
+    }
+    output_table.emplace_chunk(create_output_chunk(input_table, chunk_id, matches));
+    begin = end;
+  }
+}
+
+std::shared_ptr<const BaseIndex> TableScan::_find_index(const Chunk& chunk) const {
+  const auto indexes = chunk.get_indexes(std::vector<ColumnID>{_column_id});
+  if (indexes.empty() || !_can_use_index()) return nullptr;
+
+  const auto selectivity = _estimate_selectivity(chunk);
+  if (!selectivity && _scan_type != ScanType::OpEquals) return nullptr;
+  if (selectivity && *selectivity > INDEX_SELECTIVITY_THRESHOLD) return nullptr;
+
+  return indexes.front();
+}
+
+bool TableScan::_can_use_index() const { return !is_null_scan_type(_scan_type) && !variant_is_null(_search_value); }
+
+std::optional<float> TableScan::_estimate_selectivity(const Chunk& chunk) const {
+  const auto& statistics = chunk.statistics();
+  if (statistics.empty() || !statistics[_column_id]) return std::nullopt;
+  return statistics[_column_id]->estimate_selectivity(_scan_type, _search_value);
+}
+
+bool TableScan::_can_be_pruned(const Chunk& chunk) const {
+  const auto& statistics = chunk.statistics();
+  if (statistics.empty() || !statistics[_column_id]) return false;
+  return statistics[_column_id]->does_not_contain(_scan_type, _search_value);
+}
+
+std::shared_ptr<Chunk> TableScan::create_output_chunk(const std::shared_ptr<const Table>& input_table,
+                                                      const ChunkID chunk_id, const std::vector<ChunkOffset>& matches) {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  const auto column_count = input_table->column_count();
+  const auto match_count = matches.size();
+
+  // Position lists are shared between all output segments that reference the same rows. For data segments, these are
+  // the rows of the input chunk. Input ReferenceSegments usually share their position list as well, so their matches
+  // are resolved against the referenced table only once per distinct position list.
+  auto data_pos_list = std::shared_ptr<PosList>{};
+  auto resolved_pos_lists = std::unordered_map<const PosList*, std::shared_ptr<PosList>>{};
+
+  // Each position list is reserved before it is allocated (see AbstractOperator::_reserves_output_memory).
+  const auto memory_tracker = current_query_memory_tracker();
+  const auto create_pos_list = [&] {
+    if (memory_tracker) memory_tracker->reserve(match_count * sizeof(RowID));
+    auto pos_list = make_shared_intermediate<PosList>();
+    pos_list->reserve(match_count);
+    return pos_list;
+  };
+
+  auto output_chunk = make_shared_intermediate<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = input_chunk->get_segment(column_id);
+
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      const auto& input_pos_list = reference_segment->pos_list();
+      auto& pos_list = resolved_pos_lists[input_pos_list.get()];
+      if (!pos_list) {
+        pos_list = create_pos_list();
+        for (const auto chunk_offset : matches) {
+          pos_list->push_back((*input_pos_list)[chunk_offset]);
+        }
+      }
+      output_chunk->add_segment(make_shared_intermediate<ReferenceSegment>(
+          reference_segment->referenced_table(), reference_segment->referenced_column_id(), pos_list));
+      continue;
+    }
+
+    if (!data_pos_list) {
+      data_pos_list = create_pos_list();
+      for (const auto chunk_offset : matches) {
+        data_pos_list->push_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+    output_chunk->add_segment(make_shared_intermediate<ReferenceSegment>(input_table, column_id, data_pos_list));
+  }
+
+  return output_chunk;
+}
+
+}  // namespace opossum
@@ -12,36 +12,103 @@
 
 namespace opossum {
 
+class BaseIndex;
+class BaseTableIndex;
 class BaseTableScanImpl;
+class Chunk;
 class Table;
 
+// Operator that filters its input table by comparing the values of one column to a search value. The output consists
+// of ReferenceSegments. If the input itself consists of ReferenceSegments (e.g., because it is the output of another
+// TableScan), the output references the original table instead of the input table. Thus, chained scans never build
+// nested references.
+//
+// The scan is split into morsels, i.e., ranges of at most MORSEL_SIZE rows within a chunk, that are executed as
+// independent jobs by the CurrentScheduler. The output chunks are in the order of the input chunks.
+//
+// If a chunk of the input has an index (see Chunk::create_index) on the scanned column, the matches are looked up in
+// the index instead of scanning the segment, provided that the predicate is estimated to be selective on that chunk.
+// The estimate is based on the chunk's segment statistics (see BaseSegmentStatistics). For chunks without statistics,
+// only point predicates are considered selective. Likewise, a table index (see StorageManager::create_index) on the
+// scanned column answers selective predicates with a single lookup for all chunks. Indexes do not contain NULL values,
+// so OpIsNull and OpIsNotNull always scan the segments.
+//
+// Chunks whose statistics show that no row can match, e.g., because the search value is outside of the segment's
+// minimum and maximum, are skipped altogether (min/max pruning).
 class TableScan : public AbstractOperator {
  public:
+  static constexpr auto MORSEL_SIZE = ChunkOffset{1u << 16u};
+
+  // Indexes are used if at most this fraction of the rows is estimated to match. For more matches, collecting and
+  // sorting the offsets from the index is more expensive than a sequential scan.
+  static constexpr auto INDEX_SELECTIVITY_THRESHOLD = 0.1f;
+
   TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
-            const AllTypeVariant search_value) {
-    // TODO(student) implement it in a source file and change this to a declaration.
-  }
+            const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+
+  ScanType scan_type() const;
+
+  const AllTypeVariant& search_value() const;
 
-  ColumnID column_id() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    return ColumnID{};
-  }
+  const std::string& name() const override;
 
-  ScanType scan_type() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  std::string description() const override;
 
-  const AllTypeVariant& search_value() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  bool is_pipelineable() const override;
+
+  // Returns whether the last execution answered the predicate with a table index instead of scanning the chunks.
+  bool used_table_index() const;
+
+  std::shared_ptr<const Table> execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                             const ChunkID chunk_id) const override;
+
+  // Creates the output chunk holding the matching rows of the given input chunk as ReferenceSegments. matches has to be
+  // sorted. Other operators that filter rows, such as Validate, use this as well.
+  static std::shared_ptr<Chunk> create_output_chunk(const std::shared_ptr<const Table>& input_table,
+                                                    const ChunkID chunk_id, const std::vector<ChunkOffset>& matches);
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  std::shared_ptr<const Table> _on_execute() override;
+
+  bool _reserves_output_memory() const override;
+
+  // Creates an empty table with the columns of the input table.
+  std::shared_ptr<Table> _create_output_table_definition(const Table& input_table) const;
+
+  // Creates the scan implementation for the data type of the scanned column.
+  std::shared_ptr<const BaseTableScanImpl> _create_impl(const Table& input_table) const;
+
+  // Scans the input chunk by chunk and appends the output chunks to output_table.
+  void _scan_chunks(const std::shared_ptr<const Table>& input_table, Table& output_table) const;
+
+  // Returns a table index on the scanned column that should be used for the predicate, or nullptr if there is none.
+  std::shared_ptr<const BaseTableIndex> _find_table_index(const Table& input_table) const;
+
+  // Looks up the matches of all chunks in the table index and appends the output chunks to output_table.
+  void _scan_table_index(const std::shared_ptr<const Table>& input_table, const BaseTableIndex& table_index,
+                         Table& output_table) const;
+
+  // Returns an index on the scanned column of the chunk that should be used for the predicate, or nullptr if there is
+  // none.
+  std::shared_ptr<const BaseIndex> _find_index(const Chunk& chunk) const;
+
+  // Returns whether indexes can answer the predicate, which is not the case for NULL scans and NULL search values.
+  bool _can_use_index() const;
+
+  // Estimates the fraction of the chunk's rows that satisfy the predicate. Returns nullopt if the chunk has no
+  // statistics for the scanned column.
+  std::optional<float> _estimate_selectivity(const Chunk& chunk) const;
+
+  // Returns whether the chunk's statistics for the scanned column rule out any match.
+  bool _can_be_pruned(const Chunk& chunk) const;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+
+  bool _used_table_index{false};
 };
 
 }  // namespace opossum
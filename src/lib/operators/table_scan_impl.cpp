@@ -0,0 +1,509 @@
+#include "table_scan_impl.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Passes the comparison functor for the scan type on to a generic lambda. Resolving the scan type once per segment
+// keeps the switch out of the scan loops.
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return func(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return func(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return func(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return func(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return func(std::greater_equal<>{});
+    case ScanType::OpIsNull:
+    case ScanType::OpIsNotNull:
+      break;
+  }
+  Fail("Scan type is not a comparison");
+}
+
+// Calls func(segment_offset, output_offset) for every position that has to be evaluated. Without positions, these are
+// all offsets in the range and both offsets are identical.
+template <typename Range, typename Positions, typename Functor>
+void for_each_position(const Range range, const Positions* positions, const Functor& func) {
+  if (!positions) {
+    for (auto offset = range.begin; offset < range.end; ++offset) {
+      func(offset, offset);
+    }
+    return;
+  }
+
+  const auto& referenced_offsets = positions->referenced_offsets;
+  const auto& output_offsets = positions->output_offsets;
+  const auto position_count = referenced_offsets.size();
+  for (auto index = size_t{0}; index < position_count; ++index) {
+    func(referenced_offsets[index], output_offsets[index]);
+  }
+}
+
+// Appends the offsets for which predicate(segment_offset) holds. The output is written without a branch per row: every
+// candidate is stored and the write position only advances for matches.
+template <typename Range, typename Positions, typename Predicate>
+void emit_matches(const Range range, const Positions* positions, const Predicate& predicate,
+                  std::vector<ChunkOffset>& matches) {
+  const auto previous_match_count = matches.size();
+  const auto candidate_count = positions ? positions->referenced_offsets.size() : size_t{range.end - range.begin};
+  matches.resize(previous_match_count + candidate_count);
+
+  auto* output = matches.data() + previous_match_count;
+  auto match_count = size_t{0};
+  for_each_position(range, positions, [&](const ChunkOffset segment_offset, const ChunkOffset output_offset) {
+    output[match_count] = output_offset;
+    match_count += static_cast<size_t>(predicate(segment_offset));
+  });
+
+  matches.resize(previous_match_count + match_count);
+}
+
+// Appends all offsets in [begin, end), e.g., for a run or block in which all rows match.
+void emit_range(const ChunkOffset begin, const ChunkOffset end, std::vector<ChunkOffset>& matches) {
+  const auto previous_match_count = matches.size();
+  matches.resize(previous_match_count + (end - begin));
+  std::iota(matches.begin() + static_cast<std::ptrdiff_t>(previous_match_count), matches.end(), begin);
+}
+
+// Appends the offsets of the rows that are NULL (OpIsNull) or not NULL (OpIsNotNull) for segments whose NULL rows are
+// flagged in a NullBitmap. Segments without a bitmap cannot hold NULL values.
+template <typename Range, typename Positions>
+void scan_null_bitmap(const std::optional<NullBitmap>& null_bitmap, const ScanType scan_type, const Range range,
+                      const Positions* positions, std::vector<ChunkOffset>& matches) {
+  const auto match_null = scan_type == ScanType::OpIsNull;
+  if (!null_bitmap) {
+    if (!match_null) emit_matches(range, positions, [](const ChunkOffset) { return true; }, matches);
+    return;
+  }
+
+  emit_matches(
+      range, positions, [&](const ChunkOffset segment_offset) { return (*null_bitmap)[segment_offset] == match_null; },
+      matches);
+}
+
+// A predicate on the offsets of a frame-of-reference block: an offset matches if it lies within [first, last], or, if
+// negate is set, outside of it. Comparing in the offset domain avoids adding the block minimum to every row.
+template <typename OffsetType>
+struct OffsetPredicate {
+  OffsetType first;
+  OffsetType last;
+  bool negate;
+
+  bool matches_all(const OffsetType max_offset) const { return !negate && first == 0 && last == max_offset; }
+
+  bool matches_none(const OffsetType max_offset) const { return negate && first == 0 && last == max_offset; }
+
+  bool operator()(const OffsetType offset) const {
+    return (static_cast<OffsetType>(offset - first) <= static_cast<OffsetType>(last - first)) != negate;
+  }
+};
+
+// Translates `value <scan_type> search_value` into a predicate on the offsets of a block with the given minimum. All
+// offsets of the block are at most max_offset.
+template <typename T, typename OffsetType>
+OffsetPredicate<OffsetType> translate_to_offset_domain(const ScanType scan_type, const T search_value,
+                                                       const T block_minimum, const OffsetType max_offset) {
+  const auto all = OffsetPredicate<OffsetType>{0, max_offset, false};
+  const auto none = OffsetPredicate<OffsetType>{0, max_offset, true};
+
+  // Every value of the block is greater than the search value.
+  if (search_value < block_minimum) {
+    const auto values_greater = scan_type == ScanType::OpNotEquals || scan_type == ScanType::OpGreaterThan ||
+                                scan_type == ScanType::OpGreaterThanEquals;
+    return values_greater ? all : none;
+  }
+
+  const auto search_offset = static_cast<OffsetType>(static_cast<OffsetType>(search_value) - block_minimum);
+  const auto beyond_block = search_offset > max_offset;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return beyond_block ? none : OffsetPredicate<OffsetType>{search_offset, search_offset, false};
+    case ScanType::OpNotEquals:
+      return beyond_block ? all : OffsetPredicate<OffsetType>{search_offset, search_offset, true};
+    case ScanType::OpLessThan:
+      if (search_offset == 0) return none;
+      return beyond_block ? all : OffsetPredicate<OffsetType>{0, static_cast<OffsetType>(search_offset - 1), false};
+    case ScanType::OpLessThanEquals:
+      return beyond_block ? all : OffsetPredicate<OffsetType>{0, search_offset, false};
+    case ScanType::OpGreaterThan:
+      return search_offset >= max_offset
+                 ? none
+                 : OffsetPredicate<OffsetType>{static_cast<OffsetType>(search_offset + 1), max_offset, false};
+    case ScanType::OpGreaterThanEquals:
+      return beyond_block ? none : OffsetPredicate<OffsetType>{search_offset, max_offset, false};
+    case ScanType::OpIsNull:
+    case ScanType::OpIsNotNull:
+      break;
+  }
+  Fail("Scan type is not a comparison");
+}
+
+// Scans a FrameOfReferenceSegment. This is a free function instead of a member of TableScanImpl because the segment
+// type only exists for integers, while TableScanImpl is instantiated for all data types.
+template <typename T, typename Range, typename Positions>
+void scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment, const ScanType scan_type,
+                                     const T search_value, const Range range, const Positions* positions,
+                                     std::vector<ChunkOffset>& matches) {
+  using OffsetType = typename FrameOfReferenceSegment<T>::OffsetType;
+  constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+  const auto& block_minima = segment.block_minima();
+  const auto max_offset = segment.max_offset();
+  const auto& null_bitmap = segment.null_bitmap();
+
+  if (is_null_scan_type(scan_type)) {
+    scan_null_bitmap(null_bitmap, scan_type, range, positions, matches);
+    return;
+  }
+
+  // NULL rows are stored with offset 0 and thus might satisfy the offset predicate. Instead of branching on them, the
+  // result of every row is masked with its NULL flag.
+  const auto is_null = [&](const ChunkOffset segment_offset) { return null_bitmap && (*null_bitmap)[segment_offset]; };
+
+  if (positions) {
+    auto predicates = std::vector<OffsetPredicate<OffsetType>>{};
+    predicates.reserve(block_minima.size());
+    for (const auto block_minimum : block_minima) {
+      predicates.push_back(translate_to_offset_domain(scan_type, search_value, block_minimum, max_offset));
+    }
+    emit_matches(
+        range, positions,
+        [&](const ChunkOffset segment_offset) {
+          const auto matches_offset = predicates[segment_offset / BLOCK_SIZE](segment.offset(segment_offset));
+          const auto row_is_null = is_null(segment_offset);
+          return matches_offset & !row_is_null;
+        },
+        matches);
+    return;
+  }
+
+  // The offsets are decompressed block by block into a buffer, which is then compared without further indirection.
+  auto offsets = std::vector<OffsetType>(BLOCK_SIZE);
+  for (auto block_begin = range.begin; block_begin < range.end;) {
+    const auto block_id = block_begin / BLOCK_SIZE;
+    const auto block_end = std::min((block_id + 1) * BLOCK_SIZE, range.end);
+    const auto predicate = translate_to_offset_domain(scan_type, search_value, block_minima[block_id], max_offset);
+
+    if (predicate.matches_all(max_offset) && !null_bitmap) {
+      emit_range(block_begin, block_end, matches);
+    } else if (!predicate.matches_none(max_offset)) {
+      segment.decompress_offsets(block_begin, block_end, offsets.data());
+      const auto block_range = Range{block_begin, block_end};
+      if (!null_bitmap) {
+        emit_matches(
+            block_range, static_cast<const Positions*>(nullptr),
+            [&](const ChunkOffset segment_offset) { return predicate(offsets[segment_offset - block_begin]); },
+            matches);
+      } else {
+        emit_matches(
+            block_range, static_cast<const Positions*>(nullptr),
+            [&](const ChunkOffset segment_offset) {
+              const auto matches_offset = predicate(offsets[segment_offset - block_begin]);
+              const auto row_is_null = (*null_bitmap)[segment_offset];
+              return matches_offset & !row_is_null;
+            },
+            matches);
+      }
+    }
+    block_begin = block_end;
+  }
+}
+
+}  // namespace
+
+template <typename T>
+TableScanImpl<T>::TableScanImpl(const ScanType scan_type, const AllTypeVariant& search_value)
+    : _scan_type(scan_type),
+      _search_value_is_null(variant_is_null(search_value)),
+      _search_value(_search_value_is_null || is_null_scan_type(scan_type) ? T{} : type_cast<T>(search_value)) {}
+
+template <typename T>
+void TableScanImpl<T>::scan_segment(const AbstractSegment& segment, const ChunkOffset begin_offset,
+                                    const ChunkOffset end_offset, std::vector<ChunkOffset>& matches) const {
+  DebugAssert(begin_offset <= end_offset && end_offset <= segment.size(), "Invalid offset range");
+  const auto range = OffsetRange{begin_offset, end_offset};
+
+  // Comparisons with NULL are never true.
+  if (_search_value_is_null && !is_null_scan_type(_scan_type)) return;
+
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    _scan_reference_segment(*reference_segment, range, matches);
+    return;
+  }
+
+  _scan_data_segment(segment, range, nullptr, matches);
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_data_segment(const AbstractSegment& segment, const OffsetRange range,
+                                          const ReferencedPositions* positions,
+                                          std::vector<ChunkOffset>& matches) const {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    _scan_value_segment(*value_segment, range, positions, matches);
+    return;
+  }
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    _scan_dictionary_segment(*dictionary_segment, range, positions, matches);
+    return;
+  }
+
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    _scan_run_length_segment(*run_length_segment, range, positions, matches);
+    return;
+  }
+
+  if constexpr (is_frame_of_reference_supported_v<T>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      scan_frame_of_reference_segment(*frame_of_reference_segment, _scan_type, _search_value, range, positions,
+                                      matches);
+      return;
+    }
+  }
+
+  Fail("Segment type cannot be scanned. References have to point to data segments.");
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_value_segment(const ValueSegment<T>& segment, const OffsetRange range,
+                                           const ReferencedPositions* positions,
+                                           std::vector<ChunkOffset>& matches) const {
+  const auto& values = segment.values();
+  const auto& null_bitmap = segment.null_bitmap();
+  const auto& search_value = _search_value;
+
+  if (is_null_scan_type(_scan_type)) {
+    scan_null_bitmap(null_bitmap, _scan_type, range, positions, matches);
+    return;
+  }
+
+  with_comparator(_scan_type, [&](const auto& compare) {
+    if (!null_bitmap) {
+      emit_matches(
+          range, positions,
+          [&](const ChunkOffset segment_offset) { return compare(values[segment_offset], search_value); }, matches);
+      return;
+    }
+
+    // NULL rows hold T{}, which might satisfy the comparison. The result is masked with the NULL flag instead of
+    // branching on it.
+    emit_matches(
+        range, positions,
+        [&](const ChunkOffset segment_offset) {
+          const auto value_matches = compare(values[segment_offset], search_value);
+          const auto row_is_null = (*null_bitmap)[segment_offset];
+          return value_matches & !row_is_null;
+        },
+        matches);
+  });
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_dictionary_segment(const DictionarySegment<T>& segment, const OffsetRange range,
+                                                const ReferencedPositions* positions,
+                                                std::vector<ChunkOffset>& matches) const {
+  // The dictionary is sorted, so every predicate translates into a range of value ids [begin, end). For
+  // OpNotEquals, the matching value ids are those outside of the range. This way, the search value is compared to the
+  // dictionary only once per segment and the rows are compared as integers. NULL rows hold the null value id, which
+  // comes after the dictionary. It is thus outside of the range of every comparison, but has to be masked for
+  // OpNotEquals.
+  const auto unique_values_count = ValueID{segment.unique_values_count()};
+  const auto null_value_id = segment.null_value_id();
+  const auto nullable = segment.is_nullable();
+  auto lower_bound = segment.lower_bound(_search_value);
+  if (lower_bound == INVALID_VALUE_ID) lower_bound = unique_values_count;
+  auto upper_bound = segment.upper_bound(_search_value);
+  if (upper_bound == INVALID_VALUE_ID) upper_bound = unique_values_count;
+
+  auto begin = ValueID{0};
+  auto end = unique_values_count;
+  auto negate = false;
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      begin = lower_bound;
+      end = upper_bound;
+      break;
+    case ScanType::OpNotEquals:
+      begin = lower_bound;
+      end = upper_bound;
+      negate = true;
+      break;
+    case ScanType::OpLessThan:
+      end = lower_bound;
+      break;
+    case ScanType::OpLessThanEquals:
+      end = upper_bound;
+      break;
+    case ScanType::OpGreaterThan:
+      begin = upper_bound;
+      break;
+    case ScanType::OpGreaterThanEquals:
+      begin = lower_bound;
+      break;
+    case ScanType::OpIsNull:
+      begin = null_value_id;
+      end = ValueID{null_value_id + 1};
+      break;
+    case ScanType::OpIsNotNull:
+      break;
+  }
+
+  const auto range_size = static_cast<uint32_t>(end - begin);
+
+  // Shortcuts for predicates that match either no or all rows of the segment. If the segment is nullable, NULL rows
+  // might not match, so only the kernel can tell.
+  const auto matches_nothing = (negate ? range_size == unique_values_count : range_size == 0) ||
+                               (_scan_type == ScanType::OpIsNull && !nullable);
+  if (matches_nothing) return;
+
+  const auto matches_everything = !nullable && (negate ? range_size == 0 : range_size == unique_values_count);
+  if (matches_everything) {
+    emit_matches(range, positions, [](const ChunkOffset) { return true; }, matches);
+    return;
+  }
+
+  resolve_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    // A value id is within [begin, end) iff value_id - begin < end - begin when computed unsigned.
+    if (!negate) {
+      emit_matches(
+          range, positions,
+          [&](const ChunkOffset segment_offset) {
+            return static_cast<uint32_t>(value_ids[segment_offset] - begin) < range_size;
+          },
+          matches);
+      return;
+    }
+
+    emit_matches(
+        range, positions,
+        [&](const ChunkOffset segment_offset) {
+          const auto value_id = static_cast<uint32_t>(value_ids[segment_offset]);
+          const auto in_range = static_cast<uint32_t>(value_id - begin) < range_size;
+          return !in_range & (value_id != null_value_id);
+        },
+        matches);
+  });
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_run_length_segment(const RunLengthSegment<T>& segment, const OffsetRange range,
+                                                const ReferencedPositions* positions,
+                                                std::vector<ChunkOffset>& matches) const {
+  const auto& values = segment.values();
+  const auto& end_positions = segment.end_positions();
+  const auto& search_value = _search_value;
+
+  // Passes a predicate on the run index to func. NULL runs never satisfy a comparison.
+  const auto with_run_predicate = [&](const auto& func) {
+    if (is_null_scan_type(_scan_type)) {
+      const auto match_null = _scan_type == ScanType::OpIsNull;
+      func([&](const size_t run_index) { return segment.is_null_run(run_index) == match_null; });
+      return;
+    }
+    with_comparator(_scan_type, [&](const auto& compare) {
+      func([&](const size_t run_index) {
+        return !segment.is_null_run(run_index) && compare(values[run_index], search_value);
+      });
+    });
+  };
+
+  if (positions) {
+    // Referenced offsets can point anywhere into the segment. Thus, all runs are evaluated first and each position
+    // only looks up the result of its run.
+    auto run_matches = std::vector<uint8_t>(values.size());
+    with_run_predicate([&](const auto& run_predicate) {
+      for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+        run_matches[run_index] = run_predicate(run_index);
+      }
+    });
+    emit_matches(
+        range, positions,
+        [&](const ChunkOffset segment_offset) { return run_matches[segment.run_index(segment_offset)] != 0; },
+        matches);
+    return;
+  }
+
+  if (range.begin == range.end) return;
+
+  with_run_predicate([&](const auto& run_predicate) {
+    // The first and the last run may only partially overlap with the scanned range.
+    auto run_index = segment.run_index(range.begin);
+    for (auto run_begin = range.begin; run_begin < range.end; ++run_index) {
+      const auto run_end = std::min(static_cast<ChunkOffset>(end_positions[run_index] + 1), range.end);
+      if (run_predicate(run_index)) {
+        emit_range(run_begin, run_end, matches);
+      }
+      run_begin = run_end;
+    }
+  });
+}
+
+template <typename T>
+void TableScanImpl<T>::_scan_reference_segment(const ReferenceSegment& segment, const OffsetRange range,
+                                               std::vector<ChunkOffset>& matches) const {
+  const auto& pos_list = *segment.pos_list();
+  const auto& referenced_table = *segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+
+  // Group the positions by the chunk they reference. Position lists produced by scans are ordered by chunk, so looking
+  // up the group in the map is only needed whenever the referenced chunk changes.
+  auto groups = std::vector<ReferencedPositions>{};
+  auto group_index_by_chunk_id = std::unordered_map<ChunkID, size_t>{};
+  ReferencedPositions* current_group = nullptr;
+
+  for (auto output_offset = range.begin; output_offset < range.end; ++output_offset) {
+    const auto& row_id = pos_list[output_offset];
+    if (!current_group || current_group->chunk_id != row_id.chunk_id) {
+      const auto [group_iterator, inserted] = group_index_by_chunk_id.try_emplace(row_id.chunk_id, groups.size());
+      if (inserted) {
+        groups.push_back(ReferencedPositions{row_id.chunk_id, {}, {}});
+      }
+      current_group = &groups[group_iterator->second];
+    }
+    current_group->referenced_offsets.push_back(row_id.chunk_offset);
+    current_group->output_offsets.push_back(output_offset);
+  }
+
+  const auto previous_match_count = matches.size();
+  for (const auto& group : groups) {
+    const auto referenced_segment = referenced_table.get_chunk(group.chunk_id)->get_segment(referenced_column_id);
+    _scan_data_segment(*referenced_segment, OffsetRange{}, &group, matches);
+  }
+
+  // Groups are scanned one after another. If the position list jumps back and forth between chunks, the emitted
+  // offsets have to be brought back into the order of the ReferenceSegment.
+  const auto new_matches_begin = matches.begin() + static_cast<std::ptrdiff_t>(previous_match_count);
+  if (groups.size() > 1 && !std::is_sorted(new_matches_begin, matches.end())) {
+    std::sort(new_matches_begin, matches.end());
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableScanImpl);
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+class ReferenceSegment;
+
+template <typename T>
+class DictionarySegment;
+
+template <typename T>
+class RunLengthSegment;
+
+template <typename T>
+class ValueSegment;
+
+// BaseTableScanImpl evaluates the predicate of a TableScan on single segments. It is the non-templated interface of
+// TableScanImpl, which TableScan creates once per execution after resolving the data type of the scanned column.
+class BaseTableScanImpl : private Noncopyable {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  // Appends the offsets of all rows in [begin_offset, end_offset) of the segment that satisfy the predicate to matches,
+  // in ascending order. For ReferenceSegments, the offsets are positions within the ReferenceSegment, not within the
+  // referenced segments. Scanning disjoint ranges of the same segment concurrently is safe. NULL values never satisfy a
+  // comparison, so they only match OpIsNull.
+  virtual void scan_segment(const AbstractSegment& segment, const ChunkOffset begin_offset,
+                            const ChunkOffset end_offset, std::vector<ChunkOffset>& matches) const = 0;
+};
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const ScanType scan_type, const AllTypeVariant& search_value);
+
+  void scan_segment(const AbstractSegment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                    std::vector<ChunkOffset>& matches) const override;
+
+ protected:
+  // Positions of a ReferenceSegment that all point into the same chunk of the referenced table. referenced_offsets are
+  // the offsets within the referenced chunk, output_offsets the corresponding offsets within the ReferenceSegment.
+  struct ReferencedPositions {
+    ChunkID chunk_id;
+    std::vector<ChunkOffset> referenced_offsets;
+    std::vector<ChunkOffset> output_offsets;
+  };
+
+  // Range of offsets within a data segment that is scanned if no ReferencedPositions are given.
+  struct OffsetRange {
+    ChunkOffset begin;
+    ChunkOffset end;
+  };
+
+  // Scans a ValueSegment, DictionarySegment, RunLengthSegment, or FrameOfReferenceSegment. If positions is set, only
+  // the referenced offsets are evaluated and the corresponding output offsets are emitted. Otherwise, all offsets in
+  // range are scanned.
+  void _scan_data_segment(const AbstractSegment& segment, const OffsetRange range, const ReferencedPositions* positions,
+                          std::vector<ChunkOffset>& matches) const;
+
+  void _scan_value_segment(const ValueSegment<T>& segment, const OffsetRange range,
+                           const ReferencedPositions* positions, std::vector<ChunkOffset>& matches) const;
+
+  void _scan_dictionary_segment(const DictionarySegment<T>& segment, const OffsetRange range,
+                                const ReferencedPositions* positions, std::vector<ChunkOffset>& matches) const;
+
+  // Evaluates the predicate once per run instead of once per row. Matching runs are emitted as offset ranges.
+  void _scan_run_length_segment(const RunLengthSegment<T>& segment, const OffsetRange range,
+                                const ReferencedPositions* positions, std::vector<ChunkOffset>& matches) const;
+
+  // Resolves the indirection of a ReferenceSegment once by grouping its positions by referenced chunk. Each group is
+  // then scanned with the kernels of the referenced data segment.
+  void _scan_reference_segment(const ReferenceSegment& segment, const OffsetRange range,
+                               std::vector<ChunkOffset>& matches) const;
+
+  const ScanType _scan_type;
+  const bool _search_value_is_null;
+  // T{} if the search value is NULL or ignored by the scan type.
+  const T _search_value;
+};
+
+}  // namespace opossum
@@ -8,5 +8,13 @@ namespace opossum {
 
 TableWrapper::TableWrapper(const std::shared_ptr<const Table>& table) : _table(table) {}
 
+const std::string& TableWrapper::name() const {
+  static const auto name = std::string{"TableWrapper"};
+  return name;
+}
+
 std::shared_ptr<const Table> TableWrapper::_on_execute() { return _table; }
+
+bool TableWrapper::_outputs_existing_table() const { return true; }
+
 }  // namespace opossum
@@ -16,9 +16,13 @@ class TableWrapper : public AbstractOperator {
  public:
   explicit TableWrapper(const std::shared_ptr<const Table>& table);
 
+  const std::string& name() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  bool _outputs_existing_table() const override;
+
   // Table to retrieve
   const std::shared_ptr<const Table> _table;
 };
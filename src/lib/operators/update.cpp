@@ -0,0 +1,56 @@
+#include "update.hpp"
+
+#include <memory>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "delete.hpp"
+#include "insert.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Update::Update(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+               const std::shared_ptr<const AbstractOperator>& values_to_insert)
+    : AbstractOperator(rows_to_update, values_to_insert), _target_table_name(target_table_name) {}
+
+const std::string& Update::target_table_name() const { return _target_table_name; }
+
+const std::string& Update::name() const {
+  static const auto name = std::string{"Update"};
+  return name;
+}
+
+std::string Update::description() const { return name() + " (" + _target_table_name + ")"; }
+
+std::shared_ptr<const Table> Update::_on_execute() {
+  Assert(_transaction_context, "Update needs a transaction context");
+  const auto rows_to_update = _left_input_table();
+  Assert(rows_to_update->row_count() == _right_input_table()->row_count(), "Update needs one new row per updated row");
+
+  const auto target_table = StorageManager::get().get_table(_target_table_name);
+  const auto chunk_count = rows_to_update->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = rows_to_update->get_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    Assert(segment && segment->referenced_table() == target_table, "Updated rows have to reference the target table");
+  }
+
+  // The sub-operators reuse our inputs, which have already been executed.
+  const auto delete_operator = std::make_shared<Delete>(_left_input);
+  delete_operator->set_transaction_context(_transaction_context);
+  delete_operator->execute();
+  if (_transaction_context->phase() == TransactionPhase::Conflicted) return nullptr;
+
+  const auto insert_operator = std::make_shared<Insert>(_target_table_name, _right_input);
+  insert_operator->set_transaction_context(_transaction_context);
+  insert_operator->execute();
+
+  return nullptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Operator that replaces rows of the table with the given name, which has to use MVCC, by new versions. The left input
+// references the rows to update (see Delete), the right input holds their new values, one full row per updated row.
+// The old versions are deleted and the new ones appended within the transaction of the operator, so other transactions
+// see either the old or the new versions. Like Delete, Update marks the transaction as conflicted if another
+// transaction deleted or is deleting one of the rows. Update has no output.
+class Update : public AbstractOperator {
+ public:
+  Update(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+         const std::shared_ptr<const AbstractOperator>& values_to_insert);
+
+  const std::string& target_table_name() const;
+
+  const std::string& name() const override;
+
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _target_table_name;
+};
+
+}  // namespace opossum
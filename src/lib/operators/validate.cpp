@@ -0,0 +1,153 @@
+#include "validate.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "memory/query_arena.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool is_visible_to(const TransactionContext& transaction_context, const MvccData& mvcc_data,
+                   const ChunkOffset chunk_offset) {
+  return Validate::is_row_visible(transaction_context.transaction_id(), transaction_context.snapshot_commit_id(),
+                                  mvcc_data.tid(chunk_offset), mvcc_data.begin_cid(chunk_offset),
+                                  mvcc_data.end_cid(chunk_offset));
+}
+
+const MvccData& get_mvcc_data(const Chunk& chunk) {
+  const auto& mvcc_data = chunk.mvcc_data();
+  Assert(mvcc_data, "Validate can only be used on tables that use MVCC");
+  return *mvcc_data;
+}
+
+}  // namespace
+
+Validate::Validate(const std::shared_ptr<const AbstractOperator>& in) : AbstractOperator(in) {}
+
+const std::string& Validate::name() const {
+  static const auto name = std::string{"Validate"};
+  return name;
+}
+
+bool Validate::is_pipelineable() const { return true; }
+
+std::shared_ptr<const Table> Validate::execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                     const ChunkID chunk_id) const {
+  auto output_table = _create_output_table_definition(*input_table);
+  const auto matches = _validate_chunk(*input_table->get_chunk(chunk_id));
+  output_table->emplace_chunk(TableScan::create_output_chunk(input_table, chunk_id, matches));
+  return output_table;
+}
+
+bool Validate::is_row_visible(const TransactionID our_transaction_id, const CommitID snapshot_commit_id,
+                              const TransactionID row_transaction_id, const CommitID begin_commit_id,
+                              const CommitID end_commit_id) {
+  // Rows of our own transaction are visible until it deletes them. They are not committed yet, so their begin commit id
+  // is still MAX_COMMIT_ID.
+  const auto own_insert = our_transaction_id == row_transaction_id && !(snapshot_commit_id >= begin_commit_id) &&
+                          !(snapshot_commit_id >= end_commit_id);
+  const auto past_insert = our_transaction_id != row_transaction_id && snapshot_commit_id >= begin_commit_id &&
+                           !(snapshot_commit_id >= end_commit_id);
+  return own_insert || past_insert;
+}
+
+std::shared_ptr<const Table> Validate::_on_execute() {
+  const auto input_table = _left_input_table();
+  auto output_table = _create_output_table_definition(*input_table);
+
+  const auto chunk_count = input_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto matches = _validate_chunk(*input_table->get_chunk(chunk_id));
+    if (matches.empty()) continue;
+    output_table->emplace_chunk(TableScan::create_output_chunk(input_table, chunk_id, matches));
+  }
+
+  // Consumers expect every chunk to hold one segment per column, even if no row is visible at all.
+  if (output_table->row_count() == 0) {
+    output_table->emplace_chunk(TableScan::create_output_chunk(input_table, ChunkID{0}, {}));
+  }
+
+  return output_table;
+}
+
+// The output chunks are created by TableScan::create_output_chunk, which reserves their position lists.
+bool Validate::_reserves_output_memory() const { return true; }
+
+std::shared_ptr<Table> Validate::_create_output_table_definition(const Table& input_table) const {
+  auto output_table = make_shared_intermediate<Table>();
+  const auto column_count = input_table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                        input_table.column_is_nullable(column_id));
+  }
+  return output_table;
+}
+
+std::vector<ChunkOffset> Validate::_validate_chunk(const Chunk& chunk) const {
+  Assert(_transaction_context, "Validate needs a transaction context");
+  const auto& transaction_context = *_transaction_context;
+  // For chunks with MVCC data, this is the number of published rows, so rows that are being appended are ignored.
+  const auto chunk_size = chunk.size();
+  auto matches = std::vector<ChunkOffset>{};
+  if (chunk.column_count() == 0 || chunk_size == 0) return matches;
+
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+  if (!reference_segment) {
+    const auto& mvcc_data = get_mvcc_data(chunk);
+    // None of the rows of compacted chunks is visible to transactions that see the compaction.
+    if (chunk.cleanup_commit_id() <= transaction_context.snapshot_commit_id()) return matches;
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (is_visible_to(transaction_context, mvcc_data, chunk_offset)) matches.push_back(chunk_offset);
+    }
+    return matches;
+  }
+
+  // The columns of a reference chunk may reference different tables through different position lists. A row is only
+  // visible if all rows it references are. Each distinct position list is checked once.
+  auto is_visible = std::vector<bool>(chunk_size, true);
+  auto checked_pos_lists = std::vector<std::pair<const PosList*, const Table*>>{};
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+    Assert(segment, "Chunks must not mix ReferenceSegments and data segments");
+    const auto& pos_list = *segment->pos_list();
+    const auto& referenced_table = *segment->referenced_table();
+    const auto key = std::pair{&pos_list, &referenced_table};
+    if (std::find(checked_pos_lists.cbegin(), checked_pos_lists.cend(), key) != checked_pos_lists.cend()) continue;
+    checked_pos_lists.push_back(key);
+
+    // Position lists are mostly ordered by chunk, so the MVCC data of the last referenced chunk is kept.
+    auto referenced_chunk_id = ChunkID{0};
+    auto referenced_chunk = std::shared_ptr<const Chunk>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto& row_id = pos_list[chunk_offset];
+      if (!referenced_chunk || row_id.chunk_id != referenced_chunk_id) {
+        referenced_chunk_id = row_id.chunk_id;
+        referenced_chunk = referenced_table.get_chunk(referenced_chunk_id);
+      }
+      if (!is_visible_to(transaction_context, get_mvcc_data(*referenced_chunk), row_id.chunk_offset)) {
+        is_visible[chunk_offset] = false;
+      }
+    }
+  }
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (is_visible[chunk_offset]) matches.push_back(chunk_offset);
+  }
+  return matches;
+}
+
+}  // namespace opossum
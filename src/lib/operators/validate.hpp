@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// Operator that filters its input table down to the rows that are visible to its transaction (see
+// set_transaction_context), based on the MvccData of the tables that use MVCC. The output consists of
+// ReferenceSegments. As for TableScan, input ReferenceSegments are resolved, so the output references the tables that
+// hold the rows.
+//
+// A row is visible if it was inserted by a transaction that committed before the snapshot of our transaction was
+// taken and not deleted by such a transaction, or if it was inserted by our transaction itself. Validate only reads
+// the published rows of each chunk (see Chunk::size) and never locks anything, so it can run while rows are appended.
+// It usually follows a GetTable on a table that uses MVCC.
+class Validate : public AbstractOperator {
+ public:
+  explicit Validate(const std::shared_ptr<const AbstractOperator>& in);
+
+  const std::string& name() const override;
+
+  bool is_pipelineable() const override;
+
+  std::shared_ptr<const Table> execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                             const ChunkID chunk_id) const override;
+
+  // Returns whether a row with the given MVCC entries is visible to the transaction with the given id and snapshot.
+  static bool is_row_visible(const TransactionID our_transaction_id, const CommitID snapshot_commit_id,
+                             const TransactionID row_transaction_id, const CommitID begin_commit_id,
+                             const CommitID end_commit_id);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  bool _reserves_output_memory() const override;
+
+  // Creates an empty table with the columns of the input table.
+  std::shared_ptr<Table> _create_output_table_definition(const Table& input_table) const;
+
+  // Returns the offsets of the visible rows of the given input chunk, in order.
+  std::vector<ChunkOffset> _validate_chunk(const Chunk& chunk) const;
+};
+
+}  // namespace opossum
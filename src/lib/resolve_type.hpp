@@ -13,6 +13,10 @@
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -111,4 +115,63 @@ void resolve_fixed_width_integer_type(const SizeType size, const Functor& func)
   }
 }
 
+/**
+ * Resolves the FixedWidthAttributeVector behind an AbstractAttributeVector by its width and passes it on to a generic
+ * lambda. This allows hot loops to read value ids from the underlying vector without one virtual call per entry.
+ *
+ * Example:
+ *
+ *   resolve_attribute_vector(*dictionary_segment.attribute_vector(), [&](const auto& attribute_vector) {
+ *     for (const auto value_id : attribute_vector.values()) { ... }
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector(const AbstractAttributeVector& attribute_vector, const Functor& func) {
+  switch (attribute_vector.width()) {
+    case sizeof(uint8_t):
+      func(static_cast<const FixedWidthAttributeVector<uint8_t>&>(attribute_vector));
+      return;
+    case sizeof(uint16_t):
+      func(static_cast<const FixedWidthAttributeVector<uint16_t>&>(attribute_vector));
+      return;
+    case sizeof(uint32_t):
+      func(static_cast<const FixedWidthAttributeVector<uint32_t>&>(attribute_vector));
+      return;
+    default:
+      Fail("Unknown attribute vector width");
+  }
+}
+
+/**
+ * Resolves the data type of a data segment (i.e., not a ReferenceSegment) by its class and passes a hana::type object
+ * on to a generic lambda, like resolve_data_type. This is useful where only the segment is known, not the table it
+ * belongs to.
+ *
+ * Example:
+ *
+ *   resolve_segment_data_type(*segment, [&](auto type) {
+ *     using Type = typename decltype(type)::type;
+ *     const auto value = type_cast<Type>((*segment)[0]);
+ *   });
+ */
+template <typename Functor>
+void resolve_segment_data_type(const AbstractSegment& segment, const Functor& func) {
+  auto resolved = false;
+  hana::for_each(types, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (resolved) return;
+    auto is_segment_of_type = dynamic_cast<const ValueSegment<Type>*>(&segment) ||
+                              dynamic_cast<const DictionarySegment<Type>*>(&segment) ||
+                              dynamic_cast<const RunLengthSegment<Type>*>(&segment);
+    if constexpr (is_frame_of_reference_supported_v<Type>) {
+      is_segment_of_type = is_segment_of_type || dynamic_cast<const FrameOfReferenceSegment<Type>*>(&segment);
+    }
+    if (is_segment_of_type) {
+      resolved = true;
+      func(type);
+    }
+  });
+  Assert(resolved, "Could not resolve the data type of the segment");
+}
+
 }  // namespace opossum
@@ -0,0 +1,124 @@
+#include "abstract_task.hpp"
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "current_scheduler.hpp"
+#include "memory/query_arena.hpp"
+#include "memory/query_memory_tracker.hpp"
+#include "scheduler.hpp"
+#include "utils/assert.hpp"
+#include "utils/cpu_time.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+AbstractTask::AbstractTask(const SchedulePriority priority)
+    : _priority(priority),
+      _memory_resource(current_memory_resource()),
+      _memory_tracker(current_query_memory_tracker()),
+      _cpu_time_counter(current_cpu_time_counter()) {}
+
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  Assert(!_is_scheduled && !successor->_is_scheduled, "Dependencies cannot be changed after scheduling");
+  _successors.push_back(successor);
+  ++successor->_pending_predecessor_count;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_done() const { return _is_done; }
+
+void AbstractTask::schedule() {
+  const auto was_scheduled = _is_scheduled.exchange(true);
+  Assert(!was_scheduled, "Task was already scheduled");
+  _try_enqueue();
+}
+
+void AbstractTask::join() {
+  if (_is_done) return;
+
+  // Workers must not block, otherwise tasks that wait for their subtasks could occupy all workers.
+  if (auto* const worker = Worker::current()) {
+    while (!_is_done) {
+      if (!worker->execute_next_task()) std::this_thread::yield();
+    }
+    return;
+  }
+
+  auto lock = std::unique_lock<std::mutex>{_done_mutex};
+  _done_condition_variable.wait(lock, [&] { return static_cast<bool>(_is_done); });
+}
+
+void AbstractTask::execute() {
+  DebugAssert(is_ready(), "Task was executed before its predecessors were done");
+  DebugAssert(!_is_done, "Task was executed twice");
+
+  auto exception = this->exception();
+  if (!exception) {
+    // If the counter is installed in this thread already, the thread's CPU time is counted by whoever installed it.
+    const auto counts_cpu_time = _cpu_time_counter && current_cpu_time_counter() != _cpu_time_counter;
+    const auto cpu_time_begin = counts_cpu_time ? thread_cpu_time() : std::chrono::nanoseconds{0};
+    {
+      const auto memory_resource_scope = ScopedMemoryResource{_memory_resource};
+      const auto memory_tracker_scope = ScopedQueryMemoryTracker{_memory_tracker};
+      const auto cpu_time_counter_scope = ScopedCpuTimeCounter{_cpu_time_counter};
+      try {
+        _on_execute();
+      } catch (...) {
+        exception = std::current_exception();
+      }
+    }
+    if (counts_cpu_time) _cpu_time_counter->add(thread_cpu_time() - cpu_time_begin);
+  }
+
+  {
+    // Setting the flag while holding the mutex prevents join() from missing the notification.
+    const auto lock = std::lock_guard<std::mutex>{_done_mutex};
+    _exception = exception;
+    _is_done = true;
+  }
+  _done_condition_variable.notify_all();
+
+  for (const auto& successor : _successors) {
+    if (exception) successor->_on_predecessor_failed(exception);
+    successor->_on_predecessor_done();
+  }
+}
+
+std::exception_ptr AbstractTask::exception() const {
+  const auto lock = std::lock_guard<std::mutex>{_done_mutex};
+  return _exception;
+}
+
+void AbstractTask::_try_enqueue() {
+  if (!_is_scheduled || !is_ready()) return;
+
+  // Both schedule() and the last finishing predecessor may get here. Only one of them hands the task on.
+  if (_is_enqueued.exchange(true)) return;
+
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->schedule(shared_from_this());
+  } else {
+    execute();
+  }
+}
+
+void AbstractTask::_on_predecessor_done() {
+  const auto remaining_predecessor_count = --_pending_predecessor_count;
+  if (remaining_predecessor_count == 0) _try_enqueue();
+}
+
+void AbstractTask::_on_predecessor_failed(const std::exception_ptr& exception) {
+  const auto lock = std::lock_guard<std::mutex>{_done_mutex};
+  if (!_exception) _exception = exception;
+}
+
+}  // namespace opossum
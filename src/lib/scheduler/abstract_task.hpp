@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class CpuTimeCounter;
+class QueryMemoryTracker;
+
+// Low-priority tasks, e.g., background maintenance such as ChunkCompactor, are only executed by workers that find no
+// default-priority task, and only a bounded number of them run at a time (see Scheduler).
+enum class SchedulePriority { Default, Low };
+
+// AbstractTask is the abstract super class for all units of work that are executed by the scheduler, e.g., operators
+// (OperatorTask) or chunk-level subtasks of an operator (JobTask). Tasks can depend on other tasks. A task becomes
+// ready once all of its predecessors are done. Scheduling a task that is not ready yet is allowed; it is handed to the
+// scheduler as soon as its last predecessor finishes.
+//
+// Lifecycle of a task:
+// 1. The task is constructed and its dependencies are set up via set_as_predecessor_of.
+// 2. schedule() is called. If no scheduler is set (see CurrentScheduler), ready tasks are executed immediately in the
+// calling thread.
+// 3. A worker executes the task. Afterwards, the task is done and successors that became ready are handed on.
+// 4. join() returns.
+//
+// Tasks are executed with the memory resource, the QueryMemoryTracker, and the CpuTimeCounter that were current in the
+// thread that constructed them (see ScopedMemoryResource). Thus, the operators and jobs of a query allocate from the
+// query's arena and report into its tracker on any worker, and jobs count towards the CPU time of their operator.
+//
+// Exceptions thrown by _on_execute do not leave the worker. The task is done nonetheless and keeps the exception.
+// Successors of a failed task are not executed but fail with the same exception, so that the exception of an operator
+// reaches the task of the plan's root.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  explicit AbstractTask(const SchedulePriority priority = SchedulePriority::Default);
+
+  virtual ~AbstractTask() = default;
+
+  SchedulePriority priority() const;
+
+  // Makes this task a predecessor of the given successor, i.e., the successor is not executed before this task is
+  // done. Dependencies have to be set up before any of the involved tasks is scheduled.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // Returns whether all predecessors are done.
+  bool is_ready() const;
+
+  bool is_done() const;
+
+  // Hands the task to the current scheduler once it is ready. Tasks shall not be scheduled twice.
+  void schedule();
+
+  // Blocks until the task is done. When called by a worker, the worker executes other tasks while waiting, so that
+  // tasks can wait for their subtasks without blocking the worker pool. Does not throw if the task failed, see
+  // exception().
+  void join();
+
+  // Returns the exception that the task or one of its predecessors threw, or nullptr if the task succeeded. Only
+  // meaningful once the task is done.
+  std::exception_ptr exception() const;
+
+  // Executes the task. Called by the scheduler. Do not call it directly, use schedule() instead.
+  void execute();
+
+ protected:
+  virtual void _on_execute() = 0;
+
+ private:
+  // Hands the task to the scheduler if it is scheduled and ready, but only once.
+  void _try_enqueue();
+
+  void _on_predecessor_done();
+
+  // Called by a failed predecessor before it decrements the pending predecessor count. The first exception is kept.
+  void _on_predecessor_failed(const std::exception_ptr& exception);
+
+  const SchedulePriority _priority;
+  const std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+  const std::shared_ptr<QueryMemoryTracker> _memory_tracker;
+  const std::shared_ptr<CpuTimeCounter> _cpu_time_counter;
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  std::atomic<uint32_t> _pending_predecessor_count{0};
+
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_enqueued{false};
+  std::atomic_bool _is_done{false};
+
+  // Also protects _exception.
+  mutable std::mutex _done_mutex;
+  std::condition_variable _done_condition_variable;
+  std::exception_ptr _exception;
+};
+
+}  // namespace opossum
@@ -0,0 +1,20 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+
+#include "scheduler.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Scheduler> CurrentScheduler::_scheduler;
+
+const std::shared_ptr<Scheduler>& CurrentScheduler::get() { return _scheduler; }
+
+void CurrentScheduler::set(const std::shared_ptr<Scheduler>& scheduler) {
+  if (_scheduler) _scheduler->finish();
+  _scheduler = scheduler;
+}
+
+bool CurrentScheduler::is_set() { return static_cast<bool>(_scheduler); }
+
+}  // namespace opossum
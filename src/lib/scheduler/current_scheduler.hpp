@@ -0,0 +1,43 @@
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class Scheduler;
+
+// Holds the scheduler that tasks are handed to. If no scheduler is set, tasks are executed in the thread that
+// schedules them as soon as they are ready. This keeps single-threaded execution (e.g., in most tests) deterministic.
+class CurrentScheduler {
+ public:
+  static const std::shared_ptr<Scheduler>& get();
+
+  // Sets the scheduler. A previously set scheduler is finished first. Pass nullptr to fall back to immediate
+  // execution.
+  static void set(const std::shared_ptr<Scheduler>& scheduler);
+
+  static bool is_set();
+
+  // Schedules all tasks and waits until they are done. Without a scheduler, the tasks are executed in the given order,
+  // so they have to be topologically sorted (see OperatorTask::make_tasks_from_operator). If any task failed, the
+  // first exception is rethrown once all tasks are done, as the tasks may reference data of the caller.
+  template <typename TaskType>
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+    for (const auto& task : tasks) {
+      task->schedule();
+    }
+    auto exception = std::exception_ptr{};
+    for (const auto& task : tasks) {
+      task->join();
+      if (!exception) exception = task->exception();
+    }
+    if (exception) std::rethrow_exception(exception);
+  }
+
+ protected:
+  static std::shared_ptr<Scheduler> _scheduler;
+};
+
+}  // namespace opossum
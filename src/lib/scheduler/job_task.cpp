@@ -0,0 +1,12 @@
+#include "job_task.hpp"
+
+#include <functional>
+
+namespace opossum {
+
+JobTask::JobTask(const std::function<void()>& fn, const SchedulePriority priority)
+    : AbstractTask(priority), _fn(fn) {}
+
+void JobTask::_on_execute() { _fn(); }
+
+}  // namespace opossum
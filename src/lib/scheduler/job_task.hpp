@@ -0,0 +1,20 @@
+#pragma once
+
+#include <functional>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// Task that executes an arbitrary function, e.g., the part of an operator that processes a single chunk.
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(const std::function<void()>& fn, const SchedulePriority priority = SchedulePriority::Default);
+
+ protected:
+  void _on_execute() override;
+
+  const std::function<void()> _fn;
+};
+
+}  // namespace opossum
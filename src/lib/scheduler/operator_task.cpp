@@ -0,0 +1,53 @@
+#include "operator_task.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<OperatorTask> add_operator_tasks(
+    const std::shared_ptr<AbstractOperator>& op,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<OperatorTask>>& task_by_operator,
+    std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  const auto task_iterator = task_by_operator.find(op.get());
+  if (task_iterator != task_by_operator.end()) return task_iterator->second;
+
+  auto task = std::make_shared<OperatorTask>(op);
+  for (const auto& input : {op->left_input(), op->right_input()}) {
+    // Inputs that were executed before, e.g., TableWrappers, do not need a task.
+    if (!input || input->performance_data().executed) continue;
+
+    // Operators only hold const pointers to their inputs, because consumers must not modify them. Executing the inputs
+    // is the exception, which is why the constness is cast away here.
+    const auto mutable_input = std::const_pointer_cast<AbstractOperator>(input);
+    const auto input_task = add_operator_tasks(mutable_input, task_by_operator, tasks);
+    input_task->set_as_predecessor_of(task);
+  }
+
+  task_by_operator.emplace(op.get(), task);
+  tasks.push_back(task);
+  return task;
+}
+
+}  // namespace
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _op(op) {}
+
+std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op) {
+  auto task_by_operator = std::unordered_map<const AbstractOperator*, std::shared_ptr<OperatorTask>>{};
+  auto tasks = std::vector<std::shared_ptr<OperatorTask>>{};
+  add_operator_tasks(op, task_by_operator, tasks);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
+
+void OperatorTask::_on_execute() { _op->execute(); }
+
+}  // namespace opossum
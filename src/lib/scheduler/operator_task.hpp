@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Task that executes an operator. Its predecessors are the tasks of the operator's inputs.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  // Creates one task per operator of the plan rooted at op and sets up the dependencies between them. Operators that
+  // are the input of multiple operators get a single task, inputs that were already executed get none. The tasks are
+  // returned in topological order, i.e., the task of op comes last. Independent branches of the plan can thus be
+  // executed in parallel.
+  static std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _op;
+};
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+Scheduler::Scheduler(const uint32_t worker_count) {
+  Assert(worker_count > 0, "Scheduler needs at least one worker");
+
+  _workers.reserve(worker_count);
+  for (auto worker_id = WorkerID{0}; worker_id < worker_count; ++worker_id) {
+    _workers.push_back(std::make_unique<Worker>(*this, worker_id));
+  }
+
+  // Workers are started only after all of them exist, since they steal from each other.
+  for (const auto& worker : _workers) {
+    worker->start();
+  }
+}
+
+Scheduler::~Scheduler() {
+  if (!_is_shut_down) finish();
+}
+
+uint32_t Scheduler::worker_count() const { return static_cast<uint32_t>(_workers.size()); }
+
+void Scheduler::schedule(const std::shared_ptr<AbstractTask>& task) {
+  Assert(!_is_shut_down, "Cannot schedule tasks after the scheduler was finished");
+  DebugAssert(task->is_ready(), "Only ready tasks can be enqueued");
+
+  ++_unfinished_task_count;
+
+  if (task->priority() == SchedulePriority::Low) {
+    _low_priority_queue.push(task);
+    ++_queued_low_priority_task_count;
+    _notify_idle_worker();
+    return;
+  }
+
+  // Keep tasks created by a worker on that worker, their inputs are probably still in its cache.
+  auto* const current_worker = Worker::current();
+  const auto is_own_worker = current_worker && current_worker->id() < _workers.size() &&
+                             _workers[current_worker->id()].get() == current_worker;
+  auto& worker = is_own_worker ? *current_worker : *_workers[_next_worker_id++ % _workers.size()];
+
+  worker.queue().push(task);
+  ++_queued_task_count;
+  _notify_idle_worker();
+}
+
+void Scheduler::finish() {
+  Assert(!Worker::current(), "The scheduler cannot be finished by one of its workers");
+
+  while (_unfinished_task_count > 0) {
+    std::this_thread::yield();
+  }
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_idle_mutex};
+    _is_shut_down = true;
+  }
+  _idle_condition_variable.notify_all();
+
+  for (const auto& worker : _workers) {
+    worker->join();
+  }
+}
+
+std::shared_ptr<AbstractTask> Scheduler::steal_task(const WorkerID thief_id) {
+  const auto worker_count = _workers.size();
+  for (auto offset = size_t{1}; offset < worker_count; ++offset) {
+    auto task = _workers[(thief_id + offset) % worker_count]->queue().steal();
+    if (task) return task;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> Scheduler::take_low_priority_task() {
+  auto running_count = _running_low_priority_task_count.load();
+  do {
+    if (running_count >= MAX_RUNNING_LOW_PRIORITY_TASKS) return nullptr;
+  } while (!_running_low_priority_task_count.compare_exchange_weak(running_count, running_count + 1));
+
+  // Low-priority tasks are executed in the order in which they were scheduled.
+  auto task = _low_priority_queue.steal();
+  if (!task) {
+    --_running_low_priority_task_count;
+    return nullptr;
+  }
+  --_queued_low_priority_task_count;
+  return task;
+}
+
+void Scheduler::on_low_priority_task_finished() {
+  --_running_low_priority_task_count;
+  // Another low-priority task may run now.
+  if (_queued_low_priority_task_count > 0) _notify_idle_worker();
+}
+
+void Scheduler::on_task_dequeued() { --_queued_task_count; }
+
+void Scheduler::on_task_finished() { --_unfinished_task_count; }
+
+void Scheduler::wait_for_tasks() {
+  auto lock = std::unique_lock<std::mutex>{_idle_mutex};
+  _idle_condition_variable.wait(lock, [&] {
+    return _is_shut_down || _queued_task_count > 0 ||
+           (_queued_low_priority_task_count > 0 &&
+            _running_low_priority_task_count < MAX_RUNNING_LOW_PRIORITY_TASKS);
+  });
+}
+
+bool Scheduler::is_shut_down() const { return _is_shut_down; }
+
+void Scheduler::_notify_idle_worker() {
+  {
+    // Taking the mutex ensures that a worker that is about to wait has either seen the new task or is notified.
+    const auto lock = std::lock_guard<std::mutex>{_idle_mutex};
+  }
+  _idle_condition_variable.notify_one();
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "task_queue.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class Worker;
+
+// Scheduler with a fixed pool of workers. Each worker has its own TaskQueue. Tasks scheduled from within a worker
+// (e.g., subtasks of an operator or successors of a finished task) go to that worker's queue, all other tasks are
+// distributed round-robin. Idle workers steal tasks from the queues of other workers.
+//
+// Low-priority tasks go to a separate queue that workers only turn to when they found no other task. At most
+// MAX_RUNNING_LOW_PRIORITY_TASKS of them are executed at a time, so background work never occupies more than that
+// many workers, even if no queries are running.
+//
+// Usually, the scheduler is not used directly but set as the CurrentScheduler. Tasks then find it on their own.
+class Scheduler : private Noncopyable {
+ public:
+  static constexpr auto MAX_RUNNING_LOW_PRIORITY_TASKS = uint32_t{1};
+
+  explicit Scheduler(const uint32_t worker_count = std::max(std::thread::hardware_concurrency(), 1u));
+
+  // Finishes the scheduler if that did not happen before.
+  ~Scheduler();
+
+  uint32_t worker_count() const;
+
+  // Enqueues a task that is ready to be executed. Use AbstractTask::schedule() instead of calling this directly.
+  void schedule(const std::shared_ptr<AbstractTask>& task);
+
+  // Waits until all enqueued tasks and the tasks that became ready by their execution are done. Then, the workers are
+  // shut down. Tasks that are scheduled but still wait for unscheduled predecessors are never executed.
+  void finish();
+
+  // The following methods are used by the workers.
+
+  // Takes a task from the queue of any worker but the thief. Returns nullptr if all queues are empty.
+  std::shared_ptr<AbstractTask> steal_task(const WorkerID thief_id);
+
+  // Takes a low-priority task unless the maximum number of them is running already. Returns nullptr otherwise or if
+  // there is none. The worker has to call on_low_priority_task_finished once the task is done.
+  std::shared_ptr<AbstractTask> take_low_priority_task();
+
+  void on_low_priority_task_finished();
+
+  void on_task_dequeued();
+  void on_task_finished();
+
+  // Blocks the calling worker until a task is enqueued or the scheduler is shut down.
+  void wait_for_tasks();
+
+  bool is_shut_down() const;
+
+ protected:
+  // Wakes up a worker that waits for tasks.
+  void _notify_idle_worker();
+
+  std::vector<std::unique_ptr<Worker>> _workers;
+
+  // Number of tasks that were enqueued but are not done yet.
+  std::atomic<uint64_t> _unfinished_task_count{0};
+  // Number of tasks that are in a queue, i.e., that were not yet picked up by a worker.
+  std::atomic<uint64_t> _queued_task_count{0};
+
+  TaskQueue _low_priority_queue;
+  // Number of low-priority tasks that are queued or running. They are not included in _queued_task_count.
+  std::atomic<uint64_t> _queued_low_priority_task_count{0};
+  std::atomic<uint32_t> _running_low_priority_task_count{0};
+
+  std::atomic<uint32_t> _next_worker_id{0};
+  std::atomic_bool _is_shut_down{false};
+
+  std::mutex _idle_mutex;
+  std::condition_variable _idle_condition_variable;
+};
+
+}  // namespace opossum
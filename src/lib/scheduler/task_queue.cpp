@@ -0,0 +1,38 @@
+#include "task_queue.hpp"
+
+#include <memory>
+#include <mutex>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+void TaskQueue::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _tasks.push_back(task);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pop() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.back());
+  _tasks.pop_back();
+  return task;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.front());
+  _tasks.pop_front();
+  return task;
+}
+
+bool TaskQueue::empty() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _tasks.empty();
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// Double-ended queue of ready tasks that belongs to a single worker. The owning worker pushes and pops at the back,
+// i.e., it executes the most recently created tasks first, whose data is most likely still cached. Other workers steal
+// from the front, i.e., they take the oldest tasks, which tend to be the largest units of work.
+class TaskQueue : private Noncopyable {
+ public:
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // Returns nullptr if the queue is empty.
+  std::shared_ptr<AbstractTask> pop();
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+
+ protected:
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
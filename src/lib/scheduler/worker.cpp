@@ -0,0 +1,58 @@
+#include "worker.hpp"
+
+#include <memory>
+#include <thread>
+
+#include "abstract_task.hpp"
+#include "scheduler.hpp"
+
+namespace opossum {
+
+namespace {
+
+thread_local Worker* current_worker = nullptr;
+
+}  // namespace
+
+Worker::Worker(Scheduler& scheduler, const WorkerID id) : _scheduler(scheduler), _id(id) {}
+
+Worker* Worker::current() { return current_worker; }
+
+WorkerID Worker::id() const { return _id; }
+
+TaskQueue& Worker::queue() { return _queue; }
+
+void Worker::start() { _thread = std::thread{&Worker::_work, this}; }
+
+void Worker::join() { _thread.join(); }
+
+bool Worker::execute_next_task() {
+  auto task = _queue.pop();
+  if (!task) task = _scheduler.steal_task(_id);
+  if (task) {
+    _scheduler.on_task_dequeued();
+    task->execute();
+    _scheduler.on_task_finished();
+    return true;
+  }
+
+  task = _scheduler.take_low_priority_task();
+  if (!task) return false;
+
+  task->execute();
+  _scheduler.on_low_priority_task_finished();
+  _scheduler.on_task_finished();
+  return true;
+}
+
+void Worker::_work() {
+  current_worker = this;
+
+  while (!_scheduler.is_shut_down()) {
+    if (!execute_next_task()) _scheduler.wait_for_tasks();
+  }
+
+  current_worker = nullptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <thread>
+
+#include "task_queue.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Scheduler;
+
+// A worker owns a thread and a TaskQueue. It executes the tasks of its own queue and steals tasks from the queues of
+// other workers once its own queue is empty.
+class Worker : private Noncopyable {
+ public:
+  Worker(Scheduler& scheduler, const WorkerID id);
+
+  // Returns the worker that runs in the calling thread or nullptr if the calling thread is not a worker.
+  static Worker* current();
+
+  WorkerID id() const;
+
+  TaskQueue& queue();
+
+  void start();
+
+  // Waits for the thread to terminate. The scheduler has to be shut down before.
+  void join();
+
+  // Executes a single task from the own queue or, if that is empty, a stolen one. Only if neither exists, a
+  // low-priority task is executed. Returns false if no task was found.
+  bool execute_next_task();
+
+ protected:
+  void _work();
+
+  Scheduler& _scheduler;
+  const WorkerID _id;
+  TaskQueue _queue;
+  std::thread _thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,205 @@
+#include "segment_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// For non-numeric types, there is no meaningful way to interpolate between the minimum and the maximum. Like most
+// textbook optimizers, we assume that a third of the rows within the value range satisfy an open range predicate.
+constexpr auto DEFAULT_RANGE_SELECTIVITY = 1.0f / 3.0f;
+
+}  // namespace
+
+std::shared_ptr<BaseSegmentStatistics> BaseSegmentStatistics::create(const AbstractSegment& segment) {
+  const auto segment_size = segment.size();
+  auto statistics = std::shared_ptr<BaseSegmentStatistics>{};
+  resolve_segment_data_type(segment, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+      const auto& dictionary = dictionary_segment->dictionary();
+      if (dictionary.empty()) return;
+      auto null_count = size_t{0};
+      if (dictionary_segment->is_nullable()) {
+        resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+          const auto& value_ids = attribute_vector.values();
+          null_count = static_cast<size_t>(std::count(value_ids.cbegin(), value_ids.cend(),
+                                                      dictionary_segment->null_value_id()));
+        });
+      }
+      statistics = std::make_shared<SegmentStatistics<Type>>(
+          dictionary.front(), dictionary.back(), static_cast<ChunkOffset>(dictionary.size()),
+          static_cast<float>(null_count) / static_cast<float>(segment_size));
+      return;
+    }
+
+    // The remaining segments are reduced to their non-NULL values. Run-length segments store each run's value once,
+    // which does not change minimum, maximum, and distinct count. Frame-of-reference segments have to be decompressed
+    // first.
+    auto values = std::vector<Type>{};
+    auto null_count = size_t{0};
+    if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<Type>*>(&segment)) {
+      const auto& run_values = run_length_segment->values();
+      const auto& end_positions = run_length_segment->end_positions();
+      for (auto run_index = size_t{0}; run_index < run_values.size(); ++run_index) {
+        if (!run_length_segment->is_null_run(run_index)) {
+          values.push_back(run_values[run_index]);
+          continue;
+        }
+        const auto run_begin = run_index == 0 ? ChunkOffset{0} : end_positions[run_index - 1] + 1;
+        null_count += end_positions[run_index] + 1 - run_begin;
+      }
+    } else if (const auto* value_segment = dynamic_cast<const ValueSegment<Type>*>(&segment)) {
+      const auto& segment_values = value_segment->values();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        if (value_segment->is_null(chunk_offset)) {
+          ++null_count;
+        } else {
+          values.push_back(segment_values[chunk_offset]);
+        }
+      }
+    } else if constexpr (is_frame_of_reference_supported_v<Type>) {
+      const auto& frame_of_reference_segment = static_cast<const FrameOfReferenceSegment<Type>&>(segment);
+      values = frame_of_reference_segment.decompress();
+      if (const auto& null_bitmap = frame_of_reference_segment.null_bitmap()) {
+        null_count = null_bitmap->null_count();
+        auto chunk_offset = ChunkOffset{0};
+        std::erase_if(values, [&](const auto&) { return (*null_bitmap)[chunk_offset++]; });
+      }
+    }
+    if (values.empty()) return;
+    const auto [min, max] = std::minmax_element(values.cbegin(), values.cend());
+    const auto distinct_values = std::unordered_set<Type>(values.cbegin(), values.cend());
+    statistics = std::make_shared<SegmentStatistics<Type>>(
+        *min, *max, static_cast<ChunkOffset>(distinct_values.size()),
+        static_cast<float>(null_count) / static_cast<float>(segment_size));
+  });
+  return statistics;
+}
+
+template <typename T>
+SegmentStatistics<T>::SegmentStatistics(const T& min, const T& max, const ChunkOffset distinct_count,
+                                        const float null_fraction)
+    : _min(min), _max(max), _distinct_count(distinct_count), _null_fraction(null_fraction) {
+  DebugAssert(!(max < min), "Minimum has to be less than or equal to maximum");
+  DebugAssert(distinct_count > 0, "Statistics need at least one distinct value");
+  DebugAssert(null_fraction >= 0.0f && null_fraction < 1.0f, "NULL fraction has to be in [0, 1)");
+}
+
+template <typename T>
+float SegmentStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  if (scan_type == ScanType::OpIsNull) return _null_fraction;
+  if (scan_type == ScanType::OpIsNotNull) return 1.0f - _null_fraction;
+  // Comparisons with NULL are never true.
+  if (variant_is_null(search_value)) return 0.0f;
+
+  // The estimates below are fractions of the non-NULL rows, as NULL rows never satisfy a comparison.
+  const auto non_null_fraction = 1.0f - _null_fraction;
+  const auto value = type_cast<T>(search_value);
+  const auto is_in_range = !(value < _min) && !(_max < value);
+  const auto equals_selectivity = is_in_range ? 1.0f / static_cast<float>(_distinct_count) : 0.0f;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return non_null_fraction * equals_selectivity;
+    case ScanType::OpNotEquals:
+      return non_null_fraction * (1.0f - equals_selectivity);
+    case ScanType::OpLessThan:
+      return non_null_fraction * _estimate_less_than(value, false);
+    case ScanType::OpLessThanEquals:
+      return non_null_fraction * _estimate_less_than(value, true);
+    case ScanType::OpGreaterThan:
+      return non_null_fraction * (1.0f - _estimate_less_than(value, true));
+    case ScanType::OpGreaterThanEquals:
+      return non_null_fraction * (1.0f - _estimate_less_than(value, false));
+    case ScanType::OpIsNull:
+    case ScanType::OpIsNotNull:
+      break;
+  }
+  Fail("Unknown scan type");
+}
+
+template <typename T>
+bool SegmentStatistics<T>::does_not_contain(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  if (scan_type == ScanType::OpIsNull) return _null_fraction == 0.0f;
+  // Statistics are only created for segments with at least one non-NULL value.
+  if (scan_type == ScanType::OpIsNotNull) return false;
+  if (variant_is_null(search_value)) return true;
+
+  const auto value = type_cast<T>(search_value);
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return value < _min || _max < value;
+    case ScanType::OpNotEquals:
+      return _min == value && _max == value;
+    case ScanType::OpLessThan:
+      return !(_min < value);
+    case ScanType::OpLessThanEquals:
+      return value < _min;
+    case ScanType::OpGreaterThan:
+      return !(value < _max);
+    case ScanType::OpGreaterThanEquals:
+      return _max < value;
+    case ScanType::OpIsNull:
+    case ScanType::OpIsNotNull:
+      break;
+  }
+  Fail("Unknown scan type");
+}
+
+template <typename T>
+float SegmentStatistics<T>::_estimate_less_than(const T& search_value, const bool inclusive) const {
+  if (search_value < _min) return 0.0f;
+  if (_max < search_value) return 1.0f;
+
+  const auto equals_selectivity = 1.0f / static_cast<float>(_distinct_count);
+  if (search_value == _min) return inclusive ? equals_selectivity : 0.0f;
+  if (search_value == _max) return inclusive ? 1.0f : 1.0f - equals_selectivity;
+
+  auto selectivity = DEFAULT_RANGE_SELECTIVITY;
+  if constexpr (std::is_arithmetic_v<T>) {
+    // _min < search_value < _max, so the range is not empty.
+    selectivity = static_cast<float>((static_cast<double>(search_value) - static_cast<double>(_min)) /
+                                     (static_cast<double>(_max) - static_cast<double>(_min)));
+  }
+  return std::clamp(selectivity + (inclusive ? equals_selectivity : 0.0f), 0.0f, 1.0f);
+}
+
+template <typename T>
+ChunkOffset SegmentStatistics<T>::distinct_count() const {
+  return _distinct_count;
+}
+
+template <typename T>
+const T& SegmentStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const T& SegmentStatistics<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+float SegmentStatistics<T>::null_fraction() const {
+  return _null_fraction;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Segment statistics summarize the values of an immutable segment (minimum, maximum, and number of distinct values of
+// the non-NULL rows as well as the fraction of NULL rows). Operators use them to estimate how many rows a predicate
+// selects without looking at the rows, e.g., to decide whether an index lookup is cheaper than a scan, and to skip
+// segments that cannot contain a match. Table::compress_chunk attaches them to the compressed chunk.
+class BaseSegmentStatistics : private Noncopyable {
+ public:
+  virtual ~BaseSegmentStatistics() = default;
+
+  // Creates the statistics for a data segment. For dictionary segments, they are read from the dictionary in constant
+  // time (nullable segments count their NULL value ids), other segments are scanned once. Returns nullptr for segments
+  // without non-NULL values.
+  static std::shared_ptr<BaseSegmentStatistics> create(const AbstractSegment& segment);
+
+  // Estimates the fraction of rows for which "value <scan_type> search_value" holds. The estimate is between 0 and 1
+  // and assumes that the distinct values are distributed uniformly between the minimum and the maximum.
+  virtual float estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns true if no row can satisfy "value <scan_type> search_value". Unlike a selectivity of 0, this is exact and
+  // thus allows skipping the segment (min/max pruning).
+  virtual bool does_not_contain(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  virtual ChunkOffset distinct_count() const = 0;
+};
+
+template <typename T>
+class SegmentStatistics : public BaseSegmentStatistics {
+ public:
+  SegmentStatistics(const T& min, const T& max, const ChunkOffset distinct_count, const float null_fraction = 0.0f);
+
+  float estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  bool does_not_contain(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  ChunkOffset distinct_count() const override;
+
+  const T& min() const;
+  const T& max() const;
+  float null_fraction() const;
+
+ protected:
+  // Estimates the fraction of rows whose value is less than (or, if inclusive, equal to) the search value.
+  float _estimate_less_than(const T& search_value, const bool inclusive) const;
+
+  const T _min;
+  const T _max;
+  const ChunkOffset _distinct_count;
+  const float _null_fraction;
+};
+
+}  // namespace opossum
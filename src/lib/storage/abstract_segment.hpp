@@ -4,6 +4,7 @@
 #include <string>
 
 #include "all_type_variant.hpp"
+#include "tagged_value.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -27,8 +28,9 @@ class AbstractSegment : private Noncopyable {
     return AllTypeVariant{};
   }
 
-  // Appends the value at the end of the segment.
-  virtual void append(const AllTypeVariant& val) {
+  // Appends the value at the end of the segment. Strings are copied, the TaggedValue only has to be valid during the
+  // call.
+  virtual void append(const TaggedValue& val) {
     // TODO(student) Remove this implementation since it should be pure virtual. Currently, it's implemented to
     // successfully compile the tests.
   }
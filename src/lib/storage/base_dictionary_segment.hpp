@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_segment.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractAttributeVector;
+
+// BaseDictionarySegment is the type-independent interface of DictionarySegment. It allows components that only work on
+// value ids, e.g., indexes, to handle dictionary segments without resolving their data type.
+class BaseDictionarySegment : public AbstractSegment {
+ public:
+  // Returns the first value ID that refers to a value >= the search value. Returns INVALID_VALUE_ID if all values are
+  // smaller than the search value.
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // Returns the first value ID that refers to a value > the search value. Returns INVALID_VALUE_ID if all values are
+  // smaller than or equal to the search value.
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // Returns the number of unique values (dictionary entries).
+  virtual ChunkOffset unique_values_count() const = 0;
+
+  // Returns the value id of NULL rows, which is the first value id after the dictionary (unique_values_count()).
+  virtual ValueID null_value_id() const = 0;
+
+  // Returns the attribute vector that maps each position to a value id.
+  virtual std::shared_ptr<const AbstractAttributeVector> attribute_vector() const = 0;
+};
+
+}  // namespace opossum
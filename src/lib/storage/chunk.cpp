@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
@@ -9,6 +10,10 @@
 
 #include "abstract_segment.hpp"
 #include "chunk.hpp"
+#include "contiguous_chunk_storage.hpp"
+#include "index/base_index.hpp"
+#include "mvcc_data.hpp"
+#include "reference_segment.hpp"
 
 #include "utils/assert.hpp"
 
@@ -23,7 +28,7 @@ void Chunk::add_segment(const std::shared_ptr<AbstractSegment> segment) {
   _segments.push_back(segment);
 }
 
-void Chunk::append(const std::vector<AllTypeVariant>& values) {
+void Chunk::append(const std::vector<TaggedValue>& values) {
   DebugAssert(values.size() == column_count(), "The values to append have the same count as columns");
   for (size_t index = 0; index < values.size(); ++index) {
     _segments.at(index)->append(values[index]);
@@ -32,9 +37,95 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
 
 std::shared_ptr<AbstractSegment> Chunk::get_segment(const ColumnID column_id) const { return _segments.at(column_id); }
 
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(
+    const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
+  auto result = std::vector<std::shared_ptr<BaseIndex>>{};
+  std::copy_if(_indexes.cbegin(), _indexes.cend(), std::back_inserter(result),
+               [&segments](const auto& index) { return index->is_index_for(segments); });
+  return result;
+}
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
+  auto segments = std::vector<std::shared_ptr<const AbstractSegment>>{};
+  segments.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    segments.push_back(get_segment(column_id));
+  }
+  return get_indexes(segments);
+}
+
+const std::vector<std::shared_ptr<BaseIndex>>& Chunk::indexes() const { return _indexes; }
+
+void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  const auto iter = std::find(_indexes.cbegin(), _indexes.cend(), index);
+  Assert(iter != _indexes.cend(), "Index is not attached to the chunk");
+  _indexes.erase(iter);
+}
+
+void Chunk::set_statistics(std::vector<std::shared_ptr<const BaseSegmentStatistics>> statistics) {
+  DebugAssert(statistics.size() == column_count(), "Statistics have to be given for each column");
+  _statistics = std::move(statistics);
+}
+
+const std::vector<std::shared_ptr<const BaseSegmentStatistics>>& Chunk::statistics() const { return _statistics; }
+
+void Chunk::set_encoding_types(std::vector<EncodingType> encoding_types) {
+  DebugAssert(encoding_types.size() == column_count(), "Encodings have to be given for each column");
+  _encoding_types = std::move(encoding_types);
+}
+
+const std::vector<EncodingType>& Chunk::encoding_types() const { return _encoding_types; }
+
+void Chunk::set_mvcc_data(std::shared_ptr<MvccData> mvcc_data) { _mvcc_data = std::move(mvcc_data); }
+
+const std::shared_ptr<MvccData>& Chunk::mvcc_data() const { return _mvcc_data; }
+
+bool Chunk::has_mvcc_data() const { return _mvcc_data != nullptr; }
+
+void Chunk::set_contiguous_storage(std::shared_ptr<const ContiguousChunkStorage> storage) {
+  _contiguous_storage = std::move(storage);
+}
+
+const std::shared_ptr<const ContiguousChunkStorage>& Chunk::contiguous_storage() const { return _contiguous_storage; }
+
+ChunkOffset Chunk::invalid_row_count() const { return _mvcc_data ? _mvcc_data->invalid_row_count() : 0; }
+
+void Chunk::increase_invalid_row_count(const ChunkOffset count) const {
+  DebugAssert(_mvcc_data, "Invalid rows are only counted for chunks with MVCC data");
+  _mvcc_data->increase_invalid_row_count(count);
+}
+
+CommitID Chunk::cleanup_commit_id() const { return _cleanup_commit_id; }
+
+void Chunk::set_cleanup_commit_id(const CommitID commit_id) { _cleanup_commit_id = commit_id; }
+
+size_t Chunk::memory_usage() const {
+  auto memory_usage = size_t{0};
+  // ReferenceSegments of the same chunk usually share their position list, which is only counted once.
+  auto counted_pos_lists = std::vector<const PosList*>{};
+  for (const auto& segment : _segments) {
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      const auto* pos_list = reference_segment->pos_list().get();
+      if (std::find(counted_pos_lists.cbegin(), counted_pos_lists.cend(), pos_list) != counted_pos_lists.cend()) {
+        continue;
+      }
+      counted_pos_lists.push_back(pos_list);
+    }
+    memory_usage += segment->estimate_memory_usage();
+  }
+  for (const auto& index : _indexes) {
+    memory_usage += index->estimate_memory_usage();
+  }
+  if (_mvcc_data) memory_usage += _mvcc_data->estimate_memory_usage();
+  return memory_usage;
+}
+
 ColumnCount Chunk::column_count() const { return static_cast<ColumnCount>(_segments.size()); }
 
 ChunkOffset Chunk::size() const {
+  if (_mvcc_data) {
+    return _mvcc_data->size();
+  }
   if (_segments.empty()) {
     return 0;
   }
@@ -9,12 +9,17 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "encoding_type.hpp"
+#include "tagged_value.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class BaseIndex;
+class BaseSegmentStatistics;
 class AbstractSegment;
+class ContiguousChunkStorage;
+class MvccData;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -31,18 +36,102 @@ class Chunk : private Noncopyable {
   // Returns the number of columns (cannot exceed ColumnID (uint16_t)).
   ColumnCount column_count() const;
 
-  // Returns the number of rows (cannot exceed ChunkOffset (uint32_t)).
+  // Returns the number of rows (cannot exceed ChunkOffset (uint32_t)). For chunks with MVCC data, this is the number of
+  // published rows (see MvccData::size), which may lag behind the segments while a row is appended.
   ChunkOffset size() const;
 
   // Adds a new row, given as a list of values, to the chunk. Note this is slow and not thread-safe and should be used
   // for testing purposes only.
-  void append(const std::vector<AllTypeVariant>& values);
+  void append(const std::vector<TaggedValue>& values);
 
   // Returns the segment at a given position.
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
+  // Builds an index of the given type (e.g., GroupKeyIndex) on the segments of the given columns and attaches it to the
+  // chunk. Indexes are not maintained, so they should only be created on immutable segments.
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    auto segments = std::vector<std::shared_ptr<const AbstractSegment>>{};
+    segments.reserve(column_ids.size());
+    for (const auto column_id : column_ids) {
+      segments.push_back(get_segment(column_id));
+    }
+
+    const auto index = std::make_shared<Index>(segments);
+    _indexes.push_back(index);
+    return index;
+  }
+
+  // Returns the indexes that were built on exactly the given segments, in this order.
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(
+      const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
+
+  // Same as get_indexes(segments), but with the segments of the given columns.
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
+
+  // Returns all indexes of the chunk.
+  const std::vector<std::shared_ptr<BaseIndex>>& indexes() const;
+
+  void remove_index(const std::shared_ptr<BaseIndex>& index);
+
+  // Sets the statistics of the chunk's segments, one entry per column. Entries may be nullptr, e.g., for empty
+  // segments.
+  void set_statistics(std::vector<std::shared_ptr<const BaseSegmentStatistics>> statistics);
+
+  // Returns the statistics of the chunk's segments. The vector is empty if no statistics were set, e.g., because the
+  // chunk is still mutable.
+  const std::vector<std::shared_ptr<const BaseSegmentStatistics>>& statistics() const;
+
+  // Records the encoding of the chunk's segments, one entry per column.
+  void set_encoding_types(std::vector<EncodingType> encoding_types);
+
+  // Returns the encodings of the chunk's segments, as chosen by Table::compress_chunk. The vector is empty if the chunk
+  // was not compressed.
+  const std::vector<EncodingType>& encoding_types() const;
+
+  // Attaches the MVCC data of the chunk's rows. Only chunks of tables that use MVCC have it.
+  void set_mvcc_data(std::shared_ptr<MvccData> mvcc_data);
+
+  // Returns the MVCC data, or nullptr if the chunk has none.
+  const std::shared_ptr<MvccData>& mvcc_data() const;
+
+  bool has_mvcc_data() const;
+
+  // Attaches the storage that holds the fixed-width arrays of the segments of a compressed chunk with
+  // ChunkLayout::Contiguous.
+  void set_contiguous_storage(std::shared_ptr<const ContiguousChunkStorage> storage);
+
+  // Returns the contiguous storage of the fixed-width arrays of the chunk's segments, or nullptr if there is none.
+  const std::shared_ptr<const ContiguousChunkStorage>& contiguous_storage() const;
+
+  // Returns the number of rows that are invalid, i.e., were deleted by a committed transaction or inserted by a
+  // transaction that rolled back. The rows stay in the chunk, their MVCC data hides them (see Validate).
+  ChunkOffset invalid_row_count() const;
+
+  // Called by transactions when they commit or roll back. The count is only maintained for chunks with MVCC data. It
+  // is kept in the MvccData, which a compressed chunk shares with the chunk it replaces, so that increases by
+  // transactions that still hold the old chunk are not lost.
+  void increase_invalid_row_count(const ChunkOffset count) const;
+
+  // Returns the id of the commit that invalidated all rows of the chunk, because they were moved to another chunk by
+  // the ChunkCompactor, or MAX_COMMIT_ID if the chunk was not compacted. Transactions whose snapshot includes this
+  // commit can skip the chunk.
+  CommitID cleanup_commit_id() const;
+
+  void set_cleanup_commit_id(const CommitID commit_id);
+
+  // Returns the estimated memory usage of the chunk's segments, MVCC data, and indexes. Position lists that are shared
+  // by multiple ReferenceSegments are counted once.
+  size_t memory_usage() const;
+
  protected:
   std::vector<std::shared_ptr<AbstractSegment>> _segments;
+  std::vector<std::shared_ptr<BaseIndex>> _indexes;
+  std::vector<std::shared_ptr<const BaseSegmentStatistics>> _statistics;
+  std::vector<EncodingType> _encoding_types;
+  std::shared_ptr<MvccData> _mvcc_data;
+  std::shared_ptr<const ContiguousChunkStorage> _contiguous_storage;
+  std::atomic<CommitID> _cleanup_commit_id{MAX_COMMIT_ID};
 };
 
 }  // namespace opossum
@@ -0,0 +1,159 @@
+#include "chunk_compactor.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chunk.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "mvcc_data.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage_manager.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Creates a chunk with the given rows of the input chunk in ValueSegments. Without offsets, the chunk is empty.
+std::shared_ptr<Chunk> copy_rows(const Table& table, const Chunk& input_chunk,
+                                 const std::vector<ChunkOffset>& chunk_offsets) {
+  auto chunk = std::make_shared<Chunk>();
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      const auto segment = std::make_shared<ValueSegment<Type>>(table.column_is_nullable(column_id));
+      segment->reserve(static_cast<ChunkOffset>(chunk_offsets.size()));
+      const auto& input_segment = *input_chunk.get_segment(column_id);
+      for (const auto chunk_offset : chunk_offsets) {
+        segment->append(input_segment[chunk_offset]);
+      }
+      chunk->add_segment(segment);
+    });
+  }
+  return chunk;
+}
+
+}  // namespace
+
+ChunkCompactor::ChunkCompactor(const float invalidation_threshold, const EncodingType encoding_type)
+    : _invalidation_threshold(invalidation_threshold), _encoding_type(encoding_type) {
+  Assert(invalidation_threshold > 0.0f && invalidation_threshold <= 1.0f, "Threshold has to be in (0, 1]");
+}
+
+std::vector<std::shared_ptr<JobTask>> ChunkCompactor::create_tasks() const {
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    const auto table = storage_manager.get_table(table_name);
+    if (!table->uses_mvcc()) continue;
+
+    tasks.push_back(std::make_shared<JobTask>([table] { retire_compacted_chunks(*table); }, SchedulePriority::Low));
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (!should_compact(*table->get_chunk(chunk_id))) continue;
+      tasks.push_back(std::make_shared<JobTask>([this, table, chunk_id] { compact_chunk(table, chunk_id); },
+                                                SchedulePriority::Low));
+    }
+  }
+  return tasks;
+}
+
+void ChunkCompactor::run() const { CurrentScheduler::schedule_and_wait_for_tasks(create_tasks()); }
+
+bool ChunkCompactor::should_compact(const Chunk& chunk) const {
+  const auto& mvcc_data = chunk.mvcc_data();
+  // Chunks that are not full may still receive rows.
+  if (!mvcc_data || chunk.size() == 0 || chunk.size() < mvcc_data->capacity()) return false;
+  if (chunk.cleanup_commit_id() != MAX_COMMIT_ID) return false;
+  return static_cast<float>(chunk.invalid_row_count()) >= _invalidation_threshold * static_cast<float>(chunk.size());
+}
+
+bool ChunkCompactor::compact_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id) const {
+  const auto chunk = table->get_chunk(chunk_id);
+  if (!should_compact(*chunk)) return false;
+  const auto& mvcc_data = *chunk->mvcc_data();
+  const auto chunk_size = chunk->size();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto transaction_id = context->transaction_id();
+  const auto snapshot_commit_id = context->snapshot_commit_id();
+
+  // Rows that are not visible to the snapshot yet would be lost, as they become visible only after the compaction.
+  // These are the rows of running transactions and of transactions that are committing right now, which set the begin
+  // commit ids of their rows before they publish their commit id. Taking the snapshot first ensures that the latter are
+  // seen. Rows of transactions that rolled back have an end commit id of 0 and can be dropped.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (mvcc_data.begin_cid(chunk_offset) > snapshot_commit_id && mvcc_data.end_cid(chunk_offset) != 0) {
+      context->rollback();
+      return false;
+    }
+  }
+
+  auto live_chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (!Validate::is_row_visible(transaction_id, snapshot_commit_id, mvcc_data.tid(chunk_offset),
+                                  mvcc_data.begin_cid(chunk_offset), mvcc_data.end_cid(chunk_offset))) {
+      continue;
+    }
+
+    // Lock the live rows like Delete does. If another transaction is deleting one of them, try again later.
+    auto expected = INVALID_TRANSACTION_ID;
+    if (!chunk->mvcc_data()->compare_exchange_tid(chunk_offset, expected, transaction_id)) {
+      context->rollback();
+      return false;
+    }
+    context->register_delete(table, RowID{chunk_id, chunk_offset});
+    live_chunk_offsets.push_back(chunk_offset);
+  }
+
+  if (!live_chunk_offsets.empty()) {
+    const auto live_row_count = static_cast<ChunkOffset>(live_chunk_offsets.size());
+    const auto compacted_chunk = copy_rows(*table, *chunk, live_chunk_offsets);
+    const auto compacted_mvcc_data = std::make_shared<MvccData>(live_row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < live_row_count; ++chunk_offset) {
+      compacted_mvcc_data->append(transaction_id, MAX_COMMIT_ID);
+    }
+    compacted_chunk->set_mvcc_data(compacted_mvcc_data);
+
+    const auto compacted_chunk_id = table->emplace_chunk(compacted_chunk);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < live_row_count; ++chunk_offset) {
+      context->register_insert(table, RowID{compacted_chunk_id, chunk_offset});
+    }
+    table->compress_chunk(compacted_chunk_id, _encoding_type);
+  }
+
+  context->commit();
+  table->get_chunk(chunk_id)->set_cleanup_commit_id(context->commit_id());
+  return true;
+}
+
+size_t ChunkCompactor::retire_compacted_chunks(Table& table) {
+  const auto lowest_snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+  auto retired_chunk_count = size_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto cleanup_commit_id = chunk->cleanup_commit_id();
+    // Transactions with a snapshot at or below the compaction's commit id may still read the old rows, e.g., through
+    // the ReferenceSegments of their outputs. Chunks that were not compacted have a cleanup commit id of MAX_COMMIT_ID.
+    if (cleanup_commit_id >= lowest_snapshot_commit_id || chunk->size() == 0) continue;
+
+    const auto empty_chunk = copy_rows(table, *chunk, {});
+    empty_chunk->set_mvcc_data(std::make_shared<MvccData>(0));
+    empty_chunk->set_cleanup_commit_id(cleanup_commit_id);
+    table.replace_chunk(chunk_id, empty_chunk);
+    ++retired_chunk_count;
+  }
+  return retired_chunk_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class JobTask;
+class Table;
+
+// The ChunkCompactor removes invalidated rows (see Delete) from the chunks of tables that use MVCC, so that scans do
+// not pay for them anymore. Compaction happens in two steps:
+//
+// 1. Full chunks in which at least the invalidation threshold of the rows is invalid are compacted. In a transaction,
+//    the live rows are copied into a new chunk, which is compressed and appended to the table, and the old versions
+//    are deleted. Thus, transactions see either the old or the new chunk, and readers are never blocked. The old chunk
+//    is marked with the commit id (see Chunk::cleanup_commit_id), so that Validate skips it for later snapshots. If
+//    other transactions still modify the chunk, it is skipped and compacted later.
+// 2. Compacted chunks are retired, i.e., atomically replaced by empty chunks, once no active transaction has a
+//    snapshot at or below that commit id. Until then, ReferenceSegments of those transactions may still resolve rows
+//    of the old chunk, as they look up the chunks of their referenced table only when they are read. Chunk ids stay
+//    stable, and readers that still hold the old chunk keep it alive. Thus, outputs that reference a table that uses
+//    MVCC must not be read after their transaction ended.
+//
+// The mutable last chunk of the table is sealed when the compacted chunk is appended (see Table::emplace_chunk).
+//
+// The compactor runs as low-priority tasks (see SchedulePriority), so it only uses workers that are idle otherwise.
+class ChunkCompactor {
+ public:
+  static constexpr auto DEFAULT_INVALIDATION_THRESHOLD = 0.5f;
+
+  explicit ChunkCompactor(const float invalidation_threshold = DEFAULT_INVALIDATION_THRESHOLD,
+                          const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Creates low-priority tasks that retire the compacted chunks of all tables in the StorageManager that use MVCC and
+  // compact their chunks, one task per table and one per chunk to compact.
+  std::vector<std::shared_ptr<JobTask>> create_tasks() const;
+
+  // Schedules the tasks of create_tasks and waits for them.
+  void run() const;
+
+  // Returns whether the chunk qualifies for compaction.
+  bool should_compact(const Chunk& chunk) const;
+
+  // Compacts the chunk and returns whether this succeeded. Fails if the chunk does not qualify (anymore) or other
+  // transactions are still inserting or deleting its rows.
+  bool compact_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id) const;
+
+  // Retires the compacted chunks of the table that no active transaction can read anymore and returns their number.
+  static size_t retire_compacted_chunks(Table& table);
+
+ protected:
+  const float _invalidation_threshold;
+  const EncodingType _encoding_type;
+};
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#include "contiguous_chunk_storage.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the offset at which an allocation of the given alignment starts if size bytes are in use.
+size_t aligned_offset(const size_t size, const size_t alignment) {
+  const auto step = std::max(alignment, ContiguousChunkStorage::CACHE_LINE_SIZE);
+  return (size + step - 1) / step * step;
+}
+
+// Memory resource that allocates from the default resource, but counts the bytes that the same allocations would take
+// in a ContiguousChunkStorage.
+class MeasuringResource : public std::pmr::memory_resource {
+ public:
+  size_t size() const { return _size; }
+
+ protected:
+  void* do_allocate(const size_t bytes, const size_t alignment) override {
+    _size = aligned_offset(_size, alignment) + bytes;
+    return std::pmr::get_default_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) override {
+    std::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  size_t _size{0};
+};
+
+// Returns a copy of the segment whose fixed-width arrays live in the memory resource, or nullptr if the segment has
+// no such arrays, i.e., for unencoded string segments and ReferenceSegments.
+std::shared_ptr<AbstractSegment> copy_segment(const AbstractSegment& segment,
+                                              const std::shared_ptr<std::pmr::memory_resource>& memory_resource) {
+  if (dynamic_cast<const ValueSegment<std::string>*>(&segment) || segment.size() == 0) return nullptr;
+
+  auto copy = std::shared_ptr<AbstractSegment>{};
+  hana::for_each(types, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (copy) return;
+    if (const auto value_segment = dynamic_cast<const ValueSegment<Type>*>(&segment)) {
+      copy = std::make_shared<ValueSegment<Type>>(*value_segment, memory_resource);
+    } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+      copy = std::make_shared<DictionarySegment<Type>>(*dictionary_segment, memory_resource);
+    } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<Type>*>(&segment)) {
+      copy = std::make_shared<RunLengthSegment<Type>>(*run_length_segment, memory_resource);
+    } else if constexpr (is_frame_of_reference_supported_v<Type>) {
+      if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<Type>*>(&segment)) {
+        copy = std::make_shared<FrameOfReferenceSegment<Type>>(*frame_of_reference_segment, memory_resource);
+      }
+    }
+  });
+  return copy;
+}
+
+}  // namespace
+
+std::shared_ptr<ContiguousChunkStorage> ContiguousChunkStorage::store_segments(
+    std::vector<std::shared_ptr<AbstractSegment>>& segments) {
+  // Copying a segment allocates the same arrays in the same order every time. Thus, copying all segments once with a
+  // MeasuringResource yields the exact size of the storage.
+  auto measuring_resource = MeasuringResource{};
+  // Non-owning, the copies are destroyed right away.
+  const auto measuring_resource_pointer =
+      std::shared_ptr<std::pmr::memory_resource>{std::shared_ptr<void>{}, &measuring_resource};
+  for (const auto& segment : segments) {
+    copy_segment(*segment, measuring_resource_pointer);
+  }
+  if (measuring_resource.size() == 0) return nullptr;
+
+  const auto storage = std::make_shared<ContiguousChunkStorage>(measuring_resource.size());
+  const auto column_count = segments.size();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    storage->_current_column_id = column_id;
+    if (auto copy = copy_segment(*segments[column_id], storage)) segments[column_id] = std::move(copy);
+  }
+  DebugAssert(storage->size() == storage->capacity(), "Copies allocated differently than measured");
+  return storage;
+}
+
+ContiguousChunkStorage::ContiguousChunkStorage(const size_t capacity)
+    : _data(static_cast<std::byte*>(::operator new(capacity, std::align_val_t{CACHE_LINE_SIZE}))),
+      _capacity(capacity) {}
+
+ContiguousChunkStorage::~ContiguousChunkStorage() { ::operator delete(_data, std::align_val_t{CACHE_LINE_SIZE}); }
+
+const std::byte* ContiguousChunkStorage::data() const { return _data; }
+
+size_t ContiguousChunkStorage::size() const { return _size; }
+
+size_t ContiguousChunkStorage::capacity() const { return _capacity; }
+
+const std::vector<ContiguousChunkStorage::DirectoryEntry>& ContiguousChunkStorage::directory() const {
+  return _directory;
+}
+
+void* ContiguousChunkStorage::do_allocate(const size_t bytes, const size_t alignment) {
+  const auto offset = aligned_offset(_size, alignment);
+  Assert(offset + bytes <= _capacity, "ContiguousChunkStorage is full, its segments must not grow");
+  _size = offset + bytes;
+  _directory.push_back({_current_column_id, offset, bytes});
+  return _data + offset;
+}
+
+void ContiguousChunkStorage::do_deallocate(void* /*pointer*/, const size_t /*bytes*/, const size_t /*alignment*/) {
+  // Memory is only released when the storage is destroyed.
+}
+
+bool ContiguousChunkStorage::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace opossum
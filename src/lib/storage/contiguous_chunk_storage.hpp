@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// ContiguousChunkStorage holds the fixed-width arrays of the segments of a compressed chunk in a single
+// cache-line-aligned allocation, similar to the PAX layout: the rows are still stored column by column, but the
+// columns of a chunk are adjacent in memory. Compared to one heap allocation per array, this saves allocations, lets
+// the hardware prefetcher continue from one segment into the next in multi-column scans, and allows writing all
+// fixed-width data of a chunk at once. The directory tells where each array lies.
+//
+// Table::compress_chunk creates the storage for tables with ChunkLayout::Contiguous. It holds the values of unencoded
+// int, long, float, and double segments, the attribute vectors and numeric dictionaries of DictionarySegments, the end
+// positions, NULL flags, and numeric values of RunLengthSegments, the block minima and packed offsets of
+// FrameOfReferenceSegments, and all NULL bitmaps. Strings, i.e., unencoded string segments, StringDictionaries, and
+// the values of string RunLengthSegments, keep their own allocations.
+//
+// The storage is a memory resource that the std::pmr::vectors of the segments live in. It is sized exactly and never
+// grows, and deallocation is a no-op, so the segments must not be modified.
+class ContiguousChunkStorage : public std::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr auto CACHE_LINE_SIZE = size_t{64};
+
+  // Location of an array, in bytes relative to data(). Offsets are multiples of CACHE_LINE_SIZE. The arrays of a
+  // segment are listed in the order the segment's copy constructor allocates them, e.g., values before NULL bitmap.
+  struct DirectoryEntry {
+    ColumnID column_id;
+    size_t offset;
+    size_t size;
+  };
+
+  // Replaces the segments of a chunk, which are indexed by their ColumnID, with copies whose fixed-width arrays live in
+  // a new storage, and returns the storage. Returns nullptr if no segment has such arrays.
+  static std::shared_ptr<ContiguousChunkStorage> store_segments(
+      std::vector<std::shared_ptr<AbstractSegment>>& segments);
+
+  explicit ContiguousChunkStorage(const size_t capacity);
+  ~ContiguousChunkStorage() override;
+
+  // Returns the start of the allocation.
+  const std::byte* data() const;
+
+  // Returns the number of bytes in use, including the padding that aligns each array.
+  size_t size() const;
+
+  size_t capacity() const;
+
+  const std::vector<DirectoryEntry>& directory() const;
+
+ protected:
+  void* do_allocate(const size_t bytes, const size_t alignment) override;
+  void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  std::byte* _data;
+  const size_t _capacity;
+  size_t _size{0};
+  std::vector<DirectoryEntry> _directory;
+  // The column whose segment is being copied, see store_segments.
+  ColumnID _current_column_id{0};
+};
+
+}  // namespace opossum
@@ -1,6 +1,12 @@
 #include "dictionary_segment.hpp"
 #include <algorithm>
+#include <memory>
+#include <memory_resource>
 #include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include "fixed_width_attribute_vector.hpp"
 #include "resolve_type.hpp"
 #include "type_cast.hpp"
@@ -9,21 +15,41 @@
 
 namespace opossum {
 
+namespace {
+
+// Returns a copy of the dictionary. Vectors are copied into the memory resource, which cannot hold the strings of a
+// StringDictionary.
+template <typename Dictionary>
+Dictionary copy_dictionary(const Dictionary& dictionary, std::pmr::memory_resource* memory_resource) {
+  if constexpr (std::is_same_v<Dictionary, StringDictionary>) {
+    return dictionary;
+  } else {
+    return Dictionary(dictionary, memory_resource);
+  }
+}
+
+}  // namespace
+
 template <typename T>
 DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
   DebugAssert(abstract_segment->size() > 0, "Input segment must contain values.");
 
   // For now, we can assume to only receive a ValueSegment
   const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(abstract_segment);
-  const auto values = value_segment->values();
-  std::set<T> distinct_values(values.begin(), values.end());
+  const auto& values = value_segment->values();
+  const auto value_segment_size = value_segment->size();
+  _nullable = value_segment->is_nullable();
 
-  // Populate the _dictionary with the unique values.
-  _dictionary.reserve(distinct_values.size());
-  std::copy(distinct_values.begin(), distinct_values.end(), std::back_inserter(_dictionary));
+  // NULL rows hold a placeholder in the value vector, which must not end up in the dictionary.
+  std::set<T> distinct_values;
+  for (size_t index = 0; index < value_segment_size; ++index) {
+    if (!value_segment->is_null(index)) distinct_values.insert(values[index]);
+  }
+  auto sorted_values = std::vector<T>(distinct_values.begin(), distinct_values.end());
+  const auto null_value_id = static_cast<ValueID>(sorted_values.size());
 
-  // Initialize the _attribute_vector based on the number of unique values.
-  const auto value_segment_size = value_segment->size();
+  // Initialize the _attribute_vector based on the number of unique values. The null value id is less than the segment
+  // size as well, since at least one row is NULL if it is used.
   resolve_fixed_width_integer_type<uint8_t, uint16_t, uint32_t>(value_segment_size, [&](auto type) {
     using DataType = typename decltype(type)::type;
     _attribute_vector = std::make_shared<FixedWidthAttributeVector<DataType>>(value_segment_size);
@@ -31,32 +57,56 @@ DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>&
 
   // Populate the _attribute_vector with the offsets.
   for (size_t index = 0; index < value_segment_size; ++index) {
+    if (value_segment->is_null(index)) {
+      _attribute_vector->set(index, null_value_id);
+      continue;
+    }
     // Do binary search to find insert position
-    auto find_iterator = std::lower_bound(_dictionary.cbegin(), _dictionary.cend(), values[index]);
-    _attribute_vector->set(index, static_cast<ValueID>(std::distance(_dictionary.cbegin(), find_iterator)));
+    auto find_iterator = std::lower_bound(sorted_values.cbegin(), sorted_values.cend(), values[index]);
+    _attribute_vector->set(index, static_cast<ValueID>(std::distance(sorted_values.cbegin(), find_iterator)));
   }
+
+  // Populate the _dictionary with the unique values.
+  if constexpr (std::is_same_v<T, std::string>) {
+    _dictionary = StringDictionary{sorted_values};
+  } else {
+    _dictionary.assign(sorted_values.cbegin(), sorted_values.cend());
+  }
+}
+
+template <typename T>
+DictionarySegment<T>::DictionarySegment(const DictionarySegment& segment,
+                                        const std::shared_ptr<std::pmr::memory_resource>& memory_resource)
+    : _memory_resource(memory_resource),
+      _dictionary(copy_dictionary(segment._dictionary, memory_resource.get())),
+      _nullable(segment._nullable) {
+  resolve_attribute_vector(*segment._attribute_vector, [&](const auto& attribute_vector) {
+    using AttributeVector = std::decay_t<decltype(attribute_vector)>;
+    _attribute_vector = std::make_shared<AttributeVector>(attribute_vector, memory_resource);
+  });
 }
 
 template <typename T>
 AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
   const auto dictionary_offset = _attribute_vector->get(chunk_offset);
+  if (dictionary_offset == null_value_id()) return NULL_VALUE;
   return _dictionary[dictionary_offset];
 }
 
 template <typename T>
 T DictionarySegment<T>::get(const ChunkOffset chunk_offset) const {
   const auto dictionary_offset = _attribute_vector->get(chunk_offset);
-  Assert(dictionary_offset <= _dictionary.size(), "cannot find value at given index");
+  Assert(dictionary_offset < _dictionary.size(), "cannot find value at given index");
   return _dictionary[dictionary_offset];
 }
 
 template <typename T>
-void DictionarySegment<T>::append(const AllTypeVariant& value) {
+void DictionarySegment<T>::append(const TaggedValue& value) {
   Fail("Dictionary segments are immutable, i.e., values cannot be appended.");
 }
 
 template <typename T>
-const std::vector<T>& DictionarySegment<T>::dictionary() const {
+const typename DictionarySegment<T>::Dictionary& DictionarySegment<T>::dictionary() const {
   return _dictionary;
 }
 
@@ -72,11 +122,16 @@ const T DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
 
 template <typename T>
 ValueID DictionarySegment<T>::lower_bound(const T value) const {
-  const auto lower_bound = std::lower_bound(_dictionary.begin(), _dictionary.end(), value);
-  if (lower_bound == _dictionary.end()) {
-    return INVALID_VALUE_ID;
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto lower_bound = _dictionary.lower_bound(value);
+    return lower_bound == _dictionary.size() ? INVALID_VALUE_ID : static_cast<ValueID>(lower_bound);
+  } else {
+    const auto lower_bound = std::lower_bound(_dictionary.begin(), _dictionary.end(), value);
+    if (lower_bound == _dictionary.end()) {
+      return INVALID_VALUE_ID;
+    }
+    return static_cast<ValueID>(std::distance(_dictionary.begin(), lower_bound));
   }
-  return static_cast<ValueID>(std::distance(_dictionary.begin(), lower_bound));
 }
 
 template <typename T>
@@ -86,11 +141,16 @@ ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
 
 template <typename T>
 ValueID DictionarySegment<T>::upper_bound(const T value) const {
-  const auto upper_bound = std::upper_bound(_dictionary.begin(), _dictionary.end(), value);
-  if (upper_bound == _dictionary.end()) {
-    return INVALID_VALUE_ID;
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto upper_bound = _dictionary.upper_bound(value);
+    return upper_bound == _dictionary.size() ? INVALID_VALUE_ID : static_cast<ValueID>(upper_bound);
+  } else {
+    const auto upper_bound = std::upper_bound(_dictionary.begin(), _dictionary.end(), value);
+    if (upper_bound == _dictionary.end()) {
+      return INVALID_VALUE_ID;
+    }
+    return static_cast<ValueID>(std::distance(_dictionary.begin(), upper_bound));
   }
-  return static_cast<ValueID>(std::distance(_dictionary.begin(), upper_bound));
 }
 
 template <typename T>
@@ -103,6 +163,16 @@ ChunkOffset DictionarySegment<T>::unique_values_count() const {
   return static_cast<ChunkOffset>(_dictionary.size());
 }
 
+template <typename T>
+ValueID DictionarySegment<T>::null_value_id() const {
+  return static_cast<ValueID>(_dictionary.size());
+}
+
+template <typename T>
+bool DictionarySegment<T>::is_nullable() const {
+  return _nullable;
+}
+
 template <typename T>
 ChunkOffset DictionarySegment<T>::size() const {
   return static_cast<ChunkOffset>(_attribute_vector->size());
@@ -110,7 +180,12 @@ ChunkOffset DictionarySegment<T>::size() const {
 
 template <typename T>
 size_t DictionarySegment<T>::estimate_memory_usage() const {
-  return sizeof(T) * _dictionary.size() + _attribute_vector->width() * _attribute_vector->size();
+  const auto attribute_vector_size = _attribute_vector->width() * _attribute_vector->size();
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _dictionary.estimate_memory_usage() + attribute_vector_size;
+  } else {
+    return sizeof(T) * _dictionary.size() + attribute_vector_size;
+  }
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySegment);
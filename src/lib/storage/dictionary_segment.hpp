@@ -2,12 +2,15 @@
 
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-#include "abstract_segment.hpp"
 #include "all_type_variant.hpp"
+#include "base_dictionary_segment.hpp"
+#include "string_dictionary.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -18,29 +21,38 @@ class AbstractAttributeVector;
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max().
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// Dictionary is a specific segment type that stores all its values in a vector
+// Dictionary is a specific segment type that stores all its values in a vector. NULL is not part of the dictionary,
+// NULL rows are stored as null_value_id() in the attribute vector instead.
 template <typename T>
-class DictionarySegment : public AbstractSegment {
+class DictionarySegment : public BaseDictionarySegment {
  public:
+  // Strings are stored in a StringDictionary, all other types in a vector.
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, StringDictionary, std::pmr::vector<T>>;
+
   /**
    * Creates a Dictionary segment from a given value segment.
    */
   explicit DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
 
+  // Copies the attribute vector and, except for strings, the dictionary into the given memory resource, which the new
+  // segment keeps alive (see ContiguousChunkStorage).
+  DictionarySegment(const DictionarySegment& segment,
+                    const std::shared_ptr<std::pmr::memory_resource>& memory_resource);
+
   // Return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
 
-  // Return the value at a certain position.
+  // Return the value at a certain position. The row must not be NULL.
   T get(const ChunkOffset chunk_offset) const;
 
   // Dictionary segments are immutable.
-  void append(const AllTypeVariant& value) override;
+  void append(const TaggedValue& value) override;
 
   // Returns an underlying dictionary.
-  const std::vector<T>& dictionary() const;
+  const Dictionary& dictionary() const;
 
   // Returns an underlying data structure.
-  std::shared_ptr<const AbstractAttributeVector> attribute_vector() const;
+  std::shared_ptr<const AbstractAttributeVector> attribute_vector() const override;
 
   // Return the value represented by a given ValueID.
   const T value_of_value_id(const ValueID value_id) const;
@@ -50,17 +62,22 @@ class DictionarySegment : public AbstractSegment {
   ValueID lower_bound(const T value) const;
 
   // Same as lower_bound(T), but accepts an AllTypeVariant.
-  ValueID lower_bound(const AllTypeVariant& value) const;
+  ValueID lower_bound(const AllTypeVariant& value) const override;
 
   // Returns the first value ID that refers to a value > the search value. Returns INVALID_VALUE_ID if all values are
   // smaller than or equal to the search value.
   ValueID upper_bound(const T value) const;
 
   // Same as upper_bound(T), but accepts an AllTypeVariant.
-  ValueID upper_bound(const AllTypeVariant& value) const;
+  ValueID upper_bound(const AllTypeVariant& value) const override;
 
   // Return the number of unique_values (dictionary entries).
-  ChunkOffset unique_values_count() const;
+  ChunkOffset unique_values_count() const override;
+
+  ValueID null_value_id() const override;
+
+  // Returns whether the segment was created from a nullable segment, i.e., whether rows can be NULL.
+  bool is_nullable() const;
 
   // Return the number of entries.
   ChunkOffset size() const override;
@@ -69,8 +86,11 @@ class DictionarySegment : public AbstractSegment {
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _dictionary;
+  // Declared first, as the dictionary has to be destroyed before the memory resource it lives in.
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+  Dictionary _dictionary;
   std::shared_ptr<AbstractAttributeVector> _attribute_vector;
+  bool _nullable{false};
 };
 
 }  // namespace opossum
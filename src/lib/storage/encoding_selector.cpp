@@ -0,0 +1,169 @@
+#include "encoding_selector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <map>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Relative cost of scanning a row, with an unencoded row as the reference. Dictionary scans compare integers after a
+// single lookup in the dictionary, frame-of-reference scans have to unpack the offsets. Run-length scans evaluate each
+// run once, but have to locate runs by binary search for positions of references.
+constexpr auto UNENCODED_SCAN_COST = 1.0f;
+constexpr auto DICTIONARY_SCAN_COST = 1.1f;
+constexpr auto FRAME_OF_REFERENCE_SCAN_COST = 1.3f;
+constexpr auto RUN_LENGTH_SCAN_COST_PER_ROW = 0.1f;
+constexpr auto RUN_LENGTH_SCAN_COST_PER_RUN = 2.0f;
+
+template <typename T>
+size_t value_size(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return sizeof(std::string) + value.size();
+  } else {
+    return sizeof(T);
+  }
+}
+
+// Properties of a segment that are extrapolated from the sample.
+struct SegmentSample {
+  float row_count{0.0f};
+  float distinct_count{0.0f};
+  float run_count{0.0f};
+  float average_value_size{0.0f};
+  // Only set for frame-of-reference compatible types: the estimated largest value range within a block.
+  uint64_t max_block_range{0};
+};
+
+template <typename T>
+SegmentSample sample_segment(const ValueSegment<T>& segment) {
+  const auto& values = segment.values();
+  const auto row_count = static_cast<ChunkOffset>(values.size());
+  const auto window_size = std::min(EncodingSelector::SAMPLE_WINDOW_SIZE, row_count);
+  const auto window_count =
+      window_size == 0 ? ChunkOffset{0} : std::min(EncodingSelector::SAMPLE_WINDOW_COUNT, row_count / window_size);
+
+  auto value_counts = std::unordered_map<T, ChunkOffset>{};
+  auto sampled_rows = ChunkOffset{0};
+  auto sampled_runs = ChunkOffset{0};
+  auto sampled_value_size = size_t{0};
+  auto max_window_range = uint64_t{0};
+  auto sample_min = std::optional<T>{};
+  auto sample_max = std::optional<T>{};
+
+  for (auto window_index = ChunkOffset{0}; window_index < window_count; ++window_index) {
+    // Windows are spread evenly, the last one ends at the end of the segment.
+    const auto window_begin = static_cast<ChunkOffset>(
+        window_count == 1 ? 0 : uint64_t{row_count - window_size} * window_index / (window_count - 1));
+    const auto window_end = window_begin + window_size;
+
+    for (auto offset = window_begin; offset < window_end; ++offset) {
+      const auto& value = values[offset];
+      ++value_counts[value];
+      sampled_value_size += value_size(value);
+      sampled_runs += offset == window_begin || !(values[offset - 1] == value);
+    }
+    sampled_rows += window_size;
+
+    if constexpr (is_frame_of_reference_supported_v<T>) {
+      using OffsetType = std::make_unsigned_t<T>;
+      const auto [min, max] = std::minmax_element(values.cbegin() + window_begin, values.cbegin() + window_end);
+      // The difference is computed unsigned, as it overflows T for segments that hold, e.g., both extremes of T.
+      const auto window_range = static_cast<OffsetType>(static_cast<OffsetType>(*max) - static_cast<OffsetType>(*min));
+      max_window_range = std::max(max_window_range, uint64_t{window_range});
+      sample_min = sample_min ? std::min(*sample_min, *min) : *min;
+      sample_max = sample_max ? std::max(*sample_max, *max) : *max;
+    }
+  }
+
+  auto sample = SegmentSample{};
+  if (sampled_rows == 0) return sample;
+
+  const auto scale = static_cast<float>(row_count) / static_cast<float>(sampled_rows);
+  sample.row_count = static_cast<float>(row_count);
+  sample.run_count = static_cast<float>(sampled_runs) * scale;
+  sample.average_value_size = static_cast<float>(sampled_value_size) / static_cast<float>(sampled_rows);
+
+  // Values seen more than once in the sample are assumed to be frequent and already known. Values seen only once are
+  // assumed to be unique and are extrapolated linearly. This overestimates the distinct count of skewed data, which
+  // errs on the side of not encoding with a dictionary that would turn out larger than the values.
+  const auto singletons = std::count_if(value_counts.cbegin(), value_counts.cend(),
+                                        [](const auto& value_count) { return value_count.second == 1; });
+  const auto repeated = value_counts.size() - static_cast<size_t>(singletons);
+  const auto estimated_distinct_count = scale * static_cast<float>(singletons) + static_cast<float>(repeated);
+  sample.distinct_count =
+      std::clamp(estimated_distinct_count, static_cast<float>(value_counts.size()), sample.row_count);
+
+  if constexpr (is_frame_of_reference_supported_v<T>) {
+    // The range within a window grows roughly linearly with its length for sorted data. It cannot exceed the range of
+    // all sampled values, which is reached quickly for unsorted data.
+    using OffsetType = std::make_unsigned_t<T>;
+    const auto block_size = std::min(FrameOfReferenceSegment<T>::BLOCK_SIZE, row_count);
+    const auto scaled_range = static_cast<double>(max_window_range) * block_size / window_size;
+    const auto sample_range = uint64_t{
+        static_cast<OffsetType>(static_cast<OffsetType>(*sample_max) - static_cast<OffsetType>(*sample_min))};
+    sample.max_block_range = scaled_range >= static_cast<double>(sample_range)
+                                 ? sample_range
+                                 : std::max(max_window_range, static_cast<uint64_t>(scaled_range));
+  }
+
+  return sample;
+}
+
+}  // namespace
+
+EncodingType EncodingSelector::select(const std::string& data_type, const AbstractSegment& value_segment) const {
+  const auto costs = estimate_costs(data_type, value_segment);
+  DebugAssert(!costs.empty(), "At least one encoding has to be supported");
+  const auto cheapest = std::min_element(costs.cbegin(), costs.cend(),
+                                         [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+  return cheapest->first;
+}
+
+std::map<EncodingType, float> EncodingSelector::estimate_costs(const std::string& data_type,
+                                                               const AbstractSegment& value_segment) const {
+  auto costs = std::map<EncodingType, float>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    const auto* typed_segment = dynamic_cast<const ValueSegment<DataType>*>(&value_segment);
+    Assert(typed_segment, "Only ValueSegments can be encoded");
+
+    const auto sample = sample_segment(*typed_segment);
+    const auto row_count = sample.row_count;
+
+    const auto unencoded_size = row_count * sample.average_value_size;
+    costs[EncodingType::Unencoded] = unencoded_size * UNENCODED_SCAN_COST;
+
+    // The width of the attribute vector depends on the number of rows, see DictionarySegment.
+    const auto attribute_vector_width = row_count <= 256 ? 1.0f : row_count <= 65536 ? 2.0f : 4.0f;
+    const auto dictionary_size = sample.distinct_count * sample.average_value_size + row_count * attribute_vector_width;
+    costs[EncodingType::Dictionary] = dictionary_size * DICTIONARY_SCAN_COST;
+
+    const auto run_length_size = sample.run_count * (sample.average_value_size + sizeof(ChunkOffset));
+    const auto run_length_scan_cost =
+        RUN_LENGTH_SCAN_COST_PER_ROW + RUN_LENGTH_SCAN_COST_PER_RUN * sample.run_count / std::max(row_count, 1.0f);
+    costs[EncodingType::RunLength] = run_length_size * run_length_scan_cost;
+
+    if constexpr (is_frame_of_reference_supported_v<DataType>) {
+      const auto block_count = std::ceil(row_count / FrameOfReferenceSegment<DataType>::BLOCK_SIZE);
+      const auto bit_width = static_cast<float>(std::bit_width(sample.max_block_range));
+      const auto frame_of_reference_size = block_count * sizeof(DataType) + row_count * bit_width / 8.0f;
+      costs[EncodingType::FrameOfReference] = frame_of_reference_size * FRAME_OF_REFERENCE_SCAN_COST;
+    }
+  });
+  return costs;
+}
+
+}  // namespace opossum
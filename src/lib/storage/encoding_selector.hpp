@@ -0,0 +1,35 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// EncodingSelector picks the encoding for a ValueSegment that is about to be compressed. It does not look at every
+// row, but at SAMPLE_WINDOW_COUNT windows of SAMPLE_WINDOW_SIZE consecutive rows, spread evenly over the segment.
+// Consecutive rows are needed to see runs and the value ranges within frame-of-reference blocks.
+//
+// From the sample, the size of the segment under each supported encoding is estimated. The cost of an encoding is its
+// estimated size multiplied by a relative per-row scan cost, which accounts for the work of decoding. The encoding
+// with the lowest cost is chosen. This is a heuristic: it prefers small segments but does not pick an encoding that
+// saves a few bytes if scanning it is considerably more expensive.
+class EncodingSelector {
+ public:
+  static constexpr auto SAMPLE_WINDOW_COUNT = ChunkOffset{16};
+  static constexpr auto SAMPLE_WINDOW_SIZE = ChunkOffset{64};
+
+  // Returns the encoding with the lowest estimated cost for a ValueSegment of the given data type (e.g., "int").
+  EncodingType select(const std::string& data_type, const AbstractSegment& value_segment) const;
+
+  // Returns the estimated cost of every encoding that is supported for the data type. Lower is better.
+  std::map<EncodingType, float> estimate_costs(const std::string& data_type,
+                                               const AbstractSegment& value_segment) const;
+};
+
+}  // namespace opossum
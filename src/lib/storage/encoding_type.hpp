@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+namespace opossum {
+
+// Encodings that Table::compress_chunk can apply to the segments of a chunk. Unencoded keeps the ValueSegment.
+// FrameOfReference is only supported for int and long columns. Automatic lets the EncodingSelector choose one of the
+// other encodings for each segment; it is never the encoding of a segment.
+enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FrameOfReference, Automatic };
+
+inline std::ostream& operator<<(std::ostream& stream, const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return stream << "Unencoded";
+    case EncodingType::Dictionary:
+      return stream << "Dictionary";
+    case EncodingType::RunLength:
+      return stream << "RunLength";
+    case EncodingType::FrameOfReference:
+      return stream << "FrameOfReference";
+    case EncodingType::Automatic:
+      return stream << "Automatic";
+  }
+  return stream;
+}
+
+}  // namespace opossum
@@ -5,6 +5,11 @@ namespace opossum {
 template <typename T>
 FixedWidthAttributeVector<T>::FixedWidthAttributeVector(const size_t size) : _values(size) {}
 
+template <typename T>
+FixedWidthAttributeVector<T>::FixedWidthAttributeVector(
+    const FixedWidthAttributeVector& other, const std::shared_ptr<std::pmr::memory_resource>& memory_resource)
+    : _memory_resource(memory_resource), _values(other._values, memory_resource.get()) {}
+
 template <typename T>
 ValueID FixedWidthAttributeVector<T>::get(const size_t index) const {
   return static_cast<ValueID>(_values.at(index));
@@ -25,6 +30,11 @@ AttributeVectorWidth FixedWidthAttributeVector<T>::width() const {
   return sizeof(T);
 }
 
+template <typename T>
+const std::pmr::vector<T>& FixedWidthAttributeVector<T>::values() const {
+  return _values;
+}
+
 template class FixedWidthAttributeVector<uint32_t>;
 template class FixedWidthAttributeVector<uint16_t>;
 template class FixedWidthAttributeVector<uint8_t>;
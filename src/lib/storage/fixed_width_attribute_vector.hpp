@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <memory_resource>
 #include <vector>
 #include "abstract_attribute_vector.hpp"
 
@@ -9,6 +11,11 @@ template <typename T>
 class FixedWidthAttributeVector : public AbstractAttributeVector {
  public:
   explicit FixedWidthAttributeVector(const size_t size);
+
+  // Copies the value ids into the given memory resource, which the new vector keeps alive (see
+  // ContiguousChunkStorage).
+  FixedWidthAttributeVector(const FixedWidthAttributeVector& other,
+                            const std::shared_ptr<std::pmr::memory_resource>& memory_resource);
   // returns the value id at a given position
   ValueID get(const size_t index) const override;
 
@@ -21,8 +28,13 @@ class FixedWidthAttributeVector : public AbstractAttributeVector {
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const override;
 
+  // returns the underlying values, e.g., for scans that iterate over all value ids without virtual calls
+  const std::pmr::vector<T>& values() const;
+
  protected:
-  std::vector<T> _values;
+  // Declared first, as the values have to be destroyed before the memory resource they live in.
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+  std::pmr::vector<T> _values;
 };
 
 }  // namespace opossum
@@ -0,0 +1,204 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto WORD_BITS = uint64_t{64};
+
+// Reads the offset at the given index. An offset may span two words. The high part is shifted in two steps so that no
+// shift by 64 bits occurs if the offset starts at a word boundary, in which case the high part becomes zero.
+inline uint64_t unpack_offset(const uint64_t* packed_offsets, const uint64_t index, const uint64_t bit_width,
+                              const uint64_t mask) {
+  const auto bit_position = index * bit_width;
+  const auto word = bit_position / WORD_BITS;
+  const auto shift = bit_position % WORD_BITS;
+  const auto low = packed_offsets[word] >> shift;
+  const auto high = (packed_offsets[word + 1] << 1u) << (WORD_BITS - 1 - shift);
+  return (low | high) & mask;
+}
+
+}  // namespace
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  DebugAssert(abstract_segment->size() > 0, "Input segment must contain values.");
+
+  // Like DictionarySegment, we can assume to only receive a ValueSegment.
+  const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(abstract_segment);
+  const auto& values = value_segment->values();
+  _size = static_cast<ChunkOffset>(values.size());
+  _null_bitmap = value_segment->null_bitmap();
+
+  // First pass: find the minimum of each block and the width needed for the largest offset of all blocks. NULL rows
+  // are skipped, as their placeholder values would widen the offsets.
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima.reserve(block_count);
+  auto max_offset = OffsetType{0};
+  for (auto block_begin = ChunkOffset{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+    if (!_null_bitmap) {
+      const auto [min, max] = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+      _block_minima.push_back(*min);
+      max_offset = std::max(max_offset, static_cast<OffsetType>(static_cast<OffsetType>(*max) - *min));
+      continue;
+    }
+
+    auto min = std::numeric_limits<T>::max();
+    auto max = std::numeric_limits<T>::min();
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      if ((*_null_bitmap)[chunk_offset]) continue;
+      min = std::min(min, values[chunk_offset]);
+      max = std::max(max, values[chunk_offset]);
+    }
+    if (max < min) min = max = T{0};
+    _block_minima.push_back(min);
+    max_offset = std::max(max_offset, static_cast<OffsetType>(static_cast<OffsetType>(max) - min));
+  }
+  _offset_bit_width = static_cast<uint8_t>(std::bit_width(max_offset));
+
+  // Second pass: pack the offsets.
+  const auto bit_width = uint64_t{_offset_bit_width};
+  const auto word_count = (uint64_t{_size} * bit_width + WORD_BITS - 1) / WORD_BITS;
+  _packed_offsets.resize(std::max(word_count + 1, uint64_t{2}));
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    if (is_null(chunk_offset)) continue;
+    const auto block_minimum = static_cast<OffsetType>(_block_minima[chunk_offset / BLOCK_SIZE]);
+    const auto offset = uint64_t{static_cast<OffsetType>(values[chunk_offset] - block_minimum)};
+    const auto bit_position = chunk_offset * bit_width;
+    const auto word = bit_position / WORD_BITS;
+    const auto shift = bit_position % WORD_BITS;
+    _packed_offsets[word] |= offset << shift;
+    if (shift + bit_width > WORD_BITS) {
+      _packed_offsets[word + 1] |= offset >> (WORD_BITS - shift);
+    }
+  }
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const FrameOfReferenceSegment& segment,
+                                                    const std::shared_ptr<std::pmr::memory_resource>& memory_resource)
+    : _memory_resource(memory_resource),
+      _size(segment._size),
+      _offset_bit_width(segment._offset_bit_width),
+      _block_minima(segment._block_minima, memory_resource.get()),
+      _packed_offsets(segment._packed_offsets, memory_resource.get()) {
+  if (segment._null_bitmap) _null_bitmap.emplace(*segment._null_bitmap, memory_resource.get());
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) return NULL_VALUE;
+  return get(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _size, "Offset is out of range");
+  const auto block_minimum = static_cast<OffsetType>(_block_minima[chunk_offset / BLOCK_SIZE]);
+  return static_cast<T>(static_cast<OffsetType>(block_minimum + offset(chunk_offset)));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const TaggedValue& value) {
+  Fail("Frame-of-reference segments are immutable, i.e., values cannot be appended.");
+}
+
+template <typename T>
+const std::pmr::vector<T>& FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+const std::optional<NullBitmap>& FrameOfReferenceSegment<T>::null_bitmap() const {
+  return _null_bitmap;
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return _null_bitmap && (*_null_bitmap)[chunk_offset];
+}
+
+template <typename T>
+uint8_t FrameOfReferenceSegment<T>::offset_bit_width() const {
+  return _offset_bit_width;
+}
+
+template <typename T>
+typename FrameOfReferenceSegment<T>::OffsetType FrameOfReferenceSegment<T>::max_offset() const {
+  return _offset_bit_width == WORD_BITS ? std::numeric_limits<OffsetType>::max()
+                                        : static_cast<OffsetType>((uint64_t{1} << _offset_bit_width) - 1);
+}
+
+template <typename T>
+typename FrameOfReferenceSegment<T>::OffsetType FrameOfReferenceSegment<T>::offset(
+    const ChunkOffset chunk_offset) const {
+  return static_cast<OffsetType>(unpack_offset(_packed_offsets.data(), chunk_offset, _offset_bit_width, max_offset()));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decompress_offsets(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                                    OffsetType* output) const {
+  DebugAssert(begin_offset <= end_offset && end_offset <= _size, "Invalid offset range");
+  const auto* packed_offsets = _packed_offsets.data();
+  const auto bit_width = uint64_t{_offset_bit_width};
+  const auto mask = uint64_t{max_offset()};
+  const auto count = end_offset - begin_offset;
+  for (auto index = ChunkOffset{0}; index < count; ++index) {
+    output[index] = static_cast<OffsetType>(unpack_offset(packed_offsets, begin_offset + index, bit_width, mask));
+  }
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decompress(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                            T* output) const {
+  auto offsets = std::vector<OffsetType>(BLOCK_SIZE);
+  // Blocks are decompressed one at a time so that adding the minimum is a loop over a contiguous buffer.
+  for (auto block_begin = begin_offset; block_begin < end_offset;) {
+    const auto block_id = block_begin / BLOCK_SIZE;
+    const auto block_end = std::min((block_id + 1) * BLOCK_SIZE, end_offset);
+    const auto count = block_end - block_begin;
+    decompress_offsets(block_begin, block_end, offsets.data());
+
+    const auto block_minimum = static_cast<OffsetType>(_block_minima[block_id]);
+    auto* block_output = output + (block_begin - begin_offset);
+    for (auto index = ChunkOffset{0}; index < count; ++index) {
+      block_output[index] = static_cast<T>(static_cast<OffsetType>(block_minimum + offsets[index]));
+    }
+    block_begin = block_end;
+  }
+}
+
+template <typename T>
+std::vector<T> FrameOfReferenceSegment<T>::decompress() const {
+  auto values = std::vector<T>(_size);
+  decompress(ChunkOffset{0}, _size, values.data());
+  return values;
+}
+
+template <typename T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  const auto null_bitmap_size = _null_bitmap ? _null_bitmap->estimate_memory_usage() : size_t{0};
+  return sizeof(T) * _block_minima.capacity() + sizeof(uint64_t) * _packed_offsets.capacity() + null_bitmap_size;
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
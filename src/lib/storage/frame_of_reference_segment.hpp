@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "all_type_variant.hpp"
+#include "null_bitmap.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Frame-of-reference encoding is only defined for integer columns.
+template <typename T>
+constexpr bool is_frame_of_reference_supported_v = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+
+// FrameOfReferenceSegment is an immutable segment type for integer columns whose values lie close together, e.g., ids
+// or timestamps. The rows are split into blocks of BLOCK_SIZE. For each block, the minimum is stored and each row is
+// stored as its (unsigned) offset to the minimum. All offsets of the segment are bit-packed with the same width, which
+// is just large enough for the largest offset. Only int32_t and int64_t are supported. NULL rows are taken over as a
+// NullBitmap from the value segment. They are stored with offset 0 and do not affect the minima.
+template <typename T>
+class FrameOfReferenceSegment : public AbstractSegment {
+ public:
+  using OffsetType = std::make_unsigned_t<T>;
+
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  /**
+   * Creates a FrameOfReferenceSegment from a given value segment.
+   */
+  explicit FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Copies the block minima, the packed offsets, and the NULL bitmap into the given memory resource, which the new
+  // segment keeps alive (see ContiguousChunkStorage).
+  FrameOfReferenceSegment(const FrameOfReferenceSegment& segment,
+                          const std::shared_ptr<std::pmr::memory_resource>& memory_resource);
+
+  // Return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Return the value at a certain position. NULL rows return the minimum of their block.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Frame-of-reference segments are immutable.
+  void append(const TaggedValue& value) override;
+
+  // Returns the minimum of each block. Blocks that only hold NULL rows have a minimum of 0.
+  const std::pmr::vector<T>& block_minima() const;
+
+  // Returns the NULL flags of all rows, or std::nullopt if the segment is not nullable.
+  const std::optional<NullBitmap>& null_bitmap() const;
+
+  // Returns whether the row at the given offset is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the number of bits used per offset.
+  uint8_t offset_bit_width() const;
+
+  // Returns the largest offset that can be stored with the offset bit width.
+  OffsetType max_offset() const;
+
+  // Returns the offset of a row to the minimum of its block.
+  OffsetType offset(const ChunkOffset chunk_offset) const;
+
+  // Writes the offsets of the rows in [begin_offset, end_offset) to output. The loop has no branches and no
+  // dependencies between iterations, so that the compiler can vectorize it.
+  void decompress_offsets(const ChunkOffset begin_offset, const ChunkOffset end_offset, OffsetType* output) const;
+
+  // Writes the values of the rows in [begin_offset, end_offset) to output.
+  void decompress(const ChunkOffset begin_offset, const ChunkOffset end_offset, T* output) const;
+
+  // Returns all values of the segment. NULL rows hold the minimum of their block.
+  std::vector<T> decompress() const;
+
+  // Return the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Declared first, as the vectors have to be destroyed before the memory resource they live in.
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+  ChunkOffset _size{0};
+  uint8_t _offset_bit_width{0};
+  std::pmr::vector<T> _block_minima;
+  // Bit-packed offsets. One additional word at the end allows reading two words for every offset.
+  std::pmr::vector<uint64_t> _packed_offsets;
+  std::optional<NullBitmap> _null_bitmap;
+};
+
+}  // namespace opossum
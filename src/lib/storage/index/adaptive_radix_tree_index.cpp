@@ -0,0 +1,171 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/abstract_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Appends the bytes of an unsigned integer in big-endian order, so that the most significant byte is compared first.
+template <typename Unsigned>
+void append_big_endian(const Unsigned value, BinaryComparableKey& key) {
+  for (auto shift = static_cast<int>(sizeof(Unsigned) * 8) - 8; shift >= 0; shift -= 8) {
+    key.push_back(static_cast<uint8_t>(value >> shift));
+  }
+}
+
+template <typename T>
+void append_binary_comparable(const T& value, BinaryComparableKey& key) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto character : value) {
+      key.push_back(static_cast<uint8_t>(character));
+      if (character == '\0') key.push_back(0xFF);
+    }
+    key.push_back(0x00);
+    key.push_back(0x00);
+  } else if constexpr (std::is_integral_v<T>) {
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = Unsigned{1} << (sizeof(T) * 8 - 1);
+    append_big_endian(static_cast<Unsigned>(static_cast<Unsigned>(value) ^ sign_bit), key);
+  } else {
+    static_assert(std::is_floating_point_v<T>, "Unsupported data type");
+    using Unsigned = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = Unsigned{1} << (sizeof(T) * 8 - 1);
+
+    // -0.0 and 0.0 are equal, but their bits are not.
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = Unsigned{};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+    bits = (bits & sign_bit) ? ~bits : bits | sign_bit;
+    append_big_endian(bits, key);
+  }
+}
+
+}  // namespace
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(
+    const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex(SegmentIndexType::AdaptiveRadixTree), _segments(segments_to_index) {
+  Assert(!_segments.empty(), "AdaptiveRadixTreeIndex needs at least one segment");
+  const auto segment_size = _segments.front()->size();
+  Assert(std::all_of(_segments.cbegin(), _segments.cend(),
+                     [&](const auto& segment) { return segment->size() == segment_size; }),
+         "Indexed segments have to be of the same size");
+
+  for (const auto& segment : _segments) {
+    resolve_segment_data_type(*segment, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      _key_encoders.emplace_back([](const AllTypeVariant& value, BinaryComparableKey& key) {
+        append_binary_comparable(type_cast<Type>(value), key);
+      });
+    });
+  }
+
+  auto entries = std::vector<std::pair<BinaryComparableKey, ChunkOffset>>(segment_size);
+  auto is_null_row = std::vector<bool>(segment_size);
+  const auto column_count = _segments.size();
+  for (auto column_index = size_t{0}; column_index < column_count; ++column_index) {
+    const auto& segment = *_segments[column_index];
+    const auto& key_encoder = _key_encoders[column_index];
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+      const auto value = segment[chunk_offset];
+      if (variant_is_null(value)) {
+        is_null_row[chunk_offset] = true;
+        continue;
+      }
+      key_encoder(value, entries[chunk_offset].first);
+    }
+  }
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    entries[chunk_offset].second = chunk_offset;
+  }
+
+  // NULL never satisfies a lookup, so rows with a NULL in any indexed segment are not indexed.
+  std::erase_if(entries, [&](const auto& entry) { return is_null_row[entry.second]; });
+
+  // Sorting by key and offset yields the order of _chunk_offsets, which the nodes refer to by iterators.
+  std::sort(entries.begin(), entries.end());
+  _chunk_offsets.reserve(entries.size());
+  for (const auto& entry : entries) {
+    _chunk_offsets.push_back(entry.second);
+  }
+
+  if (!entries.empty()) _root = _build(entries, 0, entries.size(), 0);
+}
+
+BinaryComparableKey AdaptiveRadixTreeIndex::encode_key(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() <= _key_encoders.size(), "More values than indexed segments");
+  auto key = BinaryComparableKey{};
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    _key_encoders[value_index](values[value_index], key);
+  }
+  return key;
+}
+
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_build(
+    const std::vector<std::pair<BinaryComparableKey, ChunkOffset>>& entries, const size_t begin, const size_t end,
+    const size_t depth) const {
+  const auto& first_key = entries[begin].first;
+  const auto& last_key = entries[end - 1].first;
+  const auto begin_iter = _chunk_offsets.cbegin() + begin;
+  const auto end_iter = _chunk_offsets.cbegin() + end;
+
+  if (first_key == last_key) return std::make_unique<ARTLeaf>(first_key, begin_iter, end_iter);
+
+  // As the entries are sorted, the prefix that the first and the last key share is shared by all keys in between.
+  // The keys are prefix-free (integers have a fixed width, strings are terminated), so they differ before either ends.
+  const auto [first_mismatch, last_mismatch] =
+      std::mismatch(first_key.cbegin() + depth, first_key.cend(), last_key.cbegin() + depth, last_key.cend());
+  const auto branch_depth = static_cast<size_t>(std::distance(first_key.cbegin(), first_mismatch));
+  auto prefix = BinaryComparableKey(first_key.cbegin() + depth, first_mismatch);
+
+  auto children = ARTInnerNode::Children{};
+  auto child_begin = begin;
+  while (child_begin < end) {
+    const auto byte = entries[child_begin].first[branch_depth];
+    auto child_end = child_begin + 1;
+    while (child_end < end && entries[child_end].first[branch_depth] == byte) {
+      ++child_end;
+    }
+    children.emplace_back(byte, _build(entries, child_begin, child_end, branch_depth + 1));
+    child_begin = child_end;
+  }
+
+  return ARTInnerNode::create(std::move(prefix), std::move(children), begin_iter, end_iter);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (!_root) return _chunk_offsets.cend();
+  return _root->bound(encode_key(values), 0, false);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (!_root) return _chunk_offsets.cend();
+  return _root->bound(encode_key(values), 0, true);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
+
+std::vector<std::shared_ptr<const AbstractSegment>> AdaptiveRadixTreeIndex::_indexed_segments() const {
+  return _segments;
+}
+
+size_t AdaptiveRadixTreeIndex::_estimate_memory_usage() const {
+  const auto tree_memory_usage = _root ? _root->estimate_memory_usage() : size_t{0};
+  return sizeof(ChunkOffset) * _chunk_offsets.size() + tree_memory_usage;
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "base_index.hpp"
+
+namespace opossum {
+
+// The adaptive radix tree (ART) index can be built on one or more segments of any data type, no matter whether they
+// are dictionary-encoded or not. It is meant for high-cardinality columns, where a lookup only touches a few nodes
+// instead of binary-searching a dictionary.
+//
+// The values of a row are concatenated into a binary-comparable key, i.e., a byte string whose bytewise order equals
+// the order of the values. Integers are stored big-endian with a flipped sign bit, floating-point numbers additionally
+// have all bits flipped if they are negative. Strings are terminated by 0x00 0x00, and 0x00 bytes within a string are
+// escaped as 0x00 0xFF, so that shorter strings sort before longer strings with the same prefix.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  // Encodes the given values as a binary-comparable key using the data types of the indexed segments.
+  BinaryComparableKey encode_key(const std::vector<AllTypeVariant>& values) const;
+
+ protected:
+  using KeyEncoder = std::function<void(const AllTypeVariant& value, BinaryComparableKey& key)>;
+
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const AbstractSegment>> _indexed_segments() const override;
+  size_t _estimate_memory_usage() const override;
+
+  // Builds the subtree for the entries in [begin, end), which are sorted by key. All of their keys share the first
+  // depth bytes.
+  std::unique_ptr<ARTNode> _build(const std::vector<std::pair<BinaryComparableKey, ChunkOffset>>& entries,
+                                  const size_t begin, const size_t end, const size_t depth) const;
+
+  const std::vector<std::shared_ptr<const AbstractSegment>> _segments;
+  std::vector<KeyEncoder> _key_encoders;
+  std::vector<ChunkOffset> _chunk_offsets;
+  std::unique_ptr<ARTNode> _root;
+};
+
+}  // namespace opossum
@@ -0,0 +1,151 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ARTNode::ARTNode(const Iterator begin, const Iterator end) : _begin(begin), _end(end) {}
+
+ARTNode::Iterator ARTNode::begin() const { return _begin; }
+
+ARTNode::Iterator ARTNode::end() const { return _end; }
+
+ARTLeaf::ARTLeaf(BinaryComparableKey key, const Iterator begin, const Iterator end)
+    : ARTNode(begin, end), _key(std::move(key)) {}
+
+ARTNode::Iterator ARTLeaf::bound(const BinaryComparableKey& key, size_t depth, const bool is_upper_bound) const {
+  // The bytes before depth are equal, as the lookup would not have reached this leaf otherwise.
+  const auto length = std::min(_key.size(), key.size());
+  const auto [leaf_iter, key_iter] =
+      std::mismatch(_key.cbegin() + depth, _key.cbegin() + length, key.cbegin() + depth, key.cbegin() + length);
+
+  if (key_iter == key.cend()) {
+    // The leaf's key, truncated to the search key's length, equals the search key.
+    return is_upper_bound ? _end : _begin;
+  }
+  if (leaf_iter == _key.cend()) {
+    // The leaf's key is a proper prefix of the search key and thus smaller.
+    return _end;
+  }
+  return *leaf_iter < *key_iter ? _end : _begin;
+}
+
+size_t ARTLeaf::estimate_memory_usage() const { return sizeof(*this) + _key.capacity(); }
+
+ARTInnerNode::ARTInnerNode(BinaryComparableKey prefix, const Iterator begin, const Iterator end)
+    : ARTNode(begin, end), _prefix(std::move(prefix)) {}
+
+std::unique_ptr<ARTInnerNode> ARTInnerNode::create(BinaryComparableKey prefix, Children children,
+                                                   const Iterator begin, const Iterator end) {
+  const auto child_count = children.size();
+  DebugAssert(child_count > 1, "Inner nodes need at least two children");
+
+  if (child_count <= 4) return std::make_unique<ARTNode4>(std::move(prefix), std::move(children), begin, end);
+  if (child_count <= 16) return std::make_unique<ARTNode16>(std::move(prefix), std::move(children), begin, end);
+  if (child_count <= 48) return std::make_unique<ARTNode48>(std::move(prefix), std::move(children), begin, end);
+  return std::make_unique<ARTNode256>(std::move(prefix), std::move(children), begin, end);
+}
+
+ARTNode::Iterator ARTInnerNode::bound(const BinaryComparableKey& key, size_t depth, const bool is_upper_bound) const {
+  // If the search key ends within this node's prefix or right after it, all keys below this node are equal to it when
+  // truncated.
+  for (const auto prefix_byte : _prefix) {
+    if (depth == key.size()) return is_upper_bound ? _end : _begin;
+    if (key[depth] != prefix_byte) return key[depth] < prefix_byte ? _begin : _end;
+    ++depth;
+  }
+  if (depth == key.size()) return is_upper_bound ? _end : _begin;
+
+  const auto [child, is_exact_match] = _child_at_or_above(key[depth]);
+  if (!child) return _end;
+  if (!is_exact_match) return child->begin();
+  return child->bound(key, depth + 1, is_upper_bound);
+}
+
+size_t ARTInnerNode::_estimate_prefix_memory_usage() const { return _prefix.capacity(); }
+
+template <size_t capacity>
+ARTSortedNode<capacity>::ARTSortedNode(BinaryComparableKey prefix, Children children, const Iterator begin,
+                                       const Iterator end)
+    : ARTInnerNode(std::move(prefix), begin, end), _child_count(static_cast<uint8_t>(children.size())) {
+  DebugAssert(children.size() <= capacity, "Too many children for node");
+  for (auto index = size_t{0}; index < children.size(); ++index) {
+    _bytes[index] = children[index].first;
+    _children[index] = std::move(children[index].second);
+  }
+}
+
+template <size_t capacity>
+std::pair<const ARTNode*, bool> ARTSortedNode<capacity>::_child_at_or_above(const uint8_t byte) const {
+  const auto bytes_end = _bytes.cbegin() + _child_count;
+  const auto iter = std::lower_bound(_bytes.cbegin(), bytes_end, byte);
+  if (iter == bytes_end) return {nullptr, false};
+  return {_children[std::distance(_bytes.cbegin(), iter)].get(), *iter == byte};
+}
+
+template <size_t capacity>
+size_t ARTSortedNode<capacity>::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _estimate_prefix_memory_usage();
+  for (auto index = size_t{0}; index < _child_count; ++index) {
+    memory_usage += _children[index]->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(BinaryComparableKey prefix, Children children, const Iterator begin, const Iterator end)
+    : ARTInnerNode(std::move(prefix), begin, end) {
+  DebugAssert(children.size() <= _children.size(), "Too many children for node");
+  _slots.fill(EMPTY_SLOT);
+  for (auto index = size_t{0}; index < children.size(); ++index) {
+    _slots[children[index].first] = static_cast<uint8_t>(index);
+    _children[index] = std::move(children[index].second);
+  }
+}
+
+std::pair<const ARTNode*, bool> ARTNode48::_child_at_or_above(const uint8_t byte) const {
+  for (auto next_byte = size_t{byte}; next_byte < _slots.size(); ++next_byte) {
+    const auto slot = _slots[next_byte];
+    if (slot != EMPTY_SLOT) return {_children[slot].get(), next_byte == byte};
+  }
+  return {nullptr, false};
+}
+
+size_t ARTNode48::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _estimate_prefix_memory_usage();
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+ARTNode256::ARTNode256(BinaryComparableKey prefix, Children children, const Iterator begin, const Iterator end)
+    : ARTInnerNode(std::move(prefix), begin, end) {
+  for (auto& [byte, child] : children) {
+    _children[byte] = std::move(child);
+  }
+}
+
+std::pair<const ARTNode*, bool> ARTNode256::_child_at_or_above(const uint8_t byte) const {
+  for (auto next_byte = size_t{byte}; next_byte < _children.size(); ++next_byte) {
+    if (_children[next_byte]) return {_children[next_byte].get(), next_byte == byte};
+  }
+  return {nullptr, false};
+}
+
+size_t ARTNode256::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _estimate_prefix_memory_usage();
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
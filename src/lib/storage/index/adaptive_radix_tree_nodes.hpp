@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+// Keys of the adaptive radix tree are byte strings whose bytewise order equals the order of the encoded values, see
+// AdaptiveRadixTreeIndex.
+using BinaryComparableKey = std::vector<uint8_t>;
+
+// ARTNode is the abstract super class of the nodes of the adaptive radix tree (Leis et al., ICDE 2013). Since the tree
+// is bulk-loaded from sorted keys and never modified afterwards, each node covers a contiguous range [begin, end) of
+// the index's chunk offsets.
+//
+// Lookups compare the keys of the tree truncated to the length of the search key. This makes lookups with fewer values
+// than indexed columns, whose keys are prefixes of the full keys, behave like lookups on the leading columns.
+class ARTNode : private Noncopyable {
+ public:
+  using Iterator = BaseIndex::Iterator;
+
+  ARTNode(const Iterator begin, const Iterator end);
+  virtual ~ARTNode() = default;
+
+  // Returns the first offset in this subtree whose truncated key is not less than the search key or, for upper bounds,
+  // greater than the search key. If there is no such offset, end() is returned. depth is the number of key bytes that
+  // have already been consumed by the parent nodes.
+  virtual Iterator bound(const BinaryComparableKey& key, size_t depth, const bool is_upper_bound) const = 0;
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  // Returns the calculated memory usage of this subtree.
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  const Iterator _begin;
+  const Iterator _end;
+};
+
+// A leaf holds the offsets of all rows with the same key. It stores the complete key, as inner nodes may skip bytes
+// that all keys below them share (path compression).
+class ARTLeaf : public ARTNode {
+ public:
+  ARTLeaf(BinaryComparableKey key, const Iterator begin, const Iterator end);
+
+  Iterator bound(const BinaryComparableKey& key, size_t depth, const bool is_upper_bound) const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const BinaryComparableKey _key;
+};
+
+// Inner nodes store the bytes that all keys below them share from the current depth on (the prefix) and branch on the
+// byte after the prefix. The subclasses only differ in how they map this byte to a child.
+class ARTInnerNode : public ARTNode {
+ public:
+  // The children are passed in ascending order of their bytes.
+  using Children = std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>>;
+
+  ARTInnerNode(BinaryComparableKey prefix, const Iterator begin, const Iterator end);
+
+  // Creates the smallest node type that can hold the given children.
+  static std::unique_ptr<ARTInnerNode> create(BinaryComparableKey prefix, Children children, const Iterator begin,
+                                              const Iterator end);
+
+  Iterator bound(const BinaryComparableKey& key, size_t depth, const bool is_upper_bound) const override;
+
+ protected:
+  // Returns the child for the given byte or, if there is none, the child with the next larger byte. The flag is true if
+  // the child belongs to the byte itself. Returns nullptr if all children have smaller bytes.
+  virtual std::pair<const ARTNode*, bool> _child_at_or_above(const uint8_t byte) const = 0;
+
+  size_t _estimate_prefix_memory_usage() const;
+
+  const BinaryComparableKey _prefix;
+};
+
+// Node4 and Node16 store up to 4 or 16 children with their bytes in sorted arrays.
+template <size_t capacity>
+class ARTSortedNode : public ARTInnerNode {
+ public:
+  ARTSortedNode(BinaryComparableKey prefix, Children children, const Iterator begin, const Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::pair<const ARTNode*, bool> _child_at_or_above(const uint8_t byte) const override;
+
+  std::array<uint8_t, capacity> _bytes{};
+  std::array<std::unique_ptr<ARTNode>, capacity> _children;
+  uint8_t _child_count{0};
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+// Node48 maps every possible byte to the slot of its child in an array of up to 48 children.
+class ARTNode48 : public ARTInnerNode {
+ public:
+  ARTNode48(BinaryComparableKey prefix, Children children, const Iterator begin, const Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  static constexpr auto EMPTY_SLOT = uint8_t{255};
+
+  std::pair<const ARTNode*, bool> _child_at_or_above(const uint8_t byte) const override;
+
+  std::array<uint8_t, 256> _slots;
+  std::array<std::unique_ptr<ARTNode>, 48> _children;
+};
+
+// Node256 stores the children directly at the position of their bytes.
+class ARTNode256 : public ARTInnerNode {
+ public:
+  ARTNode256(BinaryComparableKey prefix, Children children, const Iterator begin, const Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::pair<const ARTNode*, bool> _child_at_or_above(const uint8_t byte) const override;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children;
+};
+
+}  // namespace opossum
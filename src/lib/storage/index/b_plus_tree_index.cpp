@@ -0,0 +1,201 @@
+#include "b_plus_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+bool BPlusTreeIndex<T>::Entry::operator<(const Entry& other) const {
+  return std::tie(value, row_id) < std::tie(other.value, other.row_id);
+}
+
+template <typename T>
+BPlusTreeIndex<T>::BPlusTreeIndex(const Table& table, const ColumnID column_id)
+    : BaseTableIndex(column_id), _root(std::make_unique<Node>()), _first_leaf(_root.get()) {
+  Assert(column_id < table.column_count(), "Indexed column does not exist");
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    insert_chunk(*table.get_chunk(chunk_id), chunk_id);
+  }
+}
+
+template <typename T>
+void BPlusTreeIndex<T>::insert(const TaggedValue& value, const RowID row_id) {
+  auto separator = Entry{};
+  auto right_sibling = _insert(*_root, Entry{type_cast<T>(value), row_id}, separator);
+  ++_size;
+  if (!right_sibling) return;
+
+  // The root was split, so the tree grows by one level.
+  auto new_root = std::make_unique<Node>();
+  new_root->entries.push_back(std::move(separator));
+  new_root->children.push_back(std::move(_root));
+  new_root->children.push_back(std::move(right_sibling));
+  _root = std::move(new_root);
+}
+
+template <typename T>
+std::unique_ptr<typename BPlusTreeIndex<T>::Node> BPlusTreeIndex<T>::_insert(Node& node, const Entry& entry,
+                                                                               Entry& separator) {
+  const auto position = std::upper_bound(node.entries.cbegin(), node.entries.cend(), entry) - node.entries.cbegin();
+
+  if (node.is_leaf()) {
+    node.entries.insert(node.entries.cbegin() + position, entry);
+    if (node.entries.size() <= NODE_CAPACITY) return nullptr;
+
+    const auto split_position = node.entries.size() / 2;
+    auto right_sibling = std::make_unique<Node>();
+    right_sibling->entries.assign(node.entries.cbegin() + split_position, node.entries.cend());
+    node.entries.resize(split_position);
+    right_sibling->next_leaf = node.next_leaf;
+    node.next_leaf = right_sibling.get();
+    separator = right_sibling->entries.front();
+    return right_sibling;
+  }
+
+  auto child_separator = Entry{};
+  auto new_child = _insert(*node.children[position], entry, child_separator);
+  if (!new_child) return nullptr;
+
+  node.entries.insert(node.entries.cbegin() + position, std::move(child_separator));
+  node.children.insert(node.children.begin() + position + 1, std::move(new_child));
+  if (node.entries.size() <= NODE_CAPACITY) return nullptr;
+
+  // The middle separator moves up to the parent, the separators and children right of it move to the new sibling.
+  const auto split_position = node.entries.size() / 2;
+  auto right_sibling = std::make_unique<Node>();
+  separator = std::move(node.entries[split_position]);
+  right_sibling->entries.assign(std::make_move_iterator(node.entries.begin() + split_position + 1),
+                                std::make_move_iterator(node.entries.end()));
+  right_sibling->children.assign(std::make_move_iterator(node.children.begin() + split_position + 1),
+                                 std::make_move_iterator(node.children.end()));
+  node.entries.resize(split_position);
+  node.children.resize(split_position + 1);
+  return right_sibling;
+}
+
+template <typename T>
+PosList BPlusTreeIndex<T>::lookup(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto value = type_cast<T>(search_value);
+  const auto begin = Position{_first_leaf->entries.empty() ? nullptr : _first_leaf, 0};
+  const auto end = Position{nullptr, 0};
+
+  auto pos_list = PosList{};
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      _collect(_bound(value, false), _bound(value, true), pos_list);
+      break;
+    case ScanType::OpNotEquals:
+      _collect(begin, _bound(value, false), pos_list);
+      _collect(_bound(value, true), end, pos_list);
+      break;
+    case ScanType::OpLessThan:
+      _collect(begin, _bound(value, false), pos_list);
+      break;
+    case ScanType::OpLessThanEquals:
+      _collect(begin, _bound(value, true), pos_list);
+      break;
+    case ScanType::OpGreaterThan:
+      _collect(_bound(value, true), end, pos_list);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      _collect(_bound(value, false), end, pos_list);
+      break;
+    case ScanType::OpIsNull:
+    case ScanType::OpIsNotNull:
+      Fail("Indexes do not contain NULL values and cannot answer NULL scans");
+  }
+
+  // Entries with equal values are already ordered by RowID, so only lookups that cover several values need sorting.
+  if (scan_type != ScanType::OpEquals) std::sort(pos_list.begin(), pos_list.end());
+  return pos_list;
+}
+
+template <typename T>
+PosList BPlusTreeIndex<T>::range_lookup(const AllTypeVariant& lower_value, const AllTypeVariant& upper_value) const {
+  const auto typed_lower_value = type_cast<T>(lower_value);
+  const auto typed_upper_value = type_cast<T>(upper_value);
+
+  auto pos_list = PosList{};
+  if (typed_upper_value < typed_lower_value) return pos_list;
+
+  _collect(_bound(typed_lower_value, false), _bound(typed_upper_value, true), pos_list);
+  std::sort(pos_list.begin(), pos_list.end());
+  return pos_list;
+}
+
+template <typename T>
+typename BPlusTreeIndex<T>::Position BPlusTreeIndex<T>::_bound(const T& value, const bool is_upper_bound) const {
+  // Separators and entries are only compared by value here, RowIDs do not matter for lookups.
+  const auto find = [&](const std::vector<Entry>& entries) {
+    if (is_upper_bound) {
+      return std::upper_bound(entries.cbegin(), entries.cend(), value,
+                              [](const T& lhs, const Entry& rhs) { return lhs < rhs.value; });
+    }
+    return std::lower_bound(entries.cbegin(), entries.cend(), value,
+                            [](const Entry& lhs, const T& rhs) { return lhs.value < rhs; });
+  };
+
+  const auto* node = _root.get();
+  while (!node->is_leaf()) {
+    node = node->children[find(node->entries) - node->entries.cbegin()].get();
+  }
+
+  const auto position = static_cast<size_t>(find(node->entries) - node->entries.cbegin());
+  if (position == node->entries.size()) return Position{node->next_leaf, 0};
+  return Position{node, position};
+}
+
+template <typename T>
+void BPlusTreeIndex<T>::_collect(Position begin, const Position end, PosList& pos_list) {
+  auto [leaf, position] = begin;
+  while (leaf && (leaf != end.first || position != end.second)) {
+    pos_list.push_back(leaf->entries[position].row_id);
+    if (++position == leaf->entries.size()) {
+      leaf = leaf->next_leaf;
+      position = 0;
+    }
+  }
+}
+
+template <typename T>
+size_t BPlusTreeIndex<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t BPlusTreeIndex<T>::height() const {
+  auto height = size_t{1};
+  for (const auto* node = _root.get(); !node->is_leaf(); node = node->children.front().get()) {
+    ++height;
+  }
+  return height;
+}
+
+template <typename T>
+size_t BPlusTreeIndex<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _estimate_memory_usage(*_root);
+}
+
+template <typename T>
+size_t BPlusTreeIndex<T>::_estimate_memory_usage(const Node& node) {
+  auto memory_usage = sizeof(Node) + node.entries.capacity() * sizeof(Entry) +
+                      node.children.capacity() * sizeof(std::unique_ptr<Node>);
+  for (const auto& child : node.children) {
+    memory_usage += _estimate_memory_usage(*child);
+  }
+  return memory_usage;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BPlusTreeIndex);
+
+}  // namespace opossum
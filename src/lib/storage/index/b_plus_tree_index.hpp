@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_table_index.hpp"
+
+namespace opossum {
+
+class Table;
+
+// A B+-tree on one column of a table that maps values to RowIDs. Entries are ordered by value and, for equal values,
+// by RowID, so that each entry is unique and duplicates are kept in the order of the table.
+//
+// Inner nodes hold separators and one more child than separators: all entries in children[i] are less than
+// separators[i] and not less than separators[i - 1]. Leaves are linked from left to right, so that a range lookup
+// descends the tree once and then scans the leaves.
+template <typename T>
+class BPlusTreeIndex : public BaseTableIndex {
+ public:
+  // Maximum number of entries per node. Nodes that exceed it are split in half.
+  static constexpr auto NODE_CAPACITY = size_t{64};
+
+  // Creates the index on the given column and inserts all rows the table currently holds.
+  BPlusTreeIndex(const Table& table, const ColumnID column_id);
+
+  void insert(const TaggedValue& value, const RowID row_id) override;
+
+  PosList lookup(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  PosList range_lookup(const AllTypeVariant& lower_value, const AllTypeVariant& upper_value) const override;
+
+  size_t size() const override;
+
+  // Returns the number of levels of the tree, counting the leaves.
+  size_t height() const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  struct Entry {
+    T value;
+    RowID row_id;
+
+    bool operator<(const Entry& other) const;
+  };
+
+  struct Node {
+    bool is_leaf() const { return children.empty(); }
+
+    // Entries for leaves, separators for inner nodes.
+    std::vector<Entry> entries;
+    std::vector<std::unique_ptr<Node>> children;
+    Node* next_leaf = nullptr;
+  };
+
+  // Identifies an entry by its leaf and its position within the leaf. A nullptr leaf points behind the last entry.
+  using Position = std::pair<const Node*, size_t>;
+
+  // Inserts the entry into the subtree. If the node had to be split, the new right sibling is returned and separator
+  // is set to its smallest entry.
+  std::unique_ptr<Node> _insert(Node& node, const Entry& entry, Entry& separator);
+
+  // Returns the position of the first entry whose value is not less than (lower bound) or greater than (upper bound)
+  // the given value.
+  Position _bound(const T& value, const bool is_upper_bound) const;
+
+  // Appends the RowIDs of all entries in [begin, end) to pos_list.
+  static void _collect(Position begin, const Position end, PosList& pos_list);
+
+  static size_t _estimate_memory_usage(const Node& node);
+
+  std::unique_ptr<Node> _root;
+  Node* _first_leaf;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
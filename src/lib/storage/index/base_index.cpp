@@ -0,0 +1,64 @@
+#include "base_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "storage/abstract_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const SegmentIndexType type) : _type(type) {}
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
+  return _indexed_segments() == segments;
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= _indexed_segments().size(),
+              "Number of values has to be between one and the number of indexed segments");
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= _indexed_segments().size(),
+              "Number of values has to be between one and the number of indexed segments");
+  return _upper_bound(values);
+}
+
+PosList BaseIndex::point_lookup(const std::vector<AllTypeVariant>& values, const ChunkID chunk_id) const {
+  return _to_pos_list(lower_bound(values), upper_bound(values), chunk_id);
+}
+
+PosList BaseIndex::range_lookup(const std::vector<AllTypeVariant>& lower_values,
+                                const std::vector<AllTypeVariant>& upper_values, const ChunkID chunk_id) const {
+  const auto begin = lower_bound(lower_values);
+  const auto end = upper_bound(upper_values);
+  if (begin >= end) return PosList{};
+  return _to_pos_list(begin, end, chunk_id);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+SegmentIndexType BaseIndex::type() const { return _type; }
+
+std::vector<std::shared_ptr<const AbstractSegment>> BaseIndex::indexed_segments() const { return _indexed_segments(); }
+
+size_t BaseIndex::estimate_memory_usage() const { return _estimate_memory_usage(); }
+
+PosList BaseIndex::_to_pos_list(const Iterator begin, const Iterator end, const ChunkID chunk_id) {
+  auto offsets = std::vector<ChunkOffset>(begin, end);
+  std::sort(offsets.begin(), offsets.end());
+
+  auto pos_list = PosList{};
+  pos_list.reserve(offsets.size());
+  for (const auto chunk_offset : offsets) {
+    pos_list.push_back(RowID{chunk_id, chunk_offset});
+  }
+  return pos_list;
+}
+
+}  // namespace opossum
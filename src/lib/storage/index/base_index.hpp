@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+enum class SegmentIndexType : uint8_t { GroupKey, AdaptiveRadixTree };
+
+// BaseIndex is the abstract super class for all indexes. An index is built on one or more segments of a chunk and
+// provides the offsets of the chunk ordered by the indexed values. lower_bound and upper_bound return iterators into
+// this order, so that point and range predicates translate into a range of chunk offsets.
+//
+// For multi-column indexes, the values are compared lexicographically. The lookups may be called with fewer values than
+// there are indexed segments, which then form a prefix of the key.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit BaseIndex(const SegmentIndexType type);
+  virtual ~BaseIndex() = default;
+
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // Returns whether the index was built on exactly the given segments, in this order.
+  bool is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
+
+  // Returns an iterator to the first offset whose values are not less than the given values.
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns an iterator to the first offset whose values are greater than the given values.
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns the rows of the chunk with the given id whose values equal the given values, ordered by offset.
+  PosList point_lookup(const std::vector<AllTypeVariant>& values, const ChunkID chunk_id) const;
+
+  // Returns the rows of the chunk with the given id whose values are in [lower_values, upper_values], ordered by
+  // offset.
+  PosList range_lookup(const std::vector<AllTypeVariant>& lower_values, const std::vector<AllTypeVariant>& upper_values,
+                       const ChunkID chunk_id) const;
+
+  // Returns iterators to the first and behind the last offset.
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  SegmentIndexType type() const;
+
+  // Returns the indexed segments.
+  std::vector<std::shared_ptr<const AbstractSegment>> indexed_segments() const;
+
+  // Returns the calculated memory usage of the index, excluding the indexed segments.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const AbstractSegment>> _indexed_segments() const = 0;
+  virtual size_t _estimate_memory_usage() const = 0;
+
+ private:
+  // Creates a PosList from the offsets in [begin, end).
+  static PosList _to_pos_list(const Iterator begin, const Iterator end, const ChunkID chunk_id);
+
+  SegmentIndexType _type;
+};
+
+}  // namespace opossum
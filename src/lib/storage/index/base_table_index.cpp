@@ -0,0 +1,21 @@
+#include "base_table_index.hpp"
+
+#include "storage/abstract_segment.hpp"
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+BaseTableIndex::BaseTableIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+ColumnID BaseTableIndex::column_id() const { return _column_id; }
+
+void BaseTableIndex::insert_chunk(const Chunk& chunk, const ChunkID chunk_id) {
+  const auto segment = chunk.get_segment(_column_id);
+  const auto chunk_size = chunk.size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    const auto value = (*segment)[chunk_offset];
+    if (!variant_is_null(value)) insert(value, RowID{chunk_id, chunk_offset});
+  }
+}
+
+}  // namespace opossum
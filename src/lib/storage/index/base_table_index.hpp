@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "tagged_value.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// BaseTableIndex is the abstract super class for indexes that span all chunks of a table. Unlike the per-chunk
+// indexes (see BaseIndex), they map values directly to RowIDs, so a lookup does not have to visit every chunk.
+//
+// Table indexes are attached to their table (see StorageManager::create_index) and maintained by it: rows that are
+// appended or emplaced afterwards are inserted into the index. Compressing a chunk does not move rows, so the RowIDs
+// stay valid.
+class BaseTableIndex : private Noncopyable {
+ public:
+  explicit BaseTableIndex(const ColumnID column_id);
+  virtual ~BaseTableIndex() = default;
+
+  // Returns the indexed column.
+  ColumnID column_id() const;
+
+  // Adds the row with the given id, whose indexed column holds the given value. The value must not be NULL.
+  virtual void insert(const TaggedValue& value, const RowID row_id) = 0;
+
+  // Adds all rows of the given chunk. NULL values are skipped, as they never satisfy a lookup.
+  void insert_chunk(const Chunk& chunk, const ChunkID chunk_id);
+
+  // Returns the rows whose value satisfies "value <scan_type> search_value", ordered by RowID. NULL scan types are not
+  // supported.
+  virtual PosList lookup(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns the rows whose value is in [lower_value, upper_value], ordered by RowID.
+  virtual PosList range_lookup(const AllTypeVariant& lower_value, const AllTypeVariant& upper_value) const = 0;
+
+  // Returns the number of indexed rows.
+  virtual size_t size() const = 0;
+
+  // Returns the calculated memory usage of the index.
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex(SegmentIndexType::GroupKey),
+      _indexed_segment(segments_to_index.size() == 1
+                           ? std::dynamic_pointer_cast<const BaseDictionarySegment>(segments_to_index.front())
+                           : nullptr) {
+  Assert(segments_to_index.size() == 1, "GroupKeyIndex only works with a single segment");
+  Assert(_indexed_segment, "GroupKeyIndex only works with dictionary segments");
+
+  const auto unique_values_count = _indexed_segment->unique_values_count();
+  const auto segment_size = _indexed_segment->size();
+
+  resolve_attribute_vector(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+
+    // Count the occurrences of each value id. The counts are stored shifted by one, so that the prefix sum below
+    // directly yields the start offset of each value id. The null value id (unique_values_count) gets a bucket as
+    // well, so that the scatter loop does not need to branch on NULL rows.
+    _value_start_offsets.resize(unique_values_count + 2, 0);
+    for (const auto value_id : value_ids) {
+      ++_value_start_offsets[value_id + 1];
+    }
+
+    for (auto value_id = size_t{1}; value_id <= unique_values_count + 1; ++value_id) {
+      _value_start_offsets[value_id] += _value_start_offsets[value_id - 1];
+    }
+
+    // Scatter the offsets into their value id's bucket. Since the offsets are visited in ascending order, each bucket
+    // ends up sorted.
+    auto next_positions = std::vector<ChunkOffset>(_value_start_offsets.cbegin(), _value_start_offsets.cend() - 1);
+    _positions.resize(segment_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+      _positions[next_positions[value_ids[chunk_offset]]++] = chunk_offset;
+    }
+  });
+
+  // NULL never satisfies a lookup, so the bucket of the null value id is dropped again. It is the last one, which
+  // keeps _value_start_offsets[unique_values_count] as the end of the last value's bucket.
+  _positions.resize(_value_start_offsets[unique_values_count]);
+  _value_start_offsets.pop_back();
+}
+
+BaseIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _value_id_begin(_indexed_segment->lower_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _value_id_begin(_indexed_segment->upper_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cbegin() const { return _positions.cbegin(); }
+
+BaseIndex::Iterator GroupKeyIndex::_cend() const { return _positions.cend(); }
+
+std::vector<std::shared_ptr<const AbstractSegment>> GroupKeyIndex::_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t GroupKeyIndex::_estimate_memory_usage() const {
+  return sizeof(ChunkOffset) * (_value_start_offsets.size() + _positions.size());
+}
+
+BaseIndex::Iterator GroupKeyIndex::_value_id_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _positions.cend();
+  return _positions.cbegin() + _value_start_offsets[value_id];
+}
+
+}  // namespace opossum
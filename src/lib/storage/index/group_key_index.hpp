@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+// The group-key index is built on a single dictionary segment. For each value id, it stores the sorted offsets of the
+// rows holding that value. The offsets of all value ids are stored back to back in _positions, ordered by value id,
+// and _value_start_offsets[value_id] points to the first offset of a value id. An extra entry at the end points behind
+// the last offset, so that the offsets of value id v are [_value_start_offsets[v], _value_start_offsets[v + 1]).
+//
+// Because the dictionary is sorted, a range of values corresponds to a range of value ids and thus to a single
+// contiguous range of _positions. The index is built with a counting sort over the attribute vector in O(n).
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const AbstractSegment>> _indexed_segments() const override;
+  size_t _estimate_memory_usage() const override;
+
+  // Returns an iterator to the first offset of the given value id. INVALID_VALUE_ID results in cend.
+  Iterator _value_id_begin(const ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+  std::vector<ChunkOffset> _value_start_offsets;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#include "mvcc_data.hpp"
+
+#include <atomic>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MvccData::MvccData(const ChunkOffset capacity)
+    : _tids(capacity), _begin_cids(capacity), _end_cids(capacity), _capacity(capacity) {
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < capacity; ++chunk_offset) {
+    _tids[chunk_offset] = INVALID_TRANSACTION_ID;
+    _begin_cids[chunk_offset] = MAX_COMMIT_ID;
+    _end_cids[chunk_offset] = MAX_COMMIT_ID;
+  }
+}
+
+ChunkOffset MvccData::capacity() const { return _capacity; }
+
+void MvccData::seal() { _capacity = size(); }
+
+ChunkOffset MvccData::size() const { return _size.load(std::memory_order_acquire); }
+
+void MvccData::append(const TransactionID transaction_id, const CommitID begin_commit_id) {
+  const auto chunk_offset = _size.load(std::memory_order_relaxed);
+  Assert(chunk_offset < capacity(), "MvccData is full");
+  _tids[chunk_offset] = transaction_id;
+  _begin_cids[chunk_offset] = begin_commit_id;
+  // Releasing the new size makes the row's entries and segment values visible to readers that acquire it.
+  _size.store(chunk_offset + 1, std::memory_order_release);
+}
+
+TransactionID MvccData::tid(const ChunkOffset chunk_offset) const { return _tids[chunk_offset]; }
+
+void MvccData::set_tid(const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  _tids[chunk_offset] = transaction_id;
+}
+
+bool MvccData::compare_exchange_tid(const ChunkOffset chunk_offset, TransactionID& expected,
+                                    const TransactionID desired) {
+  return _tids[chunk_offset].compare_exchange_strong(expected, desired);
+}
+
+CommitID MvccData::begin_cid(const ChunkOffset chunk_offset) const { return _begin_cids[chunk_offset]; }
+
+void MvccData::set_begin_cid(const ChunkOffset chunk_offset, const CommitID commit_id) {
+  _begin_cids[chunk_offset] = commit_id;
+}
+
+CommitID MvccData::end_cid(const ChunkOffset chunk_offset) const { return _end_cids[chunk_offset]; }
+
+void MvccData::set_end_cid(const ChunkOffset chunk_offset, const CommitID commit_id) {
+  _end_cids[chunk_offset] = commit_id;
+}
+
+ChunkOffset MvccData::invalid_row_count() const { return _invalid_row_count; }
+
+void MvccData::increase_invalid_row_count(const ChunkOffset count) { _invalid_row_count += count; }
+
+size_t MvccData::estimate_memory_usage() const {
+  return _tids.size() * (sizeof(TransactionID) + 2 * sizeof(CommitID));
+}
+
+}  // namespace opossum
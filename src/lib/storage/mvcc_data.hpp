@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// MvccData stores the multi-version concurrency control information of a chunk's rows column-wise: the id of the
+// transaction that currently inserts or deletes the row (INVALID_TRANSACTION_ID if none), the id of the commit that
+// made the row visible, and the id of the commit that deleted it (MAX_COMMIT_ID for rows that are not (yet) committed
+// or not deleted, respectively). See Validate for how these are used to decide whether a row is visible.
+//
+// The vectors are allocated for the capacity of the chunk upfront, so readers can access them while rows are appended.
+// A row is only published (i.e., counted by size()) once all its segment values and MVCC entries have been written.
+class MvccData : private Noncopyable {
+ public:
+  explicit MvccData(const ChunkOffset capacity);
+
+  // Returns the number of rows that can be appended in total, which is the number of rows the vectors were allocated
+  // for unless the MvccData was sealed.
+  ChunkOffset capacity() const;
+
+  // Reduces the capacity to the number of published rows, so that the chunk counts as full. Not thread-safe with
+  // appends, see Table::emplace_chunk.
+  void seal();
+
+  // Returns the number of published rows.
+  ChunkOffset size() const;
+
+  // Writes the entries of the next row and publishes it. Not thread-safe, appends have to be serialized by the caller.
+  void append(const TransactionID transaction_id, const CommitID begin_commit_id);
+
+  TransactionID tid(const ChunkOffset chunk_offset) const;
+  void set_tid(const ChunkOffset chunk_offset, const TransactionID transaction_id);
+
+  // Sets the transaction id of the row to desired if it is expected and returns true. Otherwise, expected is set to the
+  // current transaction id and false is returned. Transactions lock rows this way before deleting them.
+  bool compare_exchange_tid(const ChunkOffset chunk_offset, TransactionID& expected, const TransactionID desired);
+
+  CommitID begin_cid(const ChunkOffset chunk_offset) const;
+  void set_begin_cid(const ChunkOffset chunk_offset, const CommitID commit_id);
+
+  CommitID end_cid(const ChunkOffset chunk_offset) const;
+  void set_end_cid(const ChunkOffset chunk_offset, const CommitID commit_id);
+
+  // Returns the number of invalid rows (see Chunk::invalid_row_count).
+  ChunkOffset invalid_row_count() const;
+  void increase_invalid_row_count(const ChunkOffset count);
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<std::atomic<TransactionID>> _tids;
+  std::vector<std::atomic<CommitID>> _begin_cids;
+  std::vector<std::atomic<CommitID>> _end_cids;
+  std::atomic<ChunkOffset> _capacity;
+  std::atomic<ChunkOffset> _size{0};
+  std::atomic<ChunkOffset> _invalid_row_count{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#include "null_bitmap.hpp"
+
+#include <bit>
+#include <vector>
+
+namespace opossum {
+
+NullBitmap::NullBitmap(const ChunkOffset size) : _words((size + WORD_BITS - 1) / WORD_BITS, 0), _size(size) {}
+
+NullBitmap::NullBitmap(const NullBitmap& other, std::pmr::memory_resource* memory_resource)
+    : _words(other._words, memory_resource), _size(other._size) {}
+
+void NullBitmap::reserve(const ChunkOffset capacity) { _words.reserve((capacity + WORD_BITS - 1) / WORD_BITS); }
+
+void NullBitmap::push_back(const bool is_null) {
+  if (_size % WORD_BITS == 0) _words.push_back(0);
+  _words.back() |= uint64_t{is_null} << (_size % WORD_BITS);
+  ++_size;
+}
+
+ChunkOffset NullBitmap::size() const { return _size; }
+
+ChunkOffset NullBitmap::null_count() const {
+  auto null_count = ChunkOffset{0};
+  for (const auto word : _words) {
+    null_count += static_cast<ChunkOffset>(std::popcount(word));
+  }
+  return null_count;
+}
+
+const std::pmr::vector<uint64_t>& NullBitmap::words() const { return _words; }
+
+size_t NullBitmap::estimate_memory_usage() const { return sizeof(uint64_t) * _words.capacity(); }
+
+}  // namespace opossum
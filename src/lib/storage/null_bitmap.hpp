@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// NullBitmap stores one bit per row of a segment, which is set if the row is NULL. The bits are packed into 64-bit
+// words, so that scans can mask their results with the bitmap instead of branching on every row.
+class NullBitmap {
+ public:
+  static constexpr auto WORD_BITS = ChunkOffset{64};
+
+  NullBitmap() = default;
+
+  // Creates a bitmap of the given size in which no row is NULL.
+  explicit NullBitmap(const ChunkOffset size);
+
+  // Copies the bitmap into the given memory resource, e.g., a ContiguousChunkStorage.
+  NullBitmap(const NullBitmap& other, std::pmr::memory_resource* memory_resource);
+
+  // Allocates memory for the given number of rows, so that appending up to this size does not move the words.
+  void reserve(const ChunkOffset capacity);
+
+  // Appends the NULL flag of the next row.
+  void push_back(const bool is_null);
+
+  // Returns whether the row at the given offset is NULL.
+  bool operator[](const ChunkOffset chunk_offset) const {
+    return (_words[chunk_offset / WORD_BITS] >> (chunk_offset % WORD_BITS)) & uint64_t{1};
+  }
+
+  // Returns the number of rows.
+  ChunkOffset size() const;
+
+  // Returns the number of NULL rows.
+  ChunkOffset null_count() const;
+
+  // Returns the packed bits. Bits beyond size() are zero.
+  const std::pmr::vector<uint64_t>& words() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::pmr::vector<uint64_t> _words;
+  ChunkOffset _size{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  DebugAssert(abstract_segment->size() > 0, "Input segment must contain values.");
+
+  // Like DictionarySegment, we can assume to only receive a ValueSegment.
+  const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(abstract_segment);
+  const auto& values = value_segment->values();
+  const auto value_count = static_cast<ChunkOffset>(values.size());
+  _nullable = value_segment->is_nullable();
+
+  // Rows continue a run if they are NULL as well or both are not NULL and hold the same value.
+  const auto same_run = [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+    const auto lhs_is_null = value_segment->is_null(lhs);
+    if (lhs_is_null != value_segment->is_null(rhs)) return false;
+    return lhs_is_null || values[lhs] == values[rhs];
+  };
+
+  for (auto offset = ChunkOffset{0}; offset < value_count; ++offset) {
+    if (offset + 1 < value_count && same_run(offset, offset + 1)) continue;
+    _values.push_back(values[offset]);
+    _end_positions.push_back(offset);
+    if (_nullable) _null_values.push_back(value_segment->is_null(offset));
+  }
+
+  _values.shrink_to_fit();
+  _null_values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const RunLengthSegment& segment,
+                                      const std::shared_ptr<std::pmr::memory_resource>& memory_resource)
+    : _memory_resource(memory_resource),
+      // The memory resource cannot hold the characters of strings, so they keep their own allocations.
+      _values(segment._values,
+              std::is_same_v<T, std::string> ? std::pmr::get_default_resource() : memory_resource.get()),
+      _null_values(segment._null_values, memory_resource.get()),
+      _end_positions(segment._end_positions, memory_resource.get()),
+      _nullable(segment._nullable) {}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Offset is out of range");
+  const auto index = run_index(chunk_offset);
+  if (is_null_run(index)) return NULL_VALUE;
+  return _values[index];
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Offset is out of range");
+  const auto index = run_index(chunk_offset);
+  DebugAssert(!is_null_run(index), "Row is NULL");
+  return _values[index];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const TaggedValue& value) {
+  Fail("Run-length segments are immutable, i.e., values cannot be appended.");
+}
+
+template <typename T>
+const std::pmr::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::pmr::vector<bool>& RunLengthSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+bool RunLengthSegment<T>::is_null_run(const size_t run_index) const {
+  return _nullable && _null_values[run_index];
+}
+
+template <typename T>
+bool RunLengthSegment<T>::is_nullable() const {
+  return _nullable;
+}
+
+template <typename T>
+const std::pmr::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_index(const ChunkOffset chunk_offset) const {
+  // The first run that ends at or after the offset contains it.
+  const auto iter = std::lower_bound(_end_positions.cbegin(), _end_positions.cend(), chunk_offset);
+  return static_cast<size_t>(std::distance(_end_positions.cbegin(), iter));
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values.size();
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  return _end_positions.empty() ? ChunkOffset{0} : _end_positions.back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(T) * _values.capacity() + _null_values.capacity() / 8 + sizeof(ChunkOffset) * _end_positions.capacity();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is an immutable segment type that stores consecutive equal values only once. For each run, the
+// value and the offset of the last row of the run (its end position) are stored. Finding the value of a row therefore
+// requires a binary search over the end positions. In nullable segments, NULL rows form runs of their own, which are
+// flagged in null_values().
+template <typename T>
+class RunLengthSegment : public AbstractSegment {
+ public:
+  /**
+   * Creates a RunLengthSegment from a given value segment.
+   */
+  explicit RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Copies the end positions, the NULL flags, and, except for strings, the values into the given memory resource,
+  // which the new segment keeps alive (see ContiguousChunkStorage).
+  RunLengthSegment(const RunLengthSegment& segment, const std::shared_ptr<std::pmr::memory_resource>& memory_resource);
+
+  // Return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Return the value at a certain position. The row must not be NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Run-length segments are immutable.
+  void append(const TaggedValue& value) override;
+
+  // Returns the value of each run. NULL runs hold T{}.
+  const std::pmr::vector<T>& values() const;
+
+  // Returns whether each run is NULL. The vector is empty if the segment is not nullable.
+  const std::pmr::vector<bool>& null_values() const;
+
+  // Returns whether the run with the given index is NULL.
+  bool is_null_run(const size_t run_index) const;
+
+  // Returns whether the segment was created from a nullable segment, i.e., whether rows can be NULL.
+  bool is_nullable() const;
+
+  // Returns the offset of the last row of each run. The end positions are strictly increasing.
+  const std::pmr::vector<ChunkOffset>& end_positions() const;
+
+  // Returns the index of the run that contains the given offset.
+  size_t run_index(const ChunkOffset chunk_offset) const;
+
+  // Return the number of runs.
+  size_t run_count() const;
+
+  // Return the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Declared first, as the vectors have to be destroyed before the memory resource they live in.
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+  std::pmr::vector<T> _values;
+  std::pmr::vector<bool> _null_values;
+  std::pmr::vector<ChunkOffset> _end_positions;
+  bool _nullable{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#include "segment_encoding_utils.hpp"
+
+#include <memory>
+#include <string>
+
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+bool is_encoding_supported(const EncodingType encoding_type, const std::string& data_type) {
+  auto supported = true;
+  resolve_data_type(data_type, [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    if (encoding_type == EncodingType::FrameOfReference) {
+      supported = is_frame_of_reference_supported_v<DataType>;
+    }
+  });
+  return supported;
+}
+
+std::shared_ptr<AbstractSegment> encode_segment(const EncodingType encoding_type, const std::string& data_type,
+                                                const std::shared_ptr<AbstractSegment>& value_segment) {
+  auto encoded_segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    DebugAssert(std::dynamic_pointer_cast<ValueSegment<DataType>>(value_segment), "Only ValueSegments can be encoded");
+
+    switch (encoding_type) {
+      case EncodingType::Unencoded:
+        encoded_segment = value_segment;
+        return;
+      case EncodingType::Dictionary:
+        encoded_segment = std::make_shared<DictionarySegment<DataType>>(value_segment);
+        return;
+      case EncodingType::RunLength:
+        encoded_segment = std::make_shared<RunLengthSegment<DataType>>(value_segment);
+        return;
+      case EncodingType::FrameOfReference:
+        if constexpr (is_frame_of_reference_supported_v<DataType>) {
+          encoded_segment = std::make_shared<FrameOfReferenceSegment<DataType>>(value_segment);
+          return;
+        } else {
+          Fail("Frame-of-reference encoding is only supported for int and long columns");
+        }
+      case EncodingType::Automatic:
+        Fail("The encoding has to be chosen by the EncodingSelector first");
+    }
+    Fail("Unknown encoding type");
+  });
+  return encoded_segment;
+}
+
+}  // namespace opossum
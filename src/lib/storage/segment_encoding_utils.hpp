@@ -0,0 +1,20 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "encoding_type.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Returns whether segments of the given data type (e.g., "int") can be encoded with the given encoding.
+bool is_encoding_supported(const EncodingType encoding_type, const std::string& data_type);
+
+// Encodes a ValueSegment of the given data type (e.g., "int") with the given encoding. For EncodingType::Unencoded, the
+// ValueSegment itself is returned.
+std::shared_ptr<AbstractSegment> encode_segment(const EncodingType encoding_type, const std::string& data_type,
+                                                const std::shared_ptr<AbstractSegment>& value_segment);
+
+}  // namespace opossum
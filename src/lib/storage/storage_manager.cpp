@@ -1,14 +1,55 @@
 #include "storage_manager.hpp"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "index/b_plus_tree_index.hpp"
+#include "resolve_type.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Prints the memory usage of the segments of each column, broken down by their encoding.
+void print_column_memory_usage(const Table& table, std::ostream& out) {
+  const auto column_count = table.column_count();
+  auto memory_usage_by_encoding = std::vector<std::map<EncodingType, size_t>>(column_count);
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    // Chunks that were not compressed hold ValueSegments.
+    const auto& encoding_types = chunk->encoding_types();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto encoding_type = encoding_types.empty() ? EncodingType::Unencoded : encoding_types[column_id];
+      memory_usage_by_encoding[column_id][encoding_type] += chunk->get_segment(column_id)->estimate_memory_usage();
+    }
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& column_memory_usage = memory_usage_by_encoding[column_id];
+    auto memory_usage = size_t{0};
+    for (const auto& [_, encoding_memory_usage] : column_memory_usage) {
+      memory_usage += encoding_memory_usage;
+    }
+
+    out << "  " << table.column_name(column_id) << " (" << table.column_type(column_id) << "): " << memory_usage
+        << " bytes";
+    auto separator = " (";
+    for (const auto& [encoding_type, encoding_memory_usage] : column_memory_usage) {
+      out << separator << encoding_type << ": " << encoding_memory_usage << " bytes";
+      separator = ", ";
+    }
+    if (!column_memory_usage.empty()) out << ")";
+    out << std::endl;
+  }
+}
+
+}  // namespace
+
 StorageManager& StorageManager::get() {
   static StorageManager instance;
   return instance;
@@ -27,6 +68,24 @@ void StorageManager::drop_table(const std::string& name) {
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
 
+void StorageManager::create_index(const std::string& table_name, const ColumnID column_id) {
+  const auto table = get_table(table_name);
+  Assert(column_id < table->column_count(), "Indexed column does not exist");
+  resolve_data_type(table->column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    table->add_index(std::make_shared<BPlusTreeIndex<ColumnDataType>>(*table, column_id));
+  });
+}
+
+std::shared_ptr<const BaseTableIndex> StorageManager::get_index(const std::string& table_name,
+                                                                const ColumnID column_id) const {
+  return get_table(table_name)->get_index(column_id);
+}
+
+void StorageManager::drop_index(const std::string& table_name, const ColumnID column_id) {
+  get_table(table_name)->drop_index(column_id);
+}
+
 bool StorageManager::has_table(const std::string& name) const { return _tables.contains(name); }
 
 std::vector<std::string> StorageManager::table_names() const {
@@ -40,11 +99,14 @@ std::vector<std::string> StorageManager::table_names() const {
 
 void StorageManager::print(std::ostream& out) const {
   for (auto it = _tables.begin(), end = _tables.end(); it != end; ++it) {
+    const auto& table = *it->second;
     out << "Name: " << it->first << ", ";
-    out << "#columns: " << it->second->column_count() << ", ";
-    out << "#rows: " << it->second->row_count() << ", ";
-    out << "#chunks: " << it->second->chunk_count();
+    out << "#columns: " << table.column_count() << ", ";
+    out << "#rows: " << table.row_count() << ", ";
+    out << "#chunks: " << table.chunk_count() << ", ";
+    out << "memory: " << table.memory_usage() << " bytes";
     out << std::endl;
+    print_column_memory_usage(table, out);
   }
 }
 
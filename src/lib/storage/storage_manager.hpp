@@ -29,10 +29,21 @@ class StorageManager : private Noncopyable {
   // Returns whether the storage manager holds a table with the given name.
   bool has_table(const std::string& name) const;
 
+  // Creates a B+-tree index on the given column of the table with the given name. The table maintains the index from
+  // then on, and TableScans on the table use it for selective predicates.
+  void create_index(const std::string& table_name, const ColumnID column_id);
+
+  // Returns the table index on the given column of the table with the given name, or nullptr if there is none.
+  std::shared_ptr<const BaseTableIndex> get_index(const std::string& table_name, const ColumnID column_id) const;
+
+  // Removes the table index on the given column of the table with the given name.
+  void drop_index(const std::string& table_name, const ColumnID column_id);
+
   // Returns a list of all table names.
   std::vector<std::string> table_names() const;
 
-  // Prints information about all tables in the storage manager (name, #columns, #rows, #chunks).
+  // Prints information about all tables in the storage manager (name, #columns, #rows, #chunks, memory usage). Below
+  // each table, the memory usage of its columns' segments is broken down by encoding.
   void print(std::ostream& out = std::cout) const;
 
   // Deletes the entire StorageManager and creates a new one, used especially in tests.
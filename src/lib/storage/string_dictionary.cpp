@@ -0,0 +1,203 @@
+#include "string_dictionary.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Front coding saves at least this share of the characters before it is used.
+constexpr auto MIN_FRONT_CODING_SAVINGS = 0.25;
+
+size_t common_prefix_length(const std::string_view lhs, const std::string_view rhs) {
+  const auto mismatch = std::mismatch(lhs.cbegin(), lhs.cbegin() + std::min(lhs.size(), rhs.size()), rhs.cbegin());
+  return static_cast<size_t>(std::distance(lhs.cbegin(), mismatch.first));
+}
+
+// Lengths are stored as variable-length integers (LEB128), so that short prefixes and suffixes need a single byte.
+void append_length(std::vector<char>& buffer, size_t length) {
+  while (length >= 0x80) {
+    buffer.push_back(static_cast<char>((length & 0x7F) | 0x80));
+    length >>= 7;
+  }
+  buffer.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const char*& position) {
+  auto length = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*position++);
+    length |= size_t{byte & 0x7Fu} << shift;
+    if (!(byte & 0x80u)) return length;
+    shift += 7;
+  }
+}
+
+std::string_view read_string(const char*& position, const size_t length) {
+  const auto string = std::string_view{position, length};
+  position += length;
+  return string;
+}
+
+bool should_front_code(const std::vector<std::string>& sorted_values) {
+  auto total_length = size_t{0};
+  auto shared_length = size_t{0};
+  for (auto index = size_t{0}; index < sorted_values.size(); ++index) {
+    total_length += sorted_values[index].size();
+    if (index % StringDictionary::BLOCK_SIZE != 0) {
+      shared_length += common_prefix_length(sorted_values[index - 1], sorted_values[index]);
+    }
+  }
+  return static_cast<double>(shared_length) >= MIN_FRONT_CODING_SAVINGS * static_cast<double>(total_length);
+}
+
+}  // namespace
+
+StringDictionary::StringDictionary(const std::vector<std::string>& sorted_values)
+    : StringDictionary(sorted_values, should_front_code(sorted_values)) {}
+
+StringDictionary::StringDictionary(const std::vector<std::string>& sorted_values, const bool front_coded)
+    : _front_coded(front_coded), _size(sorted_values.size()) {
+  DebugAssert(std::adjacent_find(sorted_values.cbegin(), sorted_values.cend(), std::greater_equal<>{}) ==
+                  sorted_values.cend(),
+              "Values have to be sorted and unique");
+
+  for (auto index = size_t{0}; index < _size; ++index) {
+    const auto& value = sorted_values[index];
+    if (!_front_coded) {
+      _offsets.push_back(static_cast<uint32_t>(_buffer.size()));
+      _buffer.insert(_buffer.end(), value.cbegin(), value.cend());
+    } else if (index % BLOCK_SIZE == 0) {
+      _offsets.push_back(static_cast<uint32_t>(_buffer.size()));
+      append_length(_buffer, value.size());
+      _buffer.insert(_buffer.end(), value.cbegin(), value.cend());
+    } else {
+      const auto prefix_length = common_prefix_length(sorted_values[index - 1], value);
+      append_length(_buffer, prefix_length);
+      append_length(_buffer, value.size() - prefix_length);
+      _buffer.insert(_buffer.end(), value.cbegin() + static_cast<std::ptrdiff_t>(prefix_length), value.cend());
+    }
+    Assert(_buffer.size() <= std::numeric_limits<uint32_t>::max(), "String dictionary exceeds 4 GB");
+  }
+  _offsets.push_back(static_cast<uint32_t>(_buffer.size()));
+
+  _buffer.shrink_to_fit();
+  _offsets.shrink_to_fit();
+}
+
+std::string StringDictionary::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Index is out of range");
+  if (!_front_coded) return std::string{_stored_entry(index)};
+
+  // Decode the block up to the requested entry.
+  const auto block_id = index / BLOCK_SIZE;
+  const auto* position = _buffer.data() + _offsets[block_id];
+  auto value = std::string{read_string(position, read_length(position))};
+  for (auto entry_index = block_id * BLOCK_SIZE + 1; entry_index <= index; ++entry_index) {
+    const auto prefix_length = read_length(position);
+    const auto suffix = read_string(position, read_length(position));
+    value.resize(prefix_length);
+    value.append(suffix);
+  }
+  return value;
+}
+
+std::string StringDictionary::front() const { return (*this)[0]; }
+
+std::string StringDictionary::back() const { return (*this)[_size - 1]; }
+
+size_t StringDictionary::size() const { return _size; }
+
+bool StringDictionary::empty() const { return _size == 0; }
+
+bool StringDictionary::is_front_coded() const { return _front_coded; }
+
+size_t StringDictionary::lower_bound(const std::string_view value) const { return _bound(value, false); }
+
+size_t StringDictionary::upper_bound(const std::string_view value) const { return _bound(value, true); }
+
+size_t StringDictionary::estimate_memory_usage() const {
+  return sizeof(char) * _buffer.capacity() + sizeof(uint32_t) * _offsets.capacity();
+}
+
+size_t StringDictionary::_bound(const std::string_view value, const bool is_upper_bound) const {
+  // An entry is before the bound if it is less than (lower bound) or less than or equal to (upper bound) the value.
+  const auto is_before_bound = [&](const size_t offset_index) {
+    const auto comparison = _stored_entry(offset_index).compare(value);
+    return comparison < 0 || (is_upper_bound && comparison == 0);
+  };
+
+  // Binary search over the entries or, with front coding, over the first entries of the blocks.
+  const auto offset_count = _offsets.size() - 1;
+  auto begin = size_t{0};
+  auto count = offset_count;
+  while (count > 0) {
+    const auto step = count / 2;
+    if (is_before_bound(begin + step)) {
+      begin += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+
+  if (!_front_coded) return begin;
+  // The first entry of block begin (if any) is the first block start after the bound. The bound is within the
+  // preceding block.
+  if (begin == 0) return 0;
+  return _bound_in_block(begin - 1, value, is_upper_bound);
+}
+
+size_t StringDictionary::_bound_in_block(const size_t block_id, const std::string_view value,
+                                         const bool is_upper_bound) const {
+  const auto* position = _buffer.data() + _offsets[block_id];
+  const auto first_entry = read_string(position, read_length(position));
+
+  // The previous entry is always before the bound. We track how it compares to the value and the length of the
+  // prefix it shares with the value. Together with the prefix length that the next entry shares with the previous
+  // one, this often decides the comparison without looking at the characters of the next entry.
+  auto shared_length = common_prefix_length(first_entry, value);
+  auto previous_equals_value = first_entry.size() == value.size() && shared_length == value.size();
+
+  const auto block_begin = block_id * BLOCK_SIZE;
+  const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+  for (auto index = block_begin + 1; index < block_end; ++index) {
+    // The entries are unique, so the entry after one that equals the value is greater.
+    if (previous_equals_value) return index;
+
+    const auto prefix_length = read_length(position);
+    const auto suffix = read_string(position, read_length(position));
+
+    // The entry differs from the previous one at prefix_length, where the previous entry still equals the value. As
+    // the entry is greater than the previous one, it is also greater than the value.
+    if (prefix_length < shared_length) return index;
+
+    // The entry equals the previous one up to and including the first position where the previous entry and the value
+    // differ. Thus, it is also less than the value.
+    if (prefix_length > shared_length) continue;
+
+    // The entry equals the value up to prefix_length, so the suffix decides.
+    const auto remaining_value = value.substr(prefix_length);
+    const auto comparison = suffix.compare(remaining_value);
+    if (comparison > 0 || (comparison == 0 && !is_upper_bound)) return index;
+    shared_length = prefix_length + common_prefix_length(suffix, remaining_value);
+    previous_equals_value = comparison == 0;
+  }
+  return block_end;
+}
+
+std::string_view StringDictionary::_stored_entry(const size_t offset_index) const {
+  const auto* position = _buffer.data() + _offsets[offset_index];
+  if (_front_coded) return read_string(position, read_length(position));
+  return std::string_view{position, _offsets[offset_index + 1] - _offsets[offset_index]};
+}
+
+}  // namespace opossum
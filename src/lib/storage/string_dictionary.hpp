@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+// StringDictionary is the dictionary of a DictionarySegment<std::string>. Instead of one std::string per entry, all
+// characters are stored in one contiguous buffer, which avoids an allocation and the std::string overhead per entry
+// and keeps neighbouring entries on the same cache lines.
+//
+// Without front coding, the buffer holds the plain entries and one offset per entry marks where it begins. With front
+// coding, the entries are grouped into blocks of BLOCK_SIZE. The first entry of a block is stored in full; all other
+// entries only store the length of the prefix they share with their predecessor and the remaining suffix. Only the
+// beginning of each block is stored as an offset. Accessing an entry then requires decoding its block up to the entry.
+//
+// The entries have to be sorted and unique. lower_bound and upper_bound compare the search value with the buffer
+// directly and do not create strings, even for front-coded blocks.
+class StringDictionary {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  StringDictionary() = default;
+
+  // Creates a dictionary from sorted, unique values. Front coding is used if it saves at least a quarter of the
+  // characters.
+  explicit StringDictionary(const std::vector<std::string>& sorted_values);
+
+  // Same as above, but front coding is explicitly enabled or disabled.
+  StringDictionary(const std::vector<std::string>& sorted_values, const bool front_coded);
+
+  // Returns the entry at a given index. This creates a string, so do not use it for searching.
+  std::string operator[](const size_t index) const;
+
+  std::string front() const;
+
+  std::string back() const;
+
+  // Returns the number of entries.
+  size_t size() const;
+
+  bool empty() const;
+
+  bool is_front_coded() const;
+
+  // Returns the index of the first entry >= value, or size() if there is none.
+  size_t lower_bound(const std::string_view value) const;
+
+  // Returns the index of the first entry > value, or size() if there is none.
+  size_t upper_bound(const std::string_view value) const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  size_t _bound(const std::string_view value, const bool is_upper_bound) const;
+
+  // Searches within a front-coded block whose first entry is known to be before the bound.
+  size_t _bound_in_block(const size_t block_id, const std::string_view value, const bool is_upper_bound) const;
+
+  // Returns the entry at the given index of a dictionary without front coding, or the first entry of the given block
+  // of a front-coded dictionary.
+  std::string_view _stored_entry(const size_t offset_index) const;
+
+  bool _front_coded{false};
+  size_t _size{0};
+  std::vector<char> _buffer;
+  // Without front coding, one offset per entry, otherwise one per block. The last offset is the end of the buffer.
+  std::vector<uint32_t> _offsets;
+};
+
+}  // namespace opossum
@@ -4,7 +4,10 @@
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <numeric>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -13,59 +16,178 @@
 
 #include "value_segment.hpp"
 
-#include "dictionary_segment.hpp"
+#include "contiguous_chunk_storage.hpp"
+#include "encoding_selector.hpp"
+#include "index/base_table_index.hpp"
+#include "memory/query_arena.hpp"
+#include "mvcc_data.hpp"
 #include "resolve_type.hpp"
+#include "segment_encoding_utils.hpp"
+#include "statistics/segment_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-Table::Table(const ChunkOffset target_chunk_size) : _target_chunk_size(target_chunk_size) { create_new_chunk(); }
+Table::Table(const ChunkOffset target_chunk_size, const UseMvcc use_mvcc)
+    : _target_chunk_size(target_chunk_size), _use_mvcc(use_mvcc), _memory_resource(current_memory_resource().get()) {
+  Assert(use_mvcc == UseMvcc::No || (target_chunk_size > 0 && target_chunk_size <= MAX_MVCC_CHUNK_SIZE),
+         "Tables that use MVCC need a bounded target chunk size");
+  create_new_chunk();
+}
 
-void Table::add_column_definition(const std::string& name, const std::string& type) {
-  // Implementation goes here
+void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
+  _column_names.push_back(name);
+  _column_types.push_back(type);
+  _column_nullable.push_back(nullable);
 }
 
-void Table::add_column(const std::string& name, const std::string& type) {
+void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
   // We only allow adding columns for empty tables to avoid dealing with default values
   Assert(row_count() == 0, "Adding a column is only allowed for empty tables");
-  _column_names.push_back(name);
-  _column_types.push_back(type);
-  resolve_data_type(type, [&_chunks = _chunks](auto type) {
-    using Type = typename decltype(type)::type;
-    _chunks.back()->add_segment(std::make_shared<ValueSegment<Type>>());
-  });
+  add_column_definition(name, type, nullable);
+  const auto lock = std::unique_lock{_chunks_mutex};
+  _chunks.back()->add_segment(_create_value_segment(type, nullable));
 }
 
-void Table::append(const std::vector<AllTypeVariant>& values) {
-  if (_chunks.back()->size() >= _target_chunk_size) {
+RowID Table::append(const std::vector<TaggedValue>& values, const TransactionID transaction_id) {
+  Assert(transaction_id == INVALID_TRANSACTION_ID || uses_mvcc(), "Only tables that use MVCC support transactions");
+  const auto append_lock = std::lock_guard{_append_mutex};
+  if (_last_chunk_is_full()) {
     create_new_chunk();
   }
-  _chunks.back()->append(values);
+
+  // Only appends modify the last chunk, so it can be used without holding the lock on the chunk list.
+  auto chunk = std::shared_ptr<Chunk>{};
+  auto chunk_id = ChunkID{0};
+  {
+    const auto chunks_lock = std::shared_lock{_chunks_mutex};
+    chunk = _chunks.back();
+    chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  }
+
+  chunk->append(values);
+  if (const auto& mvcc_data = chunk->mvcc_data()) {
+    // Rows without a transaction are visible to everyone, rows of a transaction only once it committed.
+    mvcc_data->append(transaction_id, transaction_id == INVALID_TRANSACTION_ID ? CommitID{0} : MAX_COMMIT_ID);
+  }
+
+  const auto row_id = RowID{chunk_id, chunk->size() - 1};
+  for (const auto& index : _indexes) {
+    const auto& value = values[index->column_id()];
+    if (!value.is_null()) index->insert(value, row_id);
+  }
+  return row_id;
+}
+
+ChunkID Table::emplace_chunk(const std::shared_ptr<Chunk> chunk) {
+  if (uses_mvcc() && !chunk->has_mvcc_data()) {
+    const auto chunk_size = chunk->size();
+    const auto mvcc_data = std::make_shared<MvccData>(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->append(INVALID_TRANSACTION_ID, CommitID{0});
+    }
+    chunk->set_mvcc_data(mvcc_data);
+  }
+
+  const auto append_lock = std::lock_guard{_append_mutex};
+  auto chunk_id = ChunkID{0};
+  {
+    const auto chunks_lock = std::unique_lock{_chunks_mutex};
+    // The table always holds at least one chunk. If that chunk is still empty, it is replaced instead of being kept as
+    // an empty first chunk in front of the emplaced one.
+    if (_chunks.size() == 1 && _chunks.front()->size() == 0) {
+      _chunks.front() = chunk;
+    } else {
+      // Appends are serialized by the append mutex, so the last chunk does not grow while it is sealed.
+      if (const auto& mvcc_data = _chunks.back()->mvcc_data()) mvcc_data->seal();
+      _chunks.push_back(chunk);
+    }
+    chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  }
+
+  for (const auto& index : _indexes) {
+    index->insert_chunk(*chunk, chunk_id);
+  }
+  return chunk_id;
 }
 
 void Table::create_new_chunk() {
-  auto new_chunk = std::make_shared<Chunk>();
-  _chunks.push_back(new_chunk);
-  for (const auto& type : _column_types) {
-    resolve_data_type(type, [&new_chunk](auto type) {
-      using Type = typename decltype(type)::type;
-      new_chunk->add_segment(std::make_shared<ValueSegment<Type>>());
-    });
+  auto new_chunk = std::allocate_shared<Chunk>(std::pmr::polymorphic_allocator<Chunk>{_memory_resource});
+  const auto column_count = _column_types.size();
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    new_chunk->add_segment(_create_value_segment(_column_types[column_id], _column_nullable[column_id]));
   }
+  if (uses_mvcc()) {
+    new_chunk->set_mvcc_data(std::make_shared<MvccData>(_target_chunk_size));
+  }
+
+  const auto lock = std::unique_lock{_chunks_mutex};
+  _chunks.push_back(new_chunk);
+}
+
+std::shared_ptr<AbstractSegment> Table::_create_value_segment(const std::string& type, const bool nullable) const {
+  auto segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto value_segment = std::allocate_shared<ValueSegment<Type>>(
+        std::pmr::polymorphic_allocator<ValueSegment<Type>>{_memory_resource}, nullable);
+    if (uses_mvcc()) value_segment->reserve(_target_chunk_size);
+    segment = value_segment;
+  });
+  return segment;
+}
+
+bool Table::_last_chunk_is_full() const {
+  const auto lock = std::shared_lock{_chunks_mutex};
+  const auto& chunk = *_chunks.back();
+  // Chunks with MVCC data are preallocated and cannot grow beyond their capacity, which is the target chunk size for
+  // chunks created by the table but may be smaller for emplaced chunks.
+  if (const auto& mvcc_data = chunk.mvcc_data()) return chunk.size() >= mvcc_data->capacity();
+  // A target chunk size of 0 means that chunks are not size-limited.
+  return _target_chunk_size > 0 && chunk.size() >= _target_chunk_size;
 }
 
 ColumnCount Table::column_count() const { return static_cast<ColumnCount>(_column_names.size()); }
 
 ChunkOffset Table::row_count() const {
-  // Calculate the count of all full chunks multiplied by the target/max chunk size
-  // and then add the size of the last, incomplete chunk
-  // Since our knowledge about chunks is still limited, we assume that this is the right
-  // method for now. This is up to change later.
-  return ChunkOffset{(chunk_count() - 1) * _target_chunk_size + _chunks.back()->size()};
+  // Chunks emplaced by operators do not necessarily fill up to the target chunk size, so we cannot derive the row count
+  // from the number of chunks.
+  const auto lock = std::shared_lock{_chunks_mutex};
+  auto row_count = ChunkOffset{0};
+  for (const auto& chunk : _chunks) {
+    row_count += chunk->size();
+  }
+  return row_count;
+}
+
+ChunkOffset Table::approx_valid_row_count() const {
+  const auto lock = std::shared_lock{_chunks_mutex};
+  auto valid_row_count = ChunkOffset{0};
+  for (const auto& chunk : _chunks) {
+    valid_row_count += chunk->size() - chunk->invalid_row_count();
+  }
+  return valid_row_count;
+}
+
+size_t Table::memory_usage() const {
+  auto memory_usage = size_t{0};
+  {
+    const auto lock = std::shared_lock{_chunks_mutex};
+    for (const auto& chunk : _chunks) {
+      memory_usage += chunk->memory_usage();
+    }
+  }
+  for (const auto& index : _indexes) {
+    memory_usage += index->estimate_memory_usage();
+  }
+  return memory_usage;
 }
 
-ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
+ChunkID Table::chunk_count() const {
+  const auto lock = std::shared_lock{_chunks_mutex};
+  return static_cast<ChunkID>(_chunks.size());
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   // Since this method is only used for debugging, we are fine with a linear
@@ -86,25 +208,46 @@ const std::string& Table::column_name(const ColumnID column_id) const { return _
 
 const std::string& Table::column_type(const ColumnID column_id) const { return _column_types.at(column_id); }
 
-std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) { return _chunks.at(chunk_id); }
+bool Table::column_is_nullable(const ColumnID column_id) const { return _column_nullable.at(column_id); }
+
+bool Table::uses_mvcc() const { return _use_mvcc == UseMvcc::Yes; }
+
+void Table::set_chunk_layout(const ChunkLayout chunk_layout) { _chunk_layout = chunk_layout; }
+
+ChunkLayout Table::chunk_layout() const { return _chunk_layout; }
 
-std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const { return _chunks.at(chunk_id); }
+std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
+  const auto lock = std::shared_lock{_chunks_mutex};
+  return _chunks.at(chunk_id);
+}
+
+std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
+  const auto lock = std::shared_lock{_chunks_mutex};
+  return _chunks.at(chunk_id);
+}
 
-void Table::compress_chunk(const ChunkID chunk_id) {
+void Table::compress_chunk(const ChunkID chunk_id, const EncodingType encoding_type) {
   const auto input_chunk = get_chunk(chunk_id);
   const auto column_count = input_chunk->column_count();
+  Assert(!input_chunk->has_mvcc_data() || input_chunk->size() == input_chunk->mvcc_data()->capacity(),
+         "Only full chunks of tables that use MVCC can be compressed");
+  // Check the encoding upfront, as exceptions cannot be passed out of the compression threads.
+  for (const auto& column_type : _column_types) {
+    Assert(is_encoding_supported(encoding_type, column_type), "Encoding not supported for column type " + column_type);
+  }
   auto threads = std::vector<std::thread>();
   threads.reserve(column_count);
   const auto compressed_chunk = std::make_shared<Chunk>();
   std::vector<std::shared_ptr<AbstractSegment>> compressed_segments(column_count);
+  auto encoding_types = std::vector<EncodingType>(column_count);
 
   for (ColumnID index{0}; index < column_count; ++index) {
-    threads.emplace_back([this, index, &input_chunk, &compressed_segments] {
-      resolve_data_type(_column_types[index], [index, &input_chunk, &compressed_segments](auto type) {
-        using DataType = typename decltype(type)::type;
-        const auto segment = input_chunk->get_segment(index);
-        compressed_segments[index] = std::make_shared<DictionarySegment<DataType>>(segment);
-      });
+    threads.emplace_back([this, index, encoding_type, &input_chunk, &compressed_segments, &encoding_types] {
+      const auto segment = input_chunk->get_segment(index);
+      const auto& column_type = _column_types[index];
+      encoding_types[index] =
+          encoding_type == EncodingType::Automatic ? EncodingSelector{}.select(column_type, *segment) : encoding_type;
+      compressed_segments[index] = encode_segment(encoding_types[index], column_type, segment);
     });
   }
 
@@ -112,10 +255,50 @@ void Table::compress_chunk(const ChunkID chunk_id) {
     thread.join();
   }
 
+  if (_chunk_layout == ChunkLayout::Contiguous) {
+    compressed_chunk->set_contiguous_storage(ContiguousChunkStorage::store_segments(compressed_segments));
+  }
+
+  auto statistics = std::vector<std::shared_ptr<const BaseSegmentStatistics>>(column_count);
   for (size_t index = 0; index < column_count; ++index) {
     compressed_chunk->add_segment(compressed_segments[index]);
+    statistics[index] = BaseSegmentStatistics::create(*compressed_segments[index]);
   }
+  compressed_chunk->set_statistics(std::move(statistics));
+  compressed_chunk->set_encoding_types(std::move(encoding_types));
+  // The compressed chunk holds the same rows at the same offsets, so the table indexes and the MVCC data do not have to
+  // be updated. Sharing the MVCC data also shares the count of invalid rows.
+  compressed_chunk->set_mvcc_data(input_chunk->mvcc_data());
+  compressed_chunk->set_cleanup_commit_id(input_chunk->cleanup_commit_id());
+  const auto lock = std::unique_lock{_chunks_mutex};
   _chunks[chunk_id] = compressed_chunk;
 }
 
+void Table::replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk> chunk) {
+  Assert(chunk->column_count() == column_count(), "Chunk does not match the columns of the table");
+  Assert(_indexes.empty(), "Chunks of tables with table indexes cannot be replaced");
+  const auto lock = std::unique_lock{_chunks_mutex};
+  _chunks.at(chunk_id) = chunk;
+}
+
+void Table::add_index(const std::shared_ptr<BaseTableIndex>& index) {
+  Assert(index->column_id() < column_count(), "Indexed column does not exist");
+  Assert(!uses_mvcc(), "Table indexes are not supported for tables that use MVCC");
+  Assert(!get_index(index->column_id()), "Column already has a table index");
+  _indexes.push_back(index);
+}
+
+std::shared_ptr<const BaseTableIndex> Table::get_index(const ColumnID column_id) const {
+  const auto iter = std::find_if(_indexes.cbegin(), _indexes.cend(),
+                                 [&](const auto& index) { return index->column_id() == column_id; });
+  return iter != _indexes.cend() ? *iter : nullptr;
+}
+
+void Table::drop_index(const ColumnID column_id) {
+  const auto iter = std::find_if(_indexes.cbegin(), _indexes.cend(),
+                                 [&](const auto& index) { return index->column_id() == column_id; });
+  Assert(iter != _indexes.cend(), "Column has no table index");
+  _indexes.erase(iter);
+}
+
 }  // namespace opossum
@@ -1,15 +1,20 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_segment.hpp"
 #include "chunk.hpp"
+#include "encoding_type.hpp"
+#include "tagged_value.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -17,14 +22,28 @@
 
 namespace opossum {
 
+class BaseTableIndex;
 class TableStatistics;
 
-// A table is partitioned horizontally into a number of chunks
+// A table is partitioned horizontally into a number of chunks.
+//
+// Tables that use MVCC keep MvccData for every chunk, so that readers only see the rows that are visible to their
+// transaction (see Validate). Their chunks are allocated for the target chunk size upfront, so that readers can access
+// rows while rows are appended to the same chunk. Appends are serialized, but neither they nor readers lock the rows.
+//
+// The chunks that the table creates itself come from the memory resource that was current when the table was created
+// (see current_memory_resource). Thus, intermediate tables that operators create inside a QueryArena keep their chunks
+// in the arena, whereas stored tables keep using the global allocator, even if rows are inserted by a query.
 class Table : private Noncopyable {
  public:
+  // Tables that use MVCC preallocate their chunks, so their target chunk size must not exceed this.
+  static constexpr auto MAX_MVCC_CHUNK_SIZE = ChunkOffset{1u << 20u};
+
   // Creates a table. The parameter specifies the maximum chunk size, i.e., partition size default is the maximum chunk
-  // size minus 1. A table holds always at least one chunk.
-  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+  // size minus 1. A target chunk size of 0 means that chunks are unlimited. A table holds always at least one chunk.
+  // Tables that use MVCC need a target chunk size between 1 and MAX_MVCC_CHUNK_SIZE.
+  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+                 const UseMvcc use_mvcc = UseMvcc::No);
 
   // Returns the number of columns (cannot exceed ColumnID (uint16_t)).
   ColumnCount column_count() const;
@@ -33,6 +52,15 @@ class Table : private Noncopyable {
   // approximate count of valid rows instead.
   ChunkOffset row_count() const;
 
+  // Returns the number of rows that are not invalidated, i.e., neither deleted by a committed transaction nor inserted
+  // by a transaction that rolled back. The chunks count their invalid rows, so this is as cheap as row_count(). It is
+  // approximate because rows of running transactions are counted as valid and commits update the counts only after
+  // they became visible.
+  ChunkOffset approx_valid_row_count() const;
+
+  // Returns the estimated memory usage of the table, i.e., of its chunks (see Chunk::memory_usage) and table indexes.
+  size_t memory_usage() const;
+
   // Returns the number of chunks (cannot exceed ChunkID (uint32_t)).
   ChunkID chunk_count() const;
 
@@ -56,36 +84,98 @@ class Table : private Noncopyable {
   // Return the target chunk size (cannot exceed ChunkOffset (uint32_t)).
   ChunkOffset target_chunk_size() const;
 
+  // Returns whether the nth column can hold NULL values.
+  bool column_is_nullable(const ColumnID column_id) const;
+
+  // Returns whether the chunks of the table have MvccData.
+  bool uses_mvcc() const;
+
+  // Sets the memory layout of the chunks that are compressed from then on. Defaults to ChunkLayout::Segmented.
+  void set_chunk_layout(const ChunkLayout chunk_layout);
+
+  ChunkLayout chunk_layout() const;
+
   // Adds column definition without creating the actual columns. This is helpful when, e.g., an operator first creates
   // the structure of the table and then adds chunk by chunk.
-  void add_column_definition(const std::string& name, const std::string& type);
+  void add_column_definition(const std::string& name, const std::string& type, const bool nullable = false);
 
   // Adds a column to the end, i.e., right, of the table. This can only be done if the table does not yet have any
-  // entries, because we would otherwise have to deal with default values.
-  void add_column(const std::string& name, const std::string& type);
+  // entries, because we would otherwise have to deal with default values. Only nullable columns accept NULL values.
+  void add_column(const std::string& name, const std::string& type, const bool nullable = false);
 
-  // Inserts a row at the end of the table. Note this is slow and not thread-safe and should be used for testing
-  // purposes only.
-  void append(const std::vector<AllTypeVariant>& values);
+  // Inserts a row at the end of the table and returns its position. NULL values are not added to the table indexes.
+  // Appends are thread-safe for tables that use MVCC. Rows appended without a transaction are visible to all
+  // transactions right away, whereas rows of a transaction become visible once it commits (see TransactionContext).
+  // Note this is slow and should be used for testing and loading purposes only.
+  RowID append(const std::vector<TaggedValue>& values, const TransactionID transaction_id = INVALID_TRANSACTION_ID);
 
   // Creates a new chunk and appends it.
   void create_new_chunk();
 
-  // Compresses a ValueColumn into a DictionaryColumn.
-  void compress_chunk(const ChunkID chunk_id);
+  // Appends an already populated chunk, e.g., one that was created by an operator. Its segments have to match the
+  // column definitions of the table. If the table only holds a single empty chunk, that chunk is replaced. Tables that
+  // use MVCC attach MvccData to chunks without it, in which all rows are visible. As rows are only appended to the last
+  // chunk, a previous last chunk that is not full is sealed (see MvccData::seal), so that it can be compressed and
+  // compacted like other full chunks. Returns the id of the chunk.
+  ChunkID emplace_chunk(const std::shared_ptr<Chunk> chunk);
+
+  // Replaces the ValueSegments of a chunk with segments of the given encoding, one thread per column. With
+  // EncodingType::Automatic, the encoding is chosen per segment by the EncodingSelector. The chosen encodings are
+  // recorded in the chunk (see Chunk::encoding_types). Tables that use MVCC can only compress full chunks. With
+  // ChunkLayout::Contiguous, the fixed-width arrays of the compressed segments share a ContiguousChunkStorage.
+  void compress_chunk(const ChunkID chunk_id, const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Atomically replaces the chunk with the given id, e.g., by an empty chunk once the ChunkCompactor retired it.
+  // Readers that got the old chunk before keep it alive, so replacing never blocks them.
+  void replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk> chunk);
+
+  // Attaches a table-wide index, which is maintained by append and emplace_chunk from then on. Use
+  // StorageManager::create_index to create indexes. A column can only have one table index. Table indexes are not
+  // thread-safe and thus not supported for tables that use MVCC.
+  void add_index(const std::shared_ptr<BaseTableIndex>& index);
+
+  // Returns the table index on the given column, or nullptr if there is none.
+  std::shared_ptr<const BaseTableIndex> get_index(const ColumnID column_id) const;
+
+  // Detaches the table index on the given column.
+  void drop_index(const ColumnID column_id);
 
  protected:
+  // Creates an empty ValueSegment for a new chunk. Tables that use MVCC reserve the target chunk size.
+  std::shared_ptr<AbstractSegment> _create_value_segment(const std::string& type, const bool nullable) const;
+
+  // Returns whether the next row has to go to a new chunk.
+  bool _last_chunk_is_full() const;
+
   // Map column_id as index to names
   std::vector<std::string> _column_names;
 
   // Map column_id as index to data types
   std::vector<std::string> _column_types;
 
+  // Map column_id as index to whether the column accepts NULL values
+  std::vector<bool> _column_nullable;
+
   // Store a list of chunks. Chunks point to individual segments
   std::vector<std::shared_ptr<Chunk>> _chunks;
 
+  // Protects _chunks, i.e., the list itself and not the chunks, against concurrent appends and readers
+  mutable std::shared_mutex _chunks_mutex;
+
+  // Serializes append
+  std::mutex _append_mutex;
+
   // Maximum chunk size passed by constructor
   const ChunkOffset _target_chunk_size;
+
+  const UseMvcc _use_mvcc;
+
+  std::pmr::memory_resource* const _memory_resource;
+
+  std::atomic<ChunkLayout> _chunk_layout{ChunkLayout::Segmented};
+
+  // Table-wide indexes that are updated whenever rows are added
+  std::vector<std::shared_ptr<BaseTableIndex>> _indexes;
 };
 
 }  // namespace opossum
@@ -12,14 +12,51 @@
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(const bool nullable) {
+  if (nullable) _null_bitmap.emplace();
+}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(const ValueSegment& segment,
+                              const std::shared_ptr<std::pmr::memory_resource>& memory_resource)
+    : _memory_resource(memory_resource), _values(segment._values, memory_resource.get()) {
+  if (segment._null_bitmap) _null_bitmap.emplace(*segment._null_bitmap, memory_resource.get());
+}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) return NULL_VALUE;
   return _values[chunk_offset];
 }
 
 template <typename T>
-void ValueSegment<T>::append(const AllTypeVariant& val) {
+void ValueSegment<T>::append(const TaggedValue& val) {
+  if (val.is_null()) {
+    Assert(_null_bitmap, "NULL values can only be appended to nullable segments");
+    _values.emplace_back();
+    _null_bitmap->push_back(true);
+    return;
+  }
+
   _values.push_back(type_cast<T>(val));
+  if (_null_bitmap) _null_bitmap->push_back(false);
+}
+
+template <typename T>
+void ValueSegment<T>::reserve(const ChunkOffset capacity) {
+  _values.reserve(capacity);
+  if (_null_bitmap) _null_bitmap->reserve(capacity);
+}
+
+template <typename T>
+bool ValueSegment<T>::is_nullable() const {
+  return _null_bitmap.has_value();
+}
+
+template <typename T>
+bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return _null_bitmap && (*_null_bitmap)[chunk_offset];
 }
 
 template <typename T>
@@ -28,15 +65,21 @@ ChunkOffset ValueSegment<T>::size() const {
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+const std::pmr::vector<T>& ValueSegment<T>::values() const {
   return _values;
 }
 
+template <typename T>
+const std::optional<NullBitmap>& ValueSegment<T>::null_bitmap() const {
+  return _null_bitmap;
+}
+
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
   // Size would work, too, but capacity is better because it
   // also catches the potential allocated space by the vector
-  return sizeof(T) * _values.capacity();
+  const auto null_bitmap_size = _null_bitmap ? _null_bitmap->estimate_memory_usage() : size_t{0};
+  return sizeof(T) * _values.capacity() + null_bitmap_size;
 }
 
 // Macro to instantiate the following classes:
@@ -1,23 +1,44 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_segment.hpp"
+#include "null_bitmap.hpp"
 
 namespace opossum {
 
-// ValueSegment is a segment type that stores all its values in a vector.
+// ValueSegment is a segment type that stores all its values in a vector. Nullable segments additionally keep a
+// NullBitmap. NULL rows hold T{} in the value vector, which scans have to mask with the bitmap.
 template <typename T>
 class ValueSegment : public AbstractSegment {
  public:
+  // Creates an empty segment. Only nullable segments accept NULL values.
+  explicit ValueSegment(const bool nullable = false);
+
+  // Copies the values and NULL flags of the segment into the given memory resource, which the new segment keeps alive.
+  // Used for the contiguous layout of compressed chunks (see ContiguousChunkStorage).
+  ValueSegment(const ValueSegment& segment, const std::shared_ptr<std::pmr::memory_resource>& memory_resource);
+
   // Return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
   // Add a value to the end.
-  void append(const AllTypeVariant& val) final;
+  void append(const TaggedValue& val) final;
+
+  // Allocates memory for the given number of values. Appending up to this size does not move existing values, which
+  // allows concurrent readers of the mutable chunks of tables that use MVCC (see Table).
+  void reserve(const ChunkOffset capacity);
+
+  // Returns whether the segment can hold NULL values.
+  bool is_nullable() const;
+
+  // Returns whether the row at the given offset is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
 
   // Return the number of entries.
   ChunkOffset size() const final;
@@ -25,14 +46,20 @@ class ValueSegment : public AbstractSegment {
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const std::pmr::vector<T>& values() const;
+
+  // Returns the NULL flags of all rows, or std::nullopt if the segment is not nullable.
+  const std::optional<NullBitmap>& null_bitmap() const;
 
   // Returns the calculated memory usage.
   size_t estimate_memory_usage() const final;
 
  protected:
+  // Declared first, as the values and the NULL bitmap have to be destroyed before the memory resource they live in.
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
   // Stores a list of actual values of template type T
-  std::vector<T> _values;
+  std::pmr::vector<T> _values;
+  std::optional<NullBitmap> _null_bitmap;
 };
 
 }  // namespace opossum
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/hana/contains.hpp>
+
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// TaggedValue holds a value of any of the data types, like AllTypeVariant, but is meant for code that handles rows
+// generically and only needs the values for a short time, e.g., Table::append or AbstractSegment::append. It consists
+// of a type tag and an untagged payload and is trivially copyable, so creating, copying, and destroying it costs
+// nothing, and visiting it is a single switch.
+//
+// Strings are not copied: a TaggedValue holding a string only references the characters of the std::string, string
+// literal, or AllTypeVariant it was created from and must not outlive it. Use AllTypeVariant to keep values around.
+//
+// The type index follows the order of data_types and thus matches AllTypeVariant::which(), including NULL_TYPE_INDEX
+// for NULL.
+class TaggedValue {
+ public:
+  template <typename T>
+  static constexpr auto TYPE_INDEX = static_cast<uint8_t>(std::is_same_v<T, NullValue>
+                                                              ? NULL_TYPE_INDEX
+                                                              : detail::index_of(types, hana::type_c<T>));
+
+  TaggedValue(const NullValue) : _type_index(TYPE_INDEX<NullValue>) {  // NOLINT(runtime/explicit)
+    _payload.long_value = 0;
+  }
+
+  TaggedValue(const int32_t value) : _type_index(TYPE_INDEX<int32_t>) {  // NOLINT(runtime/explicit)
+    _payload.int_value = value;
+  }
+
+  TaggedValue(const int64_t value) : _type_index(TYPE_INDEX<int64_t>) {  // NOLINT(runtime/explicit)
+    _payload.long_value = value;
+  }
+
+  TaggedValue(const float value) : _type_index(TYPE_INDEX<float>) {  // NOLINT(runtime/explicit)
+    _payload.float_value = value;
+  }
+
+  TaggedValue(const double value) : _type_index(TYPE_INDEX<double>) {  // NOLINT(runtime/explicit)
+    _payload.double_value = value;
+  }
+
+  TaggedValue(const std::string_view value)  // NOLINT(runtime/explicit)
+      : _string_size(static_cast<uint32_t>(value.size())), _type_index(TYPE_INDEX<std::string>) {
+    DebugAssert(value.size() <= std::numeric_limits<uint32_t>::max(), "String is too long for a TaggedValue");
+    _payload.string_data = value.data();
+  }
+
+  TaggedValue(const std::string& value) : TaggedValue(std::string_view{value}) {}  // NOLINT(runtime/explicit)
+
+  TaggedValue(const char* value) : TaggedValue(std::string_view{value}) {}  // NOLINT(runtime/explicit)
+
+  TaggedValue(const AllTypeVariant& value)  // NOLINT(runtime/explicit)
+      : TaggedValue(boost::apply_visitor([](const auto& typed_value) { return TaggedValue{typed_value}; }, value)) {}
+
+  size_t type_index() const {
+    return _type_index;
+  }
+
+  template <typename T>
+  bool is() const {
+    return _type_index == TYPE_INDEX<T>;
+  }
+
+  bool is_null() const {
+    return _type_index == TYPE_INDEX<NullValue>;
+  }
+
+  // Returns the value without conversion. Strings are returned as std::string_view.
+  template <typename T>
+  auto get() const {
+    static_assert(hana::contains(types, hana::type_c<T>), "Type not in data_types");
+    DebugAssert(is<T>(), "TaggedValue holds a different type");
+    if constexpr (std::is_same_v<T, int32_t>) {
+      return _payload.int_value;
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+      return _payload.long_value;
+    } else if constexpr (std::is_same_v<T, float>) {
+      return _payload.float_value;
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _payload.double_value;
+    } else {
+      return std::string_view{_payload.string_data, _string_size};
+    }
+  }
+
+  // Calls the functor with the value as int32_t, int64_t, float, double, std::string_view, or NullValue.
+  template <typename Functor>
+  decltype(auto) visit(Functor&& functor) const {
+    switch (_type_index) {
+      case TYPE_INDEX<NullValue>:
+        return functor(NullValue{});
+      case TYPE_INDEX<int32_t>:
+        return functor(get<int32_t>());
+      case TYPE_INDEX<int64_t>:
+        return functor(get<int64_t>());
+      case TYPE_INDEX<float>:
+        return functor(get<float>());
+      case TYPE_INDEX<double>:
+        return functor(get<double>());
+      default:
+        return functor(get<std::string>());
+    }
+  }
+
+  // Creates an AllTypeVariant that owns a copy of the value.
+  AllTypeVariant to_all_type_variant() const {
+    return visit([](const auto& typed_value) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(typed_value)>, std::string_view>) {
+        return AllTypeVariant{std::string{typed_value}};
+      } else {
+        return AllTypeVariant{typed_value};
+      }
+    });
+  }
+
+ protected:
+  union {
+    int32_t int_value;
+    int64_t long_value;
+    float float_value;
+    double double_value;
+    const char* string_data;
+  } _payload;
+  uint32_t _string_size = 0;
+  uint8_t _type_index;
+};
+
+static_assert(std::is_trivially_copyable_v<TaggedValue>, "TaggedValue has to be trivially copyable");
+static_assert(sizeof(TaggedValue) == 16, "TaggedValue should fit into two registers");
+
+inline std::ostream& operator<<(std::ostream& stream, const TaggedValue& value) {
+  value.visit([&](const auto& typed_value) { stream << typed_value; });
+  return stream;
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "tpch_queries.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/aggregate.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Column ids as created by the TpchTableGenerator.
+constexpr auto O_ORDERDATE = ColumnID{4};
+constexpr auto L_ORDERKEY = ColumnID{0};
+constexpr auto L_QUANTITY = ColumnID{4};
+constexpr auto L_EXTENDEDPRICE = ColumnID{5};
+constexpr auto L_DISCOUNT = ColumnID{6};
+constexpr auto L_RETURNFLAG = ColumnID{8};
+constexpr auto L_LINESTATUS = ColumnID{9};
+constexpr auto L_SHIPDATE = ColumnID{10};
+
+// Scans column_id of the input for values in [lower_bound, upper_bound).
+std::shared_ptr<AbstractOperator> scan_range(const std::shared_ptr<AbstractOperator>& input, const ColumnID column_id,
+                                             const AllTypeVariant& lower_bound, const AllTypeVariant& upper_bound) {
+  const auto lower_scan = std::make_shared<TableScan>(input, column_id, ScanType::OpGreaterThanEquals, lower_bound);
+  return std::make_shared<TableScan>(lower_scan, column_id, ScanType::OpLessThan, upper_bound);
+}
+
+std::shared_ptr<AbstractOperator> create_q1_plan() {
+  const auto lineitem = std::make_shared<GetTable>("lineitem");
+  const auto shipdate_scan =
+      std::make_shared<TableScan>(lineitem, L_SHIPDATE, ScanType::OpLessThanEquals, "1998-09-02");
+  // l_orderkey is never NULL, so counting it counts the rows.
+  return std::make_shared<Aggregate>(shipdate_scan, std::vector<ColumnID>{L_RETURNFLAG, L_LINESTATUS},
+                                     std::vector<AggregateColumnDefinition>{{L_QUANTITY, AggregateFunction::Sum},
+                                                                            {L_EXTENDEDPRICE, AggregateFunction::Sum},
+                                                                            {L_QUANTITY, AggregateFunction::Avg},
+                                                                            {L_EXTENDEDPRICE, AggregateFunction::Avg},
+                                                                            {L_DISCOUNT, AggregateFunction::Avg},
+                                                                            {L_ORDERKEY, AggregateFunction::Count}});
+}
+
+std::shared_ptr<AbstractOperator> create_q4_plan() {
+  const auto orders = std::make_shared<GetTable>("orders");
+  return scan_range(orders, O_ORDERDATE, "1993-07-01", "1993-10-01");
+}
+
+std::shared_ptr<AbstractOperator> create_q6_plan() {
+  const auto lineitem = std::make_shared<GetTable>("lineitem");
+  const auto shipdate_scan = scan_range(lineitem, L_SHIPDATE, "1994-01-01", "1995-01-01");
+  const auto discount_lower_scan =
+      std::make_shared<TableScan>(shipdate_scan, L_DISCOUNT, ScanType::OpGreaterThanEquals, 0.05f);
+  const auto discount_upper_scan =
+      std::make_shared<TableScan>(discount_lower_scan, L_DISCOUNT, ScanType::OpLessThanEquals, 0.07f);
+  const auto quantity_scan =
+      std::make_shared<TableScan>(discount_upper_scan, L_QUANTITY, ScanType::OpLessThan, 24.0f);
+  return std::make_shared<Aggregate>(quantity_scan, std::vector<ColumnID>{},
+                                     std::vector<AggregateColumnDefinition>{{L_EXTENDEDPRICE, AggregateFunction::Sum},
+                                                                            {L_ORDERKEY, AggregateFunction::Count}});
+}
+
+std::shared_ptr<AbstractOperator> create_q14_plan() {
+  const auto lineitem = std::make_shared<GetTable>("lineitem");
+  return scan_range(lineitem, L_SHIPDATE, "1995-09-01", "1995-10-01");
+}
+
+}  // namespace
+
+const std::vector<TpchQuery>& tpch_queries() {
+  static const auto queries = std::vector<TpchQuery>{
+      {"Q1", create_q1_plan}, {"Q4", create_q4_plan}, {"Q6", create_q6_plan}, {"Q14", create_q14_plan}};
+  return queries;
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Hand-built operator plans for TPC-H queries on the tables of the TpchTableGenerator, which are looked up in the
+// StorageManager. As there are no join, projection, or sort operators yet, the plans of queries with joins cover their
+// selective scans only, i.e., their output is the input of the query's first join. Aggregates over expressions, such as
+// sum(l_extendedprice * (1 - l_discount)), are left out, and the groups are not sorted:
+//
+// Q1:  lineitem with l_shipdate <= '1998-09-02', grouped by l_returnflag and l_linestatus, with sum(l_quantity),
+//      sum(l_extendedprice), avg(l_quantity), avg(l_extendedprice), avg(l_discount), and count(*)
+// Q4:  orders with '1993-07-01' <= o_orderdate < '1993-10-01'
+// Q6:  lineitem with '1994-01-01' <= l_shipdate < '1995-01-01', 0.05 <= l_discount <= 0.07, and l_quantity < 24,
+//      with sum(l_extendedprice) and count(*)
+// Q14: lineitem with '1995-09-01' <= l_shipdate < '1995-10-01'
+struct TpchQuery {
+  std::string name;
+
+  // Creates a new plan and returns its root. Operators can only be executed once, so every run needs its own plan.
+  std::function<std::shared_ptr<AbstractOperator>()> create_plan;
+};
+
+// Returns the supported queries in the order of their numbers.
+const std::vector<TpchQuery>& tpch_queries();
+
+}  // namespace opossum
@@ -0,0 +1,342 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Base cardinalities at scale factor 1, see TPC-H specification, Section 4.2.5.
+constexpr auto SUPPLIERS_PER_SCALE_FACTOR = 10'000.0f;
+constexpr auto PARTS_PER_SCALE_FACTOR = 200'000.0f;
+constexpr auto CUSTOMERS_PER_SCALE_FACTOR = 150'000.0f;
+constexpr auto ORDERS_PER_CUSTOMER = 10;
+constexpr auto SUPPLIERS_PER_PART = 4;
+
+// Dates are handled as days since 1970-01-01.
+int32_t days_from_civil(const int32_t year, const int32_t month, const int32_t day) {
+  // Algorithm by Howard Hinnant, http://howardhinnant.github.io/date_algorithms.html
+  const auto shifted_year = month <= 2 ? year - 1 : year;
+  const auto era = (shifted_year >= 0 ? shifted_year : shifted_year - 399) / 400;
+  const auto year_of_era = shifted_year - era * 400;
+  const auto day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+std::string date_to_string(const int32_t days) {
+  const auto shifted_days = days + 719468;
+  const auto era = (shifted_days >= 0 ? shifted_days : shifted_days - 146096) / 146097;
+  const auto day_of_era = shifted_days - era * 146097;
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;
+  const auto day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  const auto month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  const auto year = year_of_era + era * 400 + (month <= 2);
+
+  auto buffer = std::array<char, 48>{};
+  std::snprintf(buffer.data(), buffer.size(), "%04d-%02d-%02d", year, month, day);
+  return std::string{buffer.data()};
+}
+
+const auto START_DATE = days_from_civil(1992, 1, 1);
+const auto END_DATE = days_from_civil(1998, 12, 31);
+const auto CURRENT_DATE = days_from_civil(1995, 6, 17);
+
+// Value lists from the TPC-H specification, Section 4.2.2.13 and 4.2.3.
+const auto REGIONS = std::vector<std::string>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+const auto NATIONS = std::vector<std::pair<std::string, int32_t>>{
+    {"ALGERIA", 0},      {"ARGENTINA", 1}, {"BRAZIL", 1}, {"CANADA", 1},       {"EGYPT", 4},
+    {"ETHIOPIA", 0},     {"FRANCE", 3},    {"GERMANY", 3}, {"INDIA", 2},       {"INDONESIA", 2},
+    {"IRAN", 4},         {"IRAQ", 4},      {"JAPAN", 2},  {"JORDAN", 4},       {"KENYA", 0},
+    {"MOROCCO", 0},      {"MOZAMBIQUE", 0}, {"PERU", 1},  {"CHINA", 2},        {"ROMANIA", 3},
+    {"SAUDI ARABIA", 4}, {"VIETNAM", 2},   {"RUSSIA", 3}, {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}};
+const auto MARKET_SEGMENTS = std::vector<std::string>{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto ORDER_PRIORITIES = std::vector<std::string>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto SHIP_INSTRUCTIONS = std::vector<std::string>{"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+const auto SHIP_MODES = std::vector<std::string>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+const auto TYPE_SYLLABLES_1 = std::vector<std::string>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto TYPE_SYLLABLES_2 = std::vector<std::string>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto TYPE_SYLLABLES_3 = std::vector<std::string>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto CONTAINER_SYLLABLES_1 = std::vector<std::string>{"SM", "LG", "MED", "JUMBO", "WRAP"};
+const auto CONTAINER_SYLLABLES_2 = std::vector<std::string>{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+const auto COLORS = std::vector<std::string>{"almond", "antique", "aquamarine", "azure",  "beige",   "bisque",
+                                             "black",  "blanched", "blue",     "blush", "brown",   "burlywood",
+                                             "chiffon", "coral",  "cornflower", "cream", "cyan",    "dark",
+                                             "forest", "frosted", "ghost",    "green", "honeydew", "hot"};
+const auto WORDS = std::vector<std::string>{"furiously", "carefully", "quickly", "slyly",    "blithely", "final",
+                                            "regular",   "special",   "pending", "express", "ironic",   "bold",
+                                            "deposits",  "requests",  "packages", "accounts", "theodolites", "foxes"};
+
+std::string numbered_name(const std::string& prefix, const int32_t number) {
+  auto buffer = std::array<char, 32>{};
+  std::snprintf(buffer.data(), buffer.size(), "%s#%09d", prefix.c_str(), number);
+  return std::string{buffer.data()};
+}
+
+// See TPC-H specification, Section 4.2.3.
+float retail_price(const int32_t part_key) {
+  return static_cast<float>(90'000 + ((part_key / 10) % 20'001) + 100 * (part_key % 1'000)) / 100.0f;
+}
+
+int32_t part_supplier_key(const int32_t part_key, const int32_t supplier_index, const int32_t supplier_count) {
+  return (part_key + supplier_index * (supplier_count / SUPPLIERS_PER_PART + (part_key - 1) / supplier_count)) %
+             supplier_count +
+         1;
+}
+
+}  // namespace
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const ChunkOffset chunk_size)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size) {
+  Assert(scale_factor > 0.0f, "Scale factor has to be positive");
+}
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate() {
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  tables["region"] = _generate_region();
+  tables["nation"] = _generate_nation();
+  tables["supplier"] = _generate_supplier();
+  tables["customer"] = _generate_customer();
+  tables["part"] = _generate_part();
+  tables["partsupp"] = _generate_partsupp();
+  std::tie(tables["orders"], tables["lineitem"]) = _generate_orders_and_lineitem();
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store(const std::optional<EncodingType> encoding_type) {
+  for (const auto& [name, table] : generate()) {
+    if (encoding_type) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id, *encoding_type);
+      }
+    }
+    StorageManager::get().add_table(name, table);
+  }
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_region() {
+  auto table = _create_table({{"r_regionkey", "int"}, {"r_name", "string"}, {"r_comment", "string"}});
+  for (auto region_key = int32_t{0}; region_key < static_cast<int32_t>(REGIONS.size()); ++region_key) {
+    table->append({region_key, REGIONS[region_key], _random_text(8)});
+  }
+  return table;
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_nation() {
+  auto table = _create_table(
+      {{"n_nationkey", "int"}, {"n_name", "string"}, {"n_regionkey", "int"}, {"n_comment", "string"}});
+  for (auto nation_key = int32_t{0}; nation_key < static_cast<int32_t>(NATIONS.size()); ++nation_key) {
+    table->append({nation_key, NATIONS[nation_key].first, NATIONS[nation_key].second, _random_text(8)});
+  }
+  return table;
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_supplier() {
+  auto table = _create_table({{"s_suppkey", "int"},
+                              {"s_name", "string"},
+                              {"s_address", "string"},
+                              {"s_nationkey", "int"},
+                              {"s_phone", "string"},
+                              {"s_acctbal", "float"},
+                              {"s_comment", "string"}});
+  const auto supplier_count = static_cast<int32_t>(std::ceil(SUPPLIERS_PER_SCALE_FACTOR * _scale_factor));
+  for (auto supplier_key = int32_t{1}; supplier_key <= supplier_count; ++supplier_key) {
+    const auto nation_key = _random(0, static_cast<int32_t>(NATIONS.size()) - 1);
+    table->append({supplier_key, numbered_name("Supplier", supplier_key), _random_text(3), nation_key,
+                   _random_phone(nation_key), _random_decimal(-999.99f, 9'999.99f), _random_text(10)});
+  }
+  return table;
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_customer() {
+  auto table = _create_table({{"c_custkey", "int"},
+                              {"c_name", "string"},
+                              {"c_address", "string"},
+                              {"c_nationkey", "int"},
+                              {"c_phone", "string"},
+                              {"c_acctbal", "float"},
+                              {"c_mktsegment", "string"},
+                              {"c_comment", "string"}});
+  const auto customer_count = static_cast<int32_t>(std::ceil(CUSTOMERS_PER_SCALE_FACTOR * _scale_factor));
+  for (auto customer_key = int32_t{1}; customer_key <= customer_count; ++customer_key) {
+    const auto nation_key = _random(0, static_cast<int32_t>(NATIONS.size()) - 1);
+    table->append({customer_key, numbered_name("Customer", customer_key), _random_text(3), nation_key,
+                   _random_phone(nation_key), _random_decimal(-999.99f, 9'999.99f), _random_element(MARKET_SEGMENTS),
+                   _random_text(10)});
+  }
+  return table;
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_part() {
+  auto table = _create_table({{"p_partkey", "int"},
+                              {"p_name", "string"},
+                              {"p_mfgr", "string"},
+                              {"p_brand", "string"},
+                              {"p_type", "string"},
+                              {"p_size", "int"},
+                              {"p_container", "string"},
+                              {"p_retailprice", "float"},
+                              {"p_comment", "string"}});
+  const auto part_count = static_cast<int32_t>(std::ceil(PARTS_PER_SCALE_FACTOR * _scale_factor));
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    auto name = _random_element(COLORS);
+    for (auto word_index = 1; word_index < 5; ++word_index) {
+      name += " " + _random_element(COLORS);
+    }
+    const auto manufacturer = _random(1, 5);
+    const auto brand = manufacturer * 10 + _random(1, 5);
+    const auto type = _random_element(TYPE_SYLLABLES_1) + " " + _random_element(TYPE_SYLLABLES_2) + " " +
+                      _random_element(TYPE_SYLLABLES_3);
+    const auto container = _random_element(CONTAINER_SYLLABLES_1) + " " + _random_element(CONTAINER_SYLLABLES_2);
+    table->append({part_key, name, "Manufacturer#" + std::to_string(manufacturer), "Brand#" + std::to_string(brand),
+                   type, _random(1, 50), container, retail_price(part_key), _random_text(3)});
+  }
+  return table;
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_partsupp() {
+  auto table = _create_table({{"ps_partkey", "int"},
+                              {"ps_suppkey", "int"},
+                              {"ps_availqty", "int"},
+                              {"ps_supplycost", "float"},
+                              {"ps_comment", "string"}});
+  const auto part_count = static_cast<int32_t>(std::ceil(PARTS_PER_SCALE_FACTOR * _scale_factor));
+  const auto supplier_count = static_cast<int32_t>(std::ceil(SUPPLIERS_PER_SCALE_FACTOR * _scale_factor));
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    for (auto supplier_index = int32_t{0}; supplier_index < SUPPLIERS_PER_PART; ++supplier_index) {
+      table->append({part_key, part_supplier_key(part_key, supplier_index, supplier_count), _random(1, 9'999),
+                     _random_decimal(1.0f, 1'000.0f), _random_text(10)});
+    }
+  }
+  return table;
+}
+
+std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> TpchTableGenerator::_generate_orders_and_lineitem() {
+  auto orders = _create_table({{"o_orderkey", "int"},
+                               {"o_custkey", "int"},
+                               {"o_orderstatus", "string"},
+                               {"o_totalprice", "float"},
+                               {"o_orderdate", "string"},
+                               {"o_orderpriority", "string"},
+                               {"o_clerk", "string"},
+                               {"o_shippriority", "int"},
+                               {"o_comment", "string"}});
+  auto lineitem = _create_table({{"l_orderkey", "int"},
+                                 {"l_partkey", "int"},
+                                 {"l_suppkey", "int"},
+                                 {"l_linenumber", "int"},
+                                 {"l_quantity", "float"},
+                                 {"l_extendedprice", "float"},
+                                 {"l_discount", "float"},
+                                 {"l_tax", "float"},
+                                 {"l_returnflag", "string"},
+                                 {"l_linestatus", "string"},
+                                 {"l_shipdate", "string"},
+                                 {"l_commitdate", "string"},
+                                 {"l_receiptdate", "string"},
+                                 {"l_shipinstruct", "string"},
+                                 {"l_shipmode", "string"},
+                                 {"l_comment", "string"}});
+
+  const auto customer_count = static_cast<int32_t>(std::ceil(CUSTOMERS_PER_SCALE_FACTOR * _scale_factor));
+  const auto part_count = static_cast<int32_t>(std::ceil(PARTS_PER_SCALE_FACTOR * _scale_factor));
+  const auto supplier_count = static_cast<int32_t>(std::ceil(SUPPLIERS_PER_SCALE_FACTOR * _scale_factor));
+  const auto order_count = customer_count * ORDERS_PER_CUSTOMER;
+  const auto clerk_count = std::max(1, static_cast<int32_t>(std::ceil(1'000.0f * _scale_factor)));
+
+  for (auto order_key = int32_t{1}; order_key <= order_count; ++order_key) {
+    // Every third customer does not place orders.
+    auto customer_key = _random(1, customer_count);
+    while (customer_count > 2 && customer_key % 3 == 0) {
+      customer_key = _random(1, customer_count);
+    }
+    const auto order_date = _random(START_DATE, END_DATE - 151);
+
+    auto total_price = 0.0f;
+    auto shipped_count = 0;
+    const auto line_count = _random(1, 7);
+    for (auto line_number = int32_t{1}; line_number <= line_count; ++line_number) {
+      const auto part_key = _random(1, part_count);
+      const auto supplier_key = part_supplier_key(part_key, _random(0, SUPPLIERS_PER_PART - 1), supplier_count);
+      const auto quantity = static_cast<float>(_random(1, 50));
+      const auto extended_price = quantity * retail_price(part_key);
+      const auto discount = static_cast<float>(_random(0, 10)) / 100.0f;
+      const auto tax = static_cast<float>(_random(0, 8)) / 100.0f;
+      const auto ship_date = order_date + _random(1, 121);
+      const auto commit_date = order_date + _random(30, 90);
+      const auto receipt_date = ship_date + _random(1, 30);
+      const auto return_flag = receipt_date <= CURRENT_DATE ? (_random(0, 1) ? "R" : "A") : "N";
+      const auto line_status = ship_date > CURRENT_DATE ? "O" : "F";
+      shipped_count += ship_date <= CURRENT_DATE;
+      total_price += extended_price * (1.0f + tax) * (1.0f - discount);
+
+      lineitem->append({order_key, part_key, supplier_key, line_number, quantity, extended_price, discount, tax,
+                        return_flag, line_status, date_to_string(ship_date), date_to_string(commit_date),
+                        date_to_string(receipt_date), _random_element(SHIP_INSTRUCTIONS), _random_element(SHIP_MODES),
+                        _random_text(4)});
+    }
+
+    const auto order_status = shipped_count == line_count ? "F" : shipped_count == 0 ? "O" : "P";
+    orders->append({order_key, customer_key, order_status, total_price, date_to_string(order_date),
+                    _random_element(ORDER_PRIORITIES), numbered_name("Clerk", _random(1, clerk_count)), 0,
+                    _random_text(6)});
+  }
+  return {orders, lineitem};
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_create_table(
+    const std::vector<std::pair<std::string, std::string>>& columns) const {
+  auto table = std::make_shared<Table>(_chunk_size);
+  for (const auto& [name, type] : columns) {
+    table->add_column(name, type);
+  }
+  return table;
+}
+
+int32_t TpchTableGenerator::_random(const int32_t min, const int32_t max) {
+  return std::uniform_int_distribution<int32_t>{min, max}(_generator);
+}
+
+float TpchTableGenerator::_random_decimal(const float min, const float max) {
+  // Decimals have two digits after the point.
+  const auto cents =
+      _random(static_cast<int32_t>(std::lround(min * 100)), static_cast<int32_t>(std::lround(max * 100)));
+  return static_cast<float>(cents) / 100.0f;
+}
+
+std::string TpchTableGenerator::_random_text(const size_t word_count) {
+  auto text = _random_element(WORDS);
+  for (auto word_index = size_t{1}; word_index < word_count; ++word_index) {
+    text += " " + _random_element(WORDS);
+  }
+  return text;
+}
+
+std::string TpchTableGenerator::_random_phone(const int32_t nation_key) {
+  auto buffer = std::array<char, 32>{};
+  std::snprintf(buffer.data(), buffer.size(), "%02d-%03d-%03d-%04d", nation_key + 10, _random(100, 999),
+                _random(100, 999), _random(1000, 9999));
+  return std::string{buffer.data()};
+}
+
+template <typename T>
+const T& TpchTableGenerator::_random_element(const std::vector<T>& elements) {
+  return elements[_random(0, static_cast<int32_t>(elements.size()) - 1)];
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// TpchTableGenerator creates the eight tables of the TPC-H benchmark (region, nation, supplier, customer, part,
+// partsupp, orders, lineitem) for a given scale factor. Cardinalities, key relationships, value ranges, and the
+// derived columns (e.g., l_extendedprice, l_returnflag, o_orderstatus, o_totalprice) follow the TPC-H specification.
+// Free-text columns (names, addresses, comments) are drawn from a small vocabulary instead of the specification's
+// grammar, and order keys are dense.
+//
+// Decimals are stored as float and dates as strings in the format YYYY-MM-DD, which sort like the dates. The random
+// number generator has a fixed seed, so the same scale factor always produces the same data.
+class TpchTableGenerator {
+ public:
+  static constexpr auto DEFAULT_CHUNK_SIZE = ChunkOffset{100'000};
+
+  explicit TpchTableGenerator(const float scale_factor, const ChunkOffset chunk_size = DEFAULT_CHUNK_SIZE);
+
+  // Returns the generated tables by name.
+  std::map<std::string, std::shared_ptr<Table>> generate();
+
+  // Generates the tables and adds them to the StorageManager. If an encoding is given, all chunks are compressed with
+  // it, including the last one, so no more rows can be appended to the tables afterwards.
+  void generate_and_store(const std::optional<EncodingType> encoding_type = std::nullopt);
+
+ protected:
+  std::shared_ptr<Table> _generate_region();
+  std::shared_ptr<Table> _generate_nation();
+  std::shared_ptr<Table> _generate_supplier();
+  std::shared_ptr<Table> _generate_customer();
+  std::shared_ptr<Table> _generate_part();
+  std::shared_ptr<Table> _generate_partsupp();
+  // Orders and lineitems are generated together, as o_orderstatus and o_totalprice depend on the lineitems.
+  std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> _generate_orders_and_lineitem();
+
+  std::shared_ptr<Table> _create_table(const std::vector<std::pair<std::string, std::string>>& columns) const;
+
+  int32_t _random(const int32_t min, const int32_t max);
+  float _random_decimal(const float min, const float max);
+  std::string _random_text(const size_t word_count);
+  std::string _random_phone(const int32_t nation_key);
+  template <typename T>
+  const T& _random_element(const std::vector<T>& elements);
+
+  const float _scale_factor;
+  const ChunkOffset _chunk_size;
+  std::mt19937 _generator{19920101};
+};
+
+}  // namespace opossum
@@ -4,6 +4,6 @@
 
 namespace opossum {
 
-std::string to_string(const AllTypeVariant& x) { return boost::lexical_cast<std::string>(x); }
+std::string to_string(const AllTypeVariant& x) { return type_cast<std::string>(x); }
 
 }  // namespace opossum
@@ -1,15 +1,20 @@
 #pragma once
 
+#include <array>
+#include <charconv>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
 
 #include <boost/hana/contains.hpp>
-#include <boost/hana/integral_constant.hpp>
-#include <boost/hana/not_equal.hpp>
-#include <boost/hana/size.hpp>
-#include <boost/hana/take_while.hpp>
-#include <boost/lexical_cast.hpp>
+#include <boost/lexical_cast/bad_lexical_cast.hpp>
+#include <boost/numeric/conversion/cast.hpp>
 
 #include "all_type_variant.hpp"
+#include "tagged_value.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -17,11 +22,68 @@ namespace hana = boost::hana;
 
 namespace detail {
 
-// Returns the index of type T in an Iterable
-template <typename Sequence, typename T>
-constexpr auto index_of(Sequence const& sequence, T const& element) {
-  constexpr auto size = decltype(hana::size(hana::take_while(sequence, hana::not_equal.to(element)))){};
-  return static_cast<size_t>(decltype(size)::value);
+template <typename T>
+constexpr auto is_string_v = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+// Parses the whole string as T and returns whether this succeeded. Fails for values that do not fit into T.
+template <typename T>
+bool try_parse(const std::string_view string, T& value) {
+  auto begin = string.data();
+  const auto end = begin + string.size();
+  // Unlike std::from_chars, streams accept a leading plus sign, and so did type_cast.
+  if (begin != end && *begin == '+' && begin + 1 != end && *(begin + 1) != '-') ++begin;
+  const auto [pointer, error] = std::from_chars(begin, end, value);
+  return error == std::errc{} && pointer == end;
+}
+
+template <typename T>
+T parse(const std::string_view string) {
+  auto value = T{};
+  if (!try_parse(string, value)) throw boost::bad_lexical_cast{typeid(std::string), typeid(T)};
+  return value;
+}
+
+// Returns the shortest representation that parses to the same value.
+template <typename T>
+std::string number_to_string(const T value) {
+  // The shortest representation of a double has at most 24 characters, e.g., -2.2250738585072014e-308.
+  auto buffer = std::array<char, 32>{};
+  const auto [pointer, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  DebugAssert(error == std::errc{}, "Buffer is too small for number");
+  return std::string{buffer.data(), pointer};
+}
+
+// Converts a value of one of the data types (with strings as std::string or std::string_view) to T. The conversion is
+// chosen at compile time for each pair of types:
+//  - numbers to numbers use boost::numeric_cast, which throws boost::bad_numeric_cast if the value does not fit and
+//    truncates floating-point numbers towards zero,
+//  - strings to numbers use std::from_chars and throw boost::bad_lexical_cast if the string is not a valid number.
+//    Strings that are no integers (e.g., "4.5") are parsed as double and converted to integral types like numbers,
+//  - numbers to strings use std::to_chars.
+// NULL cannot be converted, check for it (see variant_is_null and TaggedValue::is_null) first.
+template <typename T, typename Source>
+T convert(const Source& value) {
+  if constexpr (std::is_same_v<Source, NullValue>) {
+    Fail("NULL cannot be converted to a value");
+  } else if constexpr (std::is_same_v<T, Source>) {
+    return value;
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    if constexpr (is_string_v<Source>) {
+      return std::string{value};
+    } else {
+      return number_to_string(value);
+    }
+  } else if constexpr (is_string_v<Source>) {
+    if constexpr (std::is_integral_v<T>) {
+      auto result = T{};
+      if (try_parse(value, result)) return result;
+      return boost::numeric_cast<T>(parse<double>(value));
+    } else {
+      return parse<T>(value);
+    }
+  } else {
+    return boost::numeric_cast<T>(value);
+  }
 }
 
 }  // namespace detail
@@ -33,26 +95,15 @@ const T& get(const AllTypeVariant& value) {
   return boost::get<T>(value);
 }
 
-// cast methods - from variant to specific type
-
-// Template specialization for everything but integral types
+// cast methods - from variant to specific type, see detail::convert for the conversions
 template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
-
-  return boost::lexical_cast<T>(value);
+T type_cast(const AllTypeVariant& value) {
+  return boost::apply_visitor([](const auto& typed_value) { return detail::convert<T>(typed_value); }, value);
 }
 
-// Template specialization for integral types
 template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
-
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
-  }
+T type_cast(const TaggedValue& value) {
+  return value.visit([](const auto& typed_value) { return detail::convert<T>(typed_value); });
 }
 
 }  // namespace opossum
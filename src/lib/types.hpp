@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -38,6 +39,24 @@ namespace opossum {
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+using WorkerID = uint32_t;
+
+using CommitID = uint32_t;
+using TransactionID = uint32_t;
+
+// Begin and end commit ids of rows that are not (yet) committed or not deleted.
+constexpr auto MAX_COMMIT_ID = std::numeric_limits<CommitID>::max();
+// Rows that are not locked by any transaction have this transaction id. Transactions start with id 1.
+constexpr auto INVALID_TRANSACTION_ID = TransactionID{0};
+
+// Tables that use MVCC store begin and end commit ids for each row, see MvccData.
+enum class UseMvcc : bool { No, Yes };
+
+// Memory layout of the segments of compressed chunks, see Table::set_chunk_layout. Segmented gives every segment its
+// own allocations. Contiguous places the fixed-width arrays of all segments of a chunk, e.g., values, attribute
+// vectors, and NULL bitmaps, in a single allocation, whatever their encoding (see ContiguousChunkStorage).
+enum class ChunkLayout : uint8_t { Segmented, Contiguous };
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -52,9 +71,49 @@ struct RowID {
   }
 };
 
-enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
+// OpIsNull and OpIsNotNull ignore the search value. All other scan types are comparisons, which are never true for NULL
+// values or a NULL search value.
+enum class ScanType {
+  OpEquals,
+  OpNotEquals,
+  OpLessThan,
+  OpLessThanEquals,
+  OpGreaterThan,
+  OpGreaterThanEquals,
+  OpIsNull,
+  OpIsNotNull
+};
+
+// Returns whether the scan type is OpIsNull or OpIsNotNull.
+inline bool is_null_scan_type(const ScanType scan_type) {
+  return scan_type == ScanType::OpIsNull || scan_type == ScanType::OpIsNotNull;
+}
+
+// Prints the comparison operator of a scan type, e.g., "<=" for OpLessThanEquals.
+inline std::ostream& operator<<(std::ostream& stream, const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return stream << "=";
+    case ScanType::OpNotEquals:
+      return stream << "!=";
+    case ScanType::OpLessThan:
+      return stream << "<";
+    case ScanType::OpLessThanEquals:
+      return stream << "<=";
+    case ScanType::OpGreaterThan:
+      return stream << ">";
+    case ScanType::OpGreaterThanEquals:
+      return stream << ">=";
+    case ScanType::OpIsNull:
+      return stream << "IS NULL";
+    case ScanType::OpIsNotNull:
+      return stream << "IS NOT NULL";
+  }
+  return stream;
+}
 
-using PosList = std::vector<RowID>;
+// PosLists are allocator-aware, so operators can allocate them from the memory resource of the query (see QueryArena).
+using PosList = std::pmr::vector<RowID>;
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
@@ -0,0 +1,36 @@
+#include "cpu_time.hpp"
+
+#include <time.h>
+
+#include <chrono>
+#include <memory>
+#include <utility>
+
+namespace opossum {
+
+namespace {
+
+thread_local std::shared_ptr<CpuTimeCounter> current_counter;
+
+}  // namespace
+
+std::chrono::nanoseconds thread_cpu_time() {
+  auto time = timespec{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+  return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+void CpuTimeCounter::add(const std::chrono::nanoseconds cpu_time) { _cpu_time += cpu_time.count(); }
+
+std::chrono::nanoseconds CpuTimeCounter::cpu_time() const { return std::chrono::nanoseconds{_cpu_time.load()}; }
+
+std::shared_ptr<CpuTimeCounter> current_cpu_time_counter() { return current_counter; }
+
+ScopedCpuTimeCounter::ScopedCpuTimeCounter(const std::shared_ptr<CpuTimeCounter>& counter)
+    : _previous_counter(std::move(current_counter)) {
+  current_counter = counter;
+}
+
+ScopedCpuTimeCounter::~ScopedCpuTimeCounter() { current_counter = std::move(_previous_counter); }
+
+}  // namespace opossum
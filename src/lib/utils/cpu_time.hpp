@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Returns the CPU time that the calling thread has used so far.
+std::chrono::nanoseconds thread_cpu_time();
+
+// CpuTimeCounter sums up the CPU time that an operator spends on other threads than the one that executes it.
+// AbstractOperator::execute installs a counter for the calling thread (see ScopedCpuTimeCounter) and measures that
+// thread itself. Like the memory resource, tasks take the counter of the thread that created them with them and install
+// it while they run (see AbstractTask). Tasks that run on a thread where their counter is not installed yet, e.g., the
+// morsel jobs of a TableScan on a worker, add their CPU time to the counter. Tasks that run on a thread where it is
+// installed already, i.e., on the operator's thread or nested in another task of the operator, are part of that
+// thread's measurement.
+class CpuTimeCounter : private Noncopyable {
+ public:
+  void add(const std::chrono::nanoseconds cpu_time);
+
+  // Returns the CPU time that was added so far.
+  std::chrono::nanoseconds cpu_time() const;
+
+ protected:
+  std::atomic<std::chrono::nanoseconds::rep> _cpu_time{0};
+};
+
+// Returns the counter that tasks created in the calling thread add their CPU time to, or nullptr if there is none.
+std::shared_ptr<CpuTimeCounter> current_cpu_time_counter();
+
+// Installs a counter for the calling thread for the lifetime of the object and restores the previous one afterwards.
+class ScopedCpuTimeCounter : private Noncopyable {
+ public:
+  explicit ScopedCpuTimeCounter(const std::shared_ptr<CpuTimeCounter>& counter);
+  ~ScopedCpuTimeCounter();
+
+ protected:
+  std::shared_ptr<CpuTimeCounter> _previous_counter;
+};
+
+}  // namespace opossum
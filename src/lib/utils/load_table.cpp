@@ -3,12 +3,20 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "storage/table.hpp"
 
 namespace opossum {
 
+namespace {
+
+constexpr auto NULLABLE_SUFFIX = std::string_view{"_null"};
+constexpr auto NULL_TOKEN = std::string_view{"null"};
+
+}  // namespace
+
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
   std::ifstream infile(file_name);
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
@@ -21,11 +29,26 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
 
   std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
   for (auto column_id = ColumnID{0}; column_id < column_names.size(); column_id++) {
-    test_table->add_column(column_names[column_id], column_types[column_id]);
+    // Types with the suffix "_null", e.g., "int_null", denote nullable columns.
+    auto column_type = column_types[column_id];
+    const auto nullable = column_type.ends_with(NULLABLE_SUFFIX);
+    if (nullable) column_type.resize(column_type.size() - NULLABLE_SUFFIX.size());
+    test_table->add_column(column_names[column_id], column_type, nullable);
   }
 
+  auto values = std::vector<TaggedValue>{};
   while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
+    // The values reference the tokens, which are parsed by the segments.
+    const auto tokens = _split<std::string>(line, '|');
+    values.clear();
+    for (auto column_id = ColumnID{0}; column_id < tokens.size(); ++column_id) {
+      const auto& token = tokens[column_id];
+      if (test_table->column_is_nullable(column_id) && token == NULL_TOKEN) {
+        values.emplace_back(NullValue{});
+      } else {
+        values.emplace_back(token);
+      }
+    }
     test_table->append(values);
   }
   return test_table;
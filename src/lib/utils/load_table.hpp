@@ -22,7 +22,9 @@ std::vector<T> _split(const std::string& str, char delimiter) {
   return internal;
 }
 
-// This is a helper method which is heavily used in our test suite
+// This is a helper method which is heavily used in our test suite. The first line of the file holds the column names,
+// the second one the column types. Columns whose type has the suffix "_null" are nullable. In these, the value "null"
+// stands for NULL.
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
 
 }  // namespace opossum
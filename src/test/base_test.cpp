@@ -6,6 +6,10 @@
 #include <utility>
 #include <vector>
 
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
@@ -30,6 +34,21 @@ void BaseTest::ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_p
   ASSERT_TABLE_EQ(*tleft, *tright, order_sensitive, strict_types);
 }
 
+std::shared_ptr<const AbstractOperator> BaseTest::execute_validate(const std::shared_ptr<const AbstractOperator>& input,
+                                                                   const std::shared_ptr<TransactionContext>& context) {
+  const auto validate = std::make_shared<Validate>(input);
+  validate->set_transaction_context(context);
+  validate->execute();
+  return validate;
+}
+
+std::shared_ptr<const AbstractOperator> BaseTest::get_validated_table(
+    const std::string& table_name, const std::shared_ptr<TransactionContext>& context) {
+  const auto get_table = std::make_shared<GetTable>(table_name);
+  get_table->execute();
+  return execute_validate(get_table, context);
+}
+
 BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
   // initialize matrix with table sizes
   Matrix matrix(table.row_count(), std::vector<AllTypeVariant>(table.column_count()));
@@ -158,6 +177,10 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::get().reset(); }
+BaseTest::~BaseTest() {
+  StorageManager::get().reset();
+  TransactionManager::get().reset();
+  CurrentScheduler::set(nullptr);
+}
 
 }  // namespace opossum
@@ -14,7 +14,9 @@
 namespace opossum {
 
 class AbstractASTNode;
+class AbstractOperator;
 class Table;
+class TransactionContext;
 
 using Matrix = std::vector<std::vector<AllTypeVariant>>;
 
@@ -46,6 +48,15 @@ class BaseTest : public ::testing::Test {
   static void ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_ptr<const Table> tright,
                               bool order_sensitive = false, bool strict_types = true);
 
+  // Executes a Validate on the input for the transaction and returns it.
+  static std::shared_ptr<const AbstractOperator> execute_validate(const std::shared_ptr<const AbstractOperator>& input,
+                                                                  const std::shared_ptr<TransactionContext>& context);
+
+  // Executes a GetTable for the stored table and a Validate on it for the transaction, i.e., the start of plans on
+  // tables that use MVCC, and returns the Validate.
+  static std::shared_ptr<const AbstractOperator> get_validated_table(
+      const std::string& table_name, const std::shared_ptr<TransactionContext>& context);
+
  public:
   virtual ~BaseTest();
 };
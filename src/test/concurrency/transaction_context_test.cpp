@@ -0,0 +1,77 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TransactionContextTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->append({1});
+  }
+
+  const MvccData& mvcc_data(const RowID row_id) const { return *_table->get_chunk(row_id.chunk_id)->mvcc_data(); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TransactionContextTest, AssignsIds) {
+  auto& manager = TransactionManager::get();
+  EXPECT_EQ(manager.last_commit_id(), CommitID{0});
+
+  const auto context_1 = manager.new_transaction_context();
+  const auto context_2 = manager.new_transaction_context();
+  EXPECT_EQ(context_1->transaction_id(), TransactionID{1});
+  EXPECT_EQ(context_2->transaction_id(), TransactionID{2});
+  EXPECT_EQ(context_1->snapshot_commit_id(), CommitID{0});
+  EXPECT_EQ(context_1->phase(), TransactionPhase::Active);
+
+  context_2->commit();
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(manager.last_commit_id(), CommitID{1});
+  EXPECT_EQ(manager.new_transaction_context()->snapshot_commit_id(), CommitID{1});
+
+  context_1->rollback();
+  EXPECT_EQ(context_1->phase(), TransactionPhase::RolledBack);
+  EXPECT_EQ(manager.last_commit_id(), CommitID{1});
+
+  EXPECT_THROW(context_1->commit(), std::logic_error);
+  EXPECT_THROW(context_2->rollback(), std::logic_error);
+}
+
+TEST_F(TransactionContextTest, CommitPublishesInserts) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto row_id = _table->append({2}, context->transaction_id());
+  context->register_insert(_table, row_id);
+
+  EXPECT_EQ(mvcc_data(row_id).tid(row_id.chunk_offset), context->transaction_id());
+  EXPECT_EQ(mvcc_data(row_id).begin_cid(row_id.chunk_offset), MAX_COMMIT_ID);
+
+  context->commit();
+  EXPECT_EQ(mvcc_data(row_id).tid(row_id.chunk_offset), INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data(row_id).begin_cid(row_id.chunk_offset), CommitID{1});
+  EXPECT_EQ(mvcc_data(row_id).end_cid(row_id.chunk_offset), MAX_COMMIT_ID);
+}
+
+TEST_F(TransactionContextTest, RollbackHidesInserts) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto row_id = _table->append({2}, context->transaction_id());
+  context->register_insert(_table, row_id);
+
+  context->rollback();
+  EXPECT_EQ(mvcc_data(row_id).tid(row_id.chunk_offset), INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data(row_id).begin_cid(row_id.chunk_offset), MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data(row_id).end_cid(row_id.chunk_offset), CommitID{0});
+  EXPECT_THROW(context->register_insert(_table, row_id), std::logic_error);
+}
+
+}  // namespace opossum
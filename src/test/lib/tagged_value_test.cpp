@@ -0,0 +1,69 @@
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "tagged_value.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+template <typename T>
+class TaggedValueTest : public BaseTest {};
+
+using TaggedValueTestDataTypes = ::testing::Types<int32_t, int64_t, float, double, std::string>;
+TYPED_TEST_SUITE(TaggedValueTest, TaggedValueTestDataTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(TaggedValueTest, RoundTripsValues) {
+  auto values = std::vector<TypeParam>{};
+  if constexpr (std::is_same_v<TypeParam, std::string>) {
+    values.emplace_back(std::string{});
+    values.emplace_back(std::string{"shortstring"});
+    values.emplace_back(std::string{"reallyreallylongstringthatcantbestoredusingsso"});
+  } else {
+    values.emplace_back(std::numeric_limits<TypeParam>::lowest());
+    values.emplace_back(std::numeric_limits<TypeParam>::max());
+    values.emplace_back(TypeParam{17});
+  }
+
+  for (const auto& value : values) {
+    const auto variant = AllTypeVariant{value};
+    const auto tagged_value = TaggedValue{variant};
+    EXPECT_TRUE(tagged_value.template is<TypeParam>());
+    EXPECT_EQ(tagged_value.type_index(), static_cast<size_t>(variant.which()));
+    EXPECT_EQ(type_cast<TypeParam>(tagged_value), value);
+    EXPECT_EQ(tagged_value.to_all_type_variant(), variant);
+  }
+}
+
+class TaggedValueConversionTest : public BaseTest {};
+
+TEST_F(TaggedValueConversionTest, StringsReferenceCharacters) {
+  const auto string = std::string{"opossum"};
+  const auto tagged_value = TaggedValue{string};
+  EXPECT_EQ(tagged_value.get<std::string>().data(), string.data());
+  EXPECT_EQ(tagged_value.get<std::string>(), "opossum");
+}
+
+TEST_F(TaggedValueConversionTest, ConvertsLikeAllTypeVariant) {
+  for (const auto& variant : {AllTypeVariant{int32_t{42}}, AllTypeVariant{int64_t{-7}}, AllTypeVariant{3.75f},
+                              AllTypeVariant{2.5}, AllTypeVariant{std::string{"123"}}, AllTypeVariant{"4.5"}}) {
+    const auto tagged_value = TaggedValue{variant};
+    EXPECT_EQ(type_cast<int32_t>(tagged_value), type_cast<int32_t>(variant));
+    EXPECT_EQ(type_cast<int64_t>(tagged_value), type_cast<int64_t>(variant));
+    EXPECT_EQ(type_cast<float>(tagged_value), type_cast<float>(variant));
+    EXPECT_EQ(type_cast<double>(tagged_value), type_cast<double>(variant));
+    EXPECT_EQ(type_cast<std::string>(tagged_value), type_cast<std::string>(variant));
+
+    auto tagged_stream = std::stringstream{};
+    tagged_stream << tagged_value;
+    auto variant_stream = std::stringstream{};
+    variant_stream << variant;
+    EXPECT_EQ(tagged_stream.str(), variant_stream.str());
+  }
+  EXPECT_THROW(type_cast<int32_t>(TaggedValue{"no number"}), boost::bad_lexical_cast);
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#include <limits>
+#include <string>
+
+#include <boost/lexical_cast/bad_lexical_cast.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include "base_test.hpp"
+
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class TypeCastTest : public BaseTest {};
+
+TEST_F(TypeCastTest, NumbersToNumbers) {
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{int32_t{-17}}), int64_t{-17});
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int64_t{1} << 30}), int32_t{1} << 30);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{3.75f}), 3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{-3.75}), -3);
+  EXPECT_FLOAT_EQ(type_cast<float>(AllTypeVariant{2.5}), 2.5f);
+  EXPECT_DOUBLE_EQ(type_cast<double>(AllTypeVariant{int64_t{1} << 40}), 1099511627776.0);
+}
+
+TEST_F(TypeCastTest, NumberOverflowThrows) {
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{int64_t{1} << 40}), boost::bad_numeric_cast);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{1e12}), boost::bad_numeric_cast);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{std::numeric_limits<double>::max()}), boost::bad_numeric_cast);
+}
+
+TEST_F(TypeCastTest, StringsToNumbers) {
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"-123"}), -123);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"+123"}), 123);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{"9000000000"}), int64_t{9'000'000'000});
+  EXPECT_FLOAT_EQ(type_cast<float>(AllTypeVariant{"0.25"}), 0.25f);
+  EXPECT_DOUBLE_EQ(type_cast<double>(AllTypeVariant{"1e-3"}), 0.001);
+
+  // Strings that are no integers are parsed as double and truncated.
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"4.5"}), 4);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{"-2e3"}), -2000);
+}
+
+TEST_F(TypeCastTest, InvalidStringsThrow) {
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{""}), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"12abc"}), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{" 12"}), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"+-12"}), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<double>(AllTypeVariant{"1.5.5"}), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{"1e100"}), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"9000000000"}), boost::bad_numeric_cast);
+}
+
+TEST_F(TypeCastTest, NumbersToStrings) {
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{int32_t{-42}}), "-42");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{std::numeric_limits<int64_t>::min()}), "-9223372036854775808");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.1f}), "0.1");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.1}), "0.1");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{-2.2250738585072014e-308}), "-2.2250738585072014e-308");
+
+  // The representation is the shortest one that parses to the same value.
+  const auto value = 1.0 / 3.0;
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{type_cast<std::string>(AllTypeVariant{value})}), value);
+}
+
+}  // namespace opossum
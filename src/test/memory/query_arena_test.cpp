@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/query_arena.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Remembers the memory blocks it handed out, so that tests can check where an object was allocated.
+class RecordingResource : public std::pmr::memory_resource {
+ public:
+  bool owns(const void* pointer) const {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    const auto* const byte = static_cast<const std::byte*>(pointer);
+    return std::any_of(_blocks.cbegin(), _blocks.cend(), [&](const auto& block) {
+      return byte >= block.first && byte < block.first + block.second;
+    });
+  }
+
+ protected:
+  void* do_allocate(const size_t bytes, const size_t alignment) override {
+    auto* const pointer = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _blocks.emplace_back(static_cast<const std::byte*>(pointer), bytes);
+    return pointer;
+  }
+
+  void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) override {
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      const auto block = std::pair{static_cast<const std::byte*>(pointer), bytes};
+      _blocks.erase(std::find(_blocks.cbegin(), _blocks.cend(), block));
+    }
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  mutable std::mutex _mutex;
+  std::vector<std::pair<const std::byte*, size_t>> _blocks;
+};
+
+}  // namespace
+
+class QueryArenaTest : public BaseTest {};
+
+TEST_F(QueryArenaTest, ScopesAreNested) {
+  EXPECT_EQ(current_memory_resource().get(), std::pmr::get_default_resource());
+
+  const auto arena = std::make_shared<QueryArena>();
+  {
+    const auto outer_scope = ScopedMemoryResource{arena};
+    EXPECT_EQ(current_memory_resource(), arena);
+
+    const auto inner_arena = std::make_shared<QueryArena>();
+    {
+      const auto inner_scope = ScopedMemoryResource{inner_arena};
+      EXPECT_EQ(current_memory_resource(), inner_arena);
+    }
+    EXPECT_EQ(current_memory_resource(), arena);
+  }
+  EXPECT_EQ(current_memory_resource().get(), std::pmr::get_default_resource());
+}
+
+TEST_F(QueryArenaTest, IntermediatesAllocateFromCurrentResource) {
+  const auto arena = std::make_shared<QueryArena>();
+  const auto scope = ScopedMemoryResource{arena};
+
+  const auto pos_list = make_shared_intermediate<PosList>();
+  EXPECT_EQ(pos_list->get_allocator().resource(), arena.get());
+  const auto allocated_bytes = arena->allocated_bytes();
+  EXPECT_GE(allocated_bytes, sizeof(PosList));
+
+  pos_list->resize(1'000);
+  EXPECT_GE(arena->allocated_bytes(), allocated_bytes + 1'000 * sizeof(RowID));
+}
+
+TEST_F(QueryArenaTest, TablesCreateChunksInTheirResource) {
+  const auto stored_table = std::make_shared<Table>(2, UseMvcc::Yes);
+  stored_table->add_column("a", "int");
+
+  const auto resource = std::make_shared<RecordingResource>();
+  {
+    const auto scope = ScopedMemoryResource{resource};
+    const auto intermediate_table = make_shared_intermediate<Table>();
+    intermediate_table->add_column("a", "int");
+    EXPECT_TRUE(resource->owns(intermediate_table->get_chunk(ChunkID{0}).get()));
+    EXPECT_TRUE(resource->owns(intermediate_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}).get()));
+
+    // Rows inserted into a stored table by a query must not end up in memory of the query.
+    for (const auto value : {1, 2, 3}) {
+      stored_table->append({value});
+    }
+    ASSERT_EQ(stored_table->chunk_count(), 2u);
+    EXPECT_FALSE(resource->owns(stored_table->get_chunk(ChunkID{1}).get()));
+  }
+}
+
+TEST_F(QueryArenaTest, PipelineAllocatesFromCurrentResource) {
+  // The resource has to outlive the output of the scan.
+  const auto resource = std::make_shared<RecordingResource>();
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  {
+    const auto scope = ScopedMemoryResource{resource};
+    auto pipeline = Pipeline{table_scan};
+    pipeline.execute();
+  }
+  const auto output = table_scan->get_output();
+  ASSERT_GT(output->chunk_count(), 1u);
+  EXPECT_TRUE(resource->owns(output.get()));
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(resource->owns(output->get_chunk(chunk_id).get()));
+  }
+}
+
+TEST_F(QueryArenaTest, TasksInheritResource) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+
+  const auto arena = std::make_shared<QueryArena>();
+  auto job_resources = std::vector<std::pmr::memory_resource*>(8);
+  auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+  {
+    const auto scope = ScopedMemoryResource{arena};
+    for (auto& job_resource : job_resources) {
+      jobs.push_back(std::make_shared<JobTask>([&job_resource] { job_resource = current_memory_resource().get(); }));
+    }
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto job_resource : job_resources) {
+    EXPECT_EQ(job_resource, arena.get());
+  }
+  EXPECT_EQ(current_memory_resource().get(), std::pmr::get_default_resource());
+}
+
+TEST_F(QueryArenaTest, ThreadsAllocateFromSeparateBuffers) {
+  constexpr auto THREAD_COUNT = size_t{4};
+  constexpr auto ALLOCATION_COUNT = size_t{1'000};
+  constexpr auto ALLOCATION_SIZE = size_t{48};
+
+  const auto arena = std::make_shared<QueryArena>(1'024);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = size_t{0}; thread_index < THREAD_COUNT; ++thread_index) {
+    threads.emplace_back([&, thread_index] {
+      auto blocks = std::vector<unsigned char*>{};
+      for (auto allocation_index = size_t{0}; allocation_index < ALLOCATION_COUNT; ++allocation_index) {
+        auto* block = static_cast<unsigned char*>(arena->allocate(ALLOCATION_SIZE));
+        std::memset(block, static_cast<int>(thread_index), ALLOCATION_SIZE);
+        blocks.push_back(block);
+      }
+      // Blocks handed out to other threads must not overlap with the ones of this thread.
+      for (const auto* block : blocks) {
+        EXPECT_TRUE(std::all_of(block, block + ALLOCATION_SIZE, [&](const auto byte) { return byte == thread_index; }));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(arena->allocated_bytes(), THREAD_COUNT * ALLOCATION_COUNT * ALLOCATION_SIZE);
+}
+
+TEST_F(QueryArenaTest, TasksKeepResourceAlive) {
+  auto arena = std::make_shared<QueryArena>();
+  const auto weak_arena = std::weak_ptr<QueryArena>{arena};
+  auto job = std::shared_ptr<JobTask>{};
+  {
+    const auto scope = ScopedMemoryResource{arena};
+    job = std::make_shared<JobTask>([] {});
+  }
+
+  arena = nullptr;
+  EXPECT_FALSE(weak_arena.expired());
+  job = nullptr;
+  EXPECT_TRUE(weak_arena.expired());
+}
+
+TEST_F(QueryArenaTest, TableScanAllocatesFromArena) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  const auto arena = std::make_shared<QueryArena>();
+  {
+    const auto scope = ScopedMemoryResource{arena};
+    const auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+    const auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(scan_2));
+
+    EXPECT_TABLE_EQ(scan_2->get_output(), load_table("src/test/tables/int_float_filtered.tbl", 2));
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+        scan_2->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->pos_list()->get_allocator().resource(), arena.get());
+  }
+  EXPECT_GT(arena->allocated_bytes(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/query_memory_tracker.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class QueryMemoryTrackerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int");
+    for (auto value = int32_t{0}; value < 10; ++value) {
+      table->append({value});
+    }
+    StorageManager::get().add_table("table_a", table);
+  }
+};
+
+TEST_F(QueryMemoryTrackerTest, ReserveAndRelease) {
+  auto tracker = QueryMemoryTracker{100};
+  EXPECT_EQ(tracker.limit(), 100u);
+
+  tracker.reserve(60);
+  EXPECT_FALSE(tracker.try_reserve(41));
+  EXPECT_THROW(tracker.reserve(41), std::logic_error);
+  EXPECT_EQ(tracker.used(), 60u);
+
+  tracker.release(30);
+  EXPECT_TRUE(tracker.try_reserve(70));
+  EXPECT_EQ(tracker.used(), 100u);
+  EXPECT_EQ(tracker.peak(), 100u);
+
+  tracker.release(100);
+  EXPECT_EQ(tracker.used(), 0u);
+  EXPECT_EQ(tracker.peak(), 100u);
+}
+
+TEST_F(QueryMemoryTrackerTest, ConcurrentReservationsRespectLimit) {
+  auto tracker = QueryMemoryTracker{1000};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 4; ++thread_index) {
+    threads.emplace_back([&] {
+      for (auto index = 0; index < 1000; ++index) {
+        tracker.try_reserve(1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(tracker.used(), 1000u);
+  EXPECT_EQ(tracker.peak(), 1000u);
+}
+
+TEST_F(QueryMemoryTrackerTest, OperatorsReportOutputs) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+  const auto tracker = std::make_shared<QueryMemoryTracker>();
+  const auto scope = ScopedQueryMemoryTracker{tracker};
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, 6);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(scan));
+
+  // The stored table does not belong to the query.
+  EXPECT_EQ(tracker->used(), 6 * sizeof(RowID));
+  EXPECT_EQ(tracker->used(), scan->performance_data().estimated_output_bytes);
+}
+
+TEST_F(QueryMemoryTrackerTest, LimitAbortsQuery) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+  const auto tracker = std::make_shared<QueryMemoryTracker>(6 * sizeof(RowID));
+  const auto scope = ScopedQueryMemoryTracker{tracker};
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto scan_1 = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, 6);
+  const auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan_2);
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(tasks), std::logic_error);
+
+  EXPECT_TRUE(scan_1->performance_data().executed);
+  EXPECT_FALSE(scan_2->performance_data().executed);
+  EXPECT_EQ(tracker->used(), 6 * sizeof(RowID));
+}
+
+TEST_F(QueryMemoryTrackerTest, LimitStopsOutputAllocation) {
+  const auto tracker = std::make_shared<QueryMemoryTracker>(5 * sizeof(RowID));
+  const auto scope = ScopedQueryMemoryTracker{tracker};
+
+  // The four matches of the first chunk fit, the two of the second chunk are not allocated anymore.
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, 6);
+  EXPECT_THROW(scan->execute(), std::logic_error);
+  EXPECT_EQ(tracker->used(), 4 * sizeof(RowID));
+}
+
+TEST_F(QueryMemoryTrackerTest, PipelineReleasesIntermediateResults) {
+  const auto tracker = std::make_shared<QueryMemoryTracker>();
+  const auto scope = ScopedQueryMemoryTracker{tracker};
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto scan_1 = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, 6);
+  const auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  Pipeline{scan_2}.execute();
+
+  EXPECT_EQ(tracker->used(), 5 * sizeof(RowID));
+  EXPECT_EQ(tracker->used(), scan_2->performance_data().estimated_output_bytes);
+}
+
+TEST_F(QueryMemoryTrackerTest, TasksInheritTracker) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+  const auto tracker = std::make_shared<QueryMemoryTracker>();
+
+  auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+  {
+    const auto scope = ScopedQueryMemoryTracker{tracker};
+    for (auto index = 0; index < 8; ++index) {
+      jobs.push_back(std::make_shared<JobTask>([] { current_query_memory_tracker()->reserve(10); }));
+    }
+  }
+  EXPECT_FALSE(current_query_memory_tracker());
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  EXPECT_EQ(tracker->used(), 80u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#include <string>
+#include <string_view>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/spill_file.hpp"
+
+namespace opossum {
+
+class SpillFileTest : public BaseTest {};
+
+TEST_F(SpillFileTest, ReadsRecordsInOrder) {
+  auto file = SpillFile{};
+  file.write("first");
+  file.write("");
+  file.write(std::string_view{"with\0zero", 9});
+  EXPECT_EQ(file.record_count(), 3u);
+  EXPECT_EQ(file.byte_count(), 3 * sizeof(uint32_t) + 14);
+
+  auto record = std::string{};
+  ASSERT_TRUE(file.read(record));
+  EXPECT_EQ(record, "first");
+  ASSERT_TRUE(file.read(record));
+  EXPECT_EQ(record, "");
+  ASSERT_TRUE(file.read(record));
+  EXPECT_EQ(record, std::string(std::string_view{"with\0zero", 9}));
+  EXPECT_FALSE(file.read(record));
+
+  EXPECT_THROW(file.write("late"), std::logic_error);
+}
+
+TEST_F(SpillFileTest, EncodedValuesRoundTrip) {
+  auto buffer = std::string{};
+  append_encoded_value(buffer, int32_t{-7});
+  append_encoded_value(buffer, int64_t{1} << 40);
+  append_encoded_value(buffer, 1.5f);
+  append_encoded_value(buffer, 2.25);
+  append_encoded_value(buffer, "hello");
+  append_encoded_value(buffer, NullValue{});
+  append_encoded_value(buffer, "");
+
+  auto view = std::string_view{buffer};
+  EXPECT_EQ(decode_value(view).get<int32_t>(), -7);
+  EXPECT_EQ(decode_value(view).get<int64_t>(), int64_t{1} << 40);
+  EXPECT_EQ(decode_value(view).get<float>(), 1.5f);
+  EXPECT_EQ(decode_value(view).get<double>(), 2.25);
+  EXPECT_EQ(decode_value(view).get<std::string>(), "hello");
+  EXPECT_TRUE(decode_value(view).is_null());
+  EXPECT_EQ(decode_value(view).get<std::string>(), "");
+  EXPECT_TRUE(view.empty());
+}
+
+TEST_F(SpillFileTest, EqualValuesHaveEqualEncodings) {
+  auto left = std::string{};
+  auto right = std::string{};
+  append_encoded_value(left, std::string{"abc"});
+  append_encoded_value(right, "abc");
+  EXPECT_EQ(left, right);
+
+  // Values of different types differ in their type index.
+  left.clear();
+  right.clear();
+  append_encoded_value(left, int32_t{1});
+  append_encoded_value(right, int64_t{1});
+  EXPECT_NE(left, right);
+}
+
+}  // namespace opossum
@@ -0,0 +1,162 @@
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/query_memory_tracker.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/cpu_time.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Outputs its input table as it is, like operators that have nothing to do for some inputs.
+class ForwardInput : public AbstractOperator {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  const std::string& name() const override {
+    static const auto name = std::string{"ForwardInput"};
+    return name;
+  }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override { return _left_input_table(); }
+};
+
+// Hands its work to a job, like operators that split their work into morsels.
+class BusyJob : public ForwardInput {
+ public:
+  using ForwardInput::ForwardInput;
+
+  std::chrono::nanoseconds job_cpu_time{0};
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override {
+    const auto job = std::make_shared<JobTask>([&] {
+      const auto cpu_time_begin = thread_cpu_time();
+      while (thread_cpu_time() - cpu_time_begin < std::chrono::milliseconds{20}) {}
+      job_cpu_time = thread_cpu_time() - cpu_time_begin;
+    });
+    CurrentScheduler::schedule_and_wait_for_tasks(std::vector{job});
+    return _left_input_table();
+  }
+};
+
+}  // namespace
+
+class OperatorsAbstractOperatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto index = int32_t{0}; index < 10; ++index) {
+      _table->append({index, std::to_string(index)});
+    }
+    _table->compress_chunk(ChunkID{0});
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsAbstractOperatorTest, NotExecuted) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  EXPECT_FALSE(get_table->performance_data().executed);
+
+  auto stream = std::stringstream{};
+  get_table->print_plan(stream);
+  EXPECT_EQ(stream.str(), "GetTable (table_a) [not executed]\n");
+}
+
+TEST_F(OperatorsAbstractOperatorTest, RecordsPerformanceData) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  const auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, 6);
+  scan->execute();
+
+  const auto& get_table_data = get_table->performance_data();
+  EXPECT_TRUE(get_table_data.executed);
+  EXPECT_EQ(get_table_data.input_row_count, 0u);
+  EXPECT_EQ(get_table_data.output_row_count, 10u);
+  EXPECT_EQ(get_table_data.output_chunk_count, 3u);
+
+  const auto& scan_data = scan->performance_data();
+  EXPECT_TRUE(scan_data.executed);
+  EXPECT_GE(scan_data.walltime.count(), 0);
+  EXPECT_EQ(scan_data.input_row_count, 10u);
+  EXPECT_EQ(scan_data.input_chunk_count, 3u);
+  EXPECT_EQ(scan_data.output_row_count, 6u);
+  EXPECT_EQ(scan_data.output_chunk_count, 2u);
+  // The two ReferenceSegments of each output chunk share their position list, which holds one RowID per row.
+  EXPECT_EQ(scan_data.estimated_output_bytes, 6 * sizeof(RowID));
+}
+
+TEST_F(OperatorsAbstractOperatorTest, ForwardedInputAllocatesNothing) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  EXPECT_GT(table_wrapper->performance_data().estimated_output_bytes, 0u);
+
+  const auto tracker = std::make_shared<QueryMemoryTracker>();
+  const auto scope = ScopedQueryMemoryTracker{tracker};
+  const auto forward_input = std::make_shared<ForwardInput>(table_wrapper);
+  forward_input->execute();
+
+  EXPECT_EQ(forward_input->get_output(), table_wrapper->get_output());
+  EXPECT_EQ(forward_input->performance_data().output_row_count, _table->row_count());
+  EXPECT_EQ(forward_input->performance_data().estimated_output_bytes, 0u);
+  EXPECT_EQ(tracker->used(), 0u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, CpuTimeIncludesJobsOnWorkers) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(1));
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  const auto busy_job = std::make_shared<BusyJob>(table_wrapper);
+  busy_job->execute();
+
+  // The executing thread only waits for the worker.
+  EXPECT_GE(busy_job->job_cpu_time, std::chrono::milliseconds{20});
+  EXPECT_GE(busy_job->performance_data().cpu_time, busy_job->job_cpu_time);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, PrintPlan) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  const auto scan_1 = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  scan_1->execute();
+
+  const auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpNotEquals, "5");
+  scan_2->execute();
+
+  auto stream = std::stringstream{};
+  scan_2->print_plan(stream);
+  const auto plan = stream.str();
+
+  const auto scan_2_position = plan.find("TableScan (column #1 != 5) [walltime: ");
+  const auto scan_1_position = plan.find("\n  TableScan (column #0 >= 2) [walltime: ");
+  const auto get_table_position = plan.find("\n    GetTable (table_a) [walltime: ");
+  EXPECT_EQ(scan_2_position, 0u);
+  EXPECT_NE(scan_1_position, std::string::npos);
+  EXPECT_NE(get_table_position, std::string::npos);
+  EXPECT_LT(scan_1_position, get_table_position);
+  EXPECT_NE(plan.find("output: 7 rows in 3 chunks"), std::string::npos);
+}
+
+}  // namespace opossum
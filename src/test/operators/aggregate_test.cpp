@@ -0,0 +1,185 @@
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/query_memory_tracker.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string");
+    table->add_column("c", "float", true);
+    table->append({1, "x", 1.5f});
+    table->append({2, "y", 2.0f});
+    table->append({1, "z", NullValue{}});
+    table->append({NullValue{}, "y", 4.0f});
+    table->append({1, "w", 3.0f});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, GroupsAndAggregates) {
+  const auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<ColumnID>{ColumnID{0}},
+      std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Count},
+                                             {ColumnID{2}, AggregateFunction::Sum},
+                                             {ColumnID{2}, AggregateFunction::Avg},
+                                             {ColumnID{1}, AggregateFunction::Min},
+                                             {ColumnID{1}, AggregateFunction::Max}});
+  aggregate->execute();
+
+  const auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int", true);
+  expected->add_column("COUNT(c)", "long");
+  expected->add_column("SUM(c)", "double", true);
+  expected->add_column("AVG(c)", "double", true);
+  expected->add_column("MIN(b)", "string", true);
+  expected->add_column("MAX(b)", "string", true);
+  expected->append({1, int64_t{2}, 4.5, 2.25, "w", "z"});
+  expected->append({2, int64_t{1}, 2.0, 2.0, "y", "y"});
+  expected->append({NullValue{}, int64_t{1}, 4.0, 4.0, "y", "y"});
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+  EXPECT_EQ(aggregate->spilled_row_count(), 0u);
+  EXPECT_EQ(aggregate->description(), "Aggregate (group by #0; COUNT(#2) SUM(#2) AVG(#2) MIN(#1) MAX(#1))");
+}
+
+TEST_F(OperatorsAggregateTest, AggregatesOfNullValuesAreNull) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  table->add_column("b", "long", true);
+  table->append({1, NullValue{}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<ColumnID>{ColumnID{0}},
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Count},
+                                             {ColumnID{1}, AggregateFunction::Sum},
+                                             {ColumnID{1}, AggregateFunction::Max}});
+  aggregate->execute();
+
+  const auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("COUNT(b)", "long");
+  expected->add_column("SUM(b)", "long", true);
+  expected->add_column("MAX(b)", "long", true);
+  expected->append({1, int64_t{0}, NullValue{}, NullValue{}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, WithoutGroupByColumns) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum},
+                                                                 {ColumnID{0}, AggregateFunction::Count}};
+  const auto aggregate = std::make_shared<Aggregate>(_table_wrapper, std::vector<ColumnID>{}, aggregates);
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("SUM(a)", "long", true);
+  expected->add_column("COUNT(a)", "long");
+  expected->append({int64_t{5}, int64_t{4}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+
+  // Even without any input row, there is one output row.
+  auto empty_table = std::make_shared<Table>();
+  empty_table->add_column("a", "int");
+  const auto empty_table_wrapper = std::make_shared<TableWrapper>(empty_table);
+  empty_table_wrapper->execute();
+  const auto empty_aggregate = std::make_shared<Aggregate>(empty_table_wrapper, std::vector<ColumnID>{}, aggregates);
+  empty_aggregate->execute();
+
+  expected = std::make_shared<Table>();
+  expected->add_column("SUM(a)", "long", true);
+  expected->add_column("COUNT(a)", "long");
+  expected->append({NullValue{}, int64_t{0}});
+  EXPECT_TABLE_EQ(empty_aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, EqualFloatingPointValuesFormOneGroup) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "double");
+  table->add_column("b", "int");
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  table->append({0.0, 1});
+  table->append({-0.0, 2});
+  table->append({nan, 3});
+  table->append({-nan, 4});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<ColumnID>{ColumnID{0}},
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Count}});
+  aggregate->execute();
+
+  const auto& output = *aggregate->get_output();
+  ASSERT_EQ(output.row_count(), 2u);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 2; ++chunk_offset) {
+    const auto key = type_cast<double>((*output.get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[chunk_offset]);
+    EXPECT_TRUE(key == 0.0 || std::isnan(key));
+    EXPECT_EQ(type_cast<int64_t>((*output.get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[chunk_offset]), 2);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, SumOfStringsFails) {
+  const auto aggregate =
+      std::make_shared<Aggregate>(_table_wrapper, std::vector<ColumnID>{},
+                                  std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsAggregateTest, SpillsGroupsThatExceedTheMemoryLimit) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto row = int32_t{0}; row < 2000; ++row) {
+    table->append({row % 500, "group " + std::to_string(row % 500)});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto group_by_column_ids = std::vector<ColumnID>{ColumnID{1}};
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum},
+                                                                 {ColumnID{0}, AggregateFunction::Max}};
+  const auto in_memory = std::make_shared<Aggregate>(table_wrapper, group_by_column_ids, aggregates);
+  in_memory->execute();
+  EXPECT_EQ(in_memory->get_output()->row_count(), 500u);
+
+  // The limit is only enough for a fraction of the groups.
+  const auto tracker = std::make_shared<QueryMemoryTracker>(50'000);
+  const auto scope = ScopedQueryMemoryTracker{tracker};
+  const auto spilling = std::make_shared<Aggregate>(table_wrapper, group_by_column_ids, aggregates);
+  spilling->execute();
+
+  EXPECT_GT(spilling->spilled_row_count(), 0u);
+  EXPECT_TABLE_EQ(spilling->get_output(), in_memory->get_output());
+  // Only the output is left reserved.
+  EXPECT_EQ(tracker->used(), spilling->performance_data().estimated_output_bytes);
+}
+
+TEST_F(OperatorsAggregateTest, FailsIfASingleGroupExceedsTheMemoryLimit) {
+  const auto tracker = std::make_shared<QueryMemoryTracker>(10);
+  const auto scope = ScopedQueryMemoryTracker{tracker};
+  const auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<ColumnID>{ColumnID{0}},
+      std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Count}});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+}
+
+}  // namespace opossum
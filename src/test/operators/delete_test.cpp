@@ -0,0 +1,137 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsDeleteTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    for (auto value = int32_t{1}; value <= 5; ++value) {
+      _table->append({value});
+    }
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // Returns the rows of the table that are visible to the transaction and satisfy a scan_type value.
+  std::shared_ptr<const AbstractOperator> scan(const std::shared_ptr<TransactionContext>& context,
+                                               const ScanType scan_type, const int32_t value) {
+    const auto table_scan =
+        std::make_shared<TableScan>(get_validated_table("table", context), ColumnID{0}, scan_type, value);
+    table_scan->execute();
+    return table_scan;
+  }
+
+  void delete_rows(const std::shared_ptr<TransactionContext>& context, const ScanType scan_type,
+                   const int32_t value) {
+    const auto delete_operator = std::make_shared<Delete>(scan(context, scan_type, value));
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+  }
+
+  ChunkOffset visible_row_count(const std::shared_ptr<TransactionContext>& context) {
+    return scan(context, ScanType::OpGreaterThan, 0)->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsDeleteTest, DeletesRowsOnCommit) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  delete_rows(context, ScanType::OpGreaterThanEquals, 3);
+
+  // The transaction does not see its deleted rows anymore, others still see them until it commits.
+  const auto other_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(visible_row_count(context), 2u);
+  EXPECT_EQ(visible_row_count(other_context), 5u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 5u);
+
+  context->commit();
+  EXPECT_EQ(visible_row_count(other_context), 5u);
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 2u);
+  EXPECT_EQ(_table->row_count(), 5u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 2u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->invalid_row_count(), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->invalid_row_count(), 2u);
+}
+
+TEST_F(OperatorsDeleteTest, RollbackUnlocksRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  delete_rows(context, ScanType::OpEquals, 2);
+  context->rollback();
+  EXPECT_EQ(_table->approx_valid_row_count(), 5u);
+
+  // The row can be deleted again.
+  const auto next_context = TransactionManager::get().new_transaction_context();
+  delete_rows(next_context, ScanType::OpEquals, 2);
+  EXPECT_EQ(next_context->phase(), TransactionPhase::Active);
+  next_context->commit();
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 4u);
+}
+
+TEST_F(OperatorsDeleteTest, DetectsConflicts) {
+  const auto context_1 = TransactionManager::get().new_transaction_context();
+  const auto context_2 = TransactionManager::get().new_transaction_context();
+  delete_rows(context_1, ScanType::OpLessThan, 3);
+
+  // Both transactions try to delete row 2.
+  delete_rows(context_2, ScanType::OpEquals, 2);
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Conflicted);
+  EXPECT_THROW(context_2->commit(), std::logic_error);
+  context_2->rollback();
+
+  // Rows deleted by committed transactions stay locked, so transactions with an older snapshot conflict as well.
+  const auto context_3 = TransactionManager::get().new_transaction_context();
+  context_1->commit();
+  delete_rows(context_3, ScanType::OpEquals, 1);
+  EXPECT_EQ(context_3->phase(), TransactionPhase::Conflicted);
+  context_3->rollback();
+
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 3u);
+}
+
+TEST_F(OperatorsDeleteTest, DeletesOwnInserts) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto values = std::make_shared<Table>();
+  values->add_column("a", "int");
+  values->append({6});
+  values->append({7});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>("table", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  delete_rows(context, ScanType::OpEquals, 6);
+  EXPECT_EQ(context->phase(), TransactionPhase::Active);
+  EXPECT_EQ(visible_row_count(context), 6u);
+
+  context->commit();
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 6u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 6u);
+}
+
+TEST_F(OperatorsDeleteTest, ThrowsWithoutReferenceSegments) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  const auto delete_operator = std::make_shared<Delete>(get_table);
+  EXPECT_THROW(delete_operator->execute(), std::logic_error);
+  delete_operator->set_transaction_context(context);
+  EXPECT_THROW(delete_operator->execute(), std::logic_error);
+}
+
+}  // namespace opossum
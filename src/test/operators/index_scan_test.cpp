@@ -0,0 +1,95 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    for (auto index = int32_t{0}; index < 30; ++index) {
+      _table->append({(index * 7) % 10, index});
+    }
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{1});
+    _table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>({ColumnID{0}});
+    _table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>({ColumnID{0}});
+    _table->get_chunk(ChunkID{2})->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsIndexScanTest, MatchesTableScan) {
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {-1, 0, 5, 9, 10}) {
+      auto index_scan = std::make_shared<IndexScan>(_table_wrapper, ColumnID{0}, scan_type, search_value);
+      index_scan->execute();
+      auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, scan_type, search_value);
+      table_scan->execute();
+
+      EXPECT_TABLE_EQ(index_scan->get_output(), table_scan->get_output(), true);
+    }
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, OutputReferencesInput) {
+  auto index_scan = std::make_shared<IndexScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  index_scan->execute();
+
+  const auto& output = index_scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 3u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->referenced_table(), _table);
+    EXPECT_EQ(*segment->pos_list(), (PosList{RowID{chunk_id, 9}}));
+  }
+  EXPECT_EQ(index_scan->description(), "IndexScan (column #0 = 3)");
+}
+
+TEST_F(OperatorsIndexScanTest, IncludedChunks) {
+  auto index_scan = std::make_shared<IndexScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 2,
+                                                std::vector<ChunkID>{ChunkID{2}, ChunkID{0}});
+  index_scan->execute();
+
+  // Rows 0 and 3 of each chunk hold the values 0 and 1, the output chunks follow the order of the given chunk ids.
+  const auto& output = index_scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->get_segment(ColumnID{1})->operator[](0), AllTypeVariant{20});
+  EXPECT_EQ(output->get_chunk(ChunkID{1})->get_segment(ColumnID{1})->operator[](1), AllTypeVariant{3});
+}
+
+TEST_F(OperatorsIndexScanTest, EmptyResult) {
+  auto index_scan = std::make_shared<IndexScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(index_scan->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(index_scan->get_output()->get_chunk(ChunkID{0})->column_count(), 2u);
+}
+
+TEST_F(OperatorsIndexScanTest, RequiresIndex) {
+  auto index_scan = std::make_shared<IndexScan>(_table_wrapper, ColumnID{1}, ScanType::OpEquals, 3);
+  EXPECT_THROW(index_scan->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsInsertTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _target_table = std::make_shared<Table>(2, UseMvcc::Yes);
+    _target_table->add_column("a", "int");
+    _target_table->add_column("b", "string", true);
+    _target_table->append({1, "existing"});
+    StorageManager::get().add_table("target", _target_table);
+
+    _values = std::make_shared<Table>(2);
+    _values->add_column("a", "int");
+    _values->add_column("b", "string", true);
+    _values->append({2, "new"});
+    _values->append({3, NULL_VALUE});
+    _values->append({4, "new"});
+    _values_wrapper = std::make_shared<TableWrapper>(_values);
+    _values_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> validate_target(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>("target");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _target_table;
+  std::shared_ptr<Table> _values;
+  std::shared_ptr<TableWrapper> _values_wrapper;
+};
+
+TEST_F(OperatorsInsertTest, InsertsRowsOfTransaction) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>("target", _values_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  EXPECT_EQ(insert->description(), "Insert (target)");
+  EXPECT_EQ(_target_table->row_count(), 4u);
+
+  auto expected_table = std::make_shared<Table>();
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "string", true);
+  expected_table->append({1, "existing"});
+  EXPECT_TABLE_EQ(validate_target(TransactionManager::get().new_transaction_context()), expected_table);
+
+  expected_table->append({2, "new"});
+  expected_table->append({3, NULL_VALUE});
+  expected_table->append({4, "new"});
+  EXPECT_TABLE_EQ(validate_target(context), expected_table);
+
+  context->commit();
+  EXPECT_TABLE_EQ(validate_target(TransactionManager::get().new_transaction_context()), expected_table);
+}
+
+TEST_F(OperatorsInsertTest, ThrowsWithoutMvcc) {
+  const auto insert = std::make_shared<Insert>("target", _values_wrapper);
+  EXPECT_THROW(insert->execute(), std::logic_error);
+
+  StorageManager::get().add_table("values", _values);
+  const auto insert_into_values = std::make_shared<Insert>("values", _values_wrapper);
+  insert_into_values->set_transaction_context(TransactionManager::get().new_transaction_context());
+  EXPECT_THROW(insert_into_values->execute(), std::logic_error);
+}
+
+}  // namespace opossum
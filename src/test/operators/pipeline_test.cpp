@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    for (auto index = int32_t{0}; index < 95; ++index) {
+      table->append({index, index % 7});
+    }
+    table->compress_chunk(ChunkID{1});
+    table->compress_chunk(ChunkID{4});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+  }
+
+  // Builds b < 3 AND a > 20 AND a < 80 on top of the table wrapper.
+  std::shared_ptr<TableScan> create_scans() {
+    auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLessThan, 3);
+    auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpGreaterThan, 20);
+    return std::make_shared<TableScan>(scan_2, ColumnID{0}, ScanType::OpLessThan, 80);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, CollectsPipelineableOperators) {
+  const auto root = create_scans();
+  const auto pipeline = Pipeline{root};
+
+  EXPECT_EQ(pipeline.source(), _table_wrapper);
+  ASSERT_EQ(pipeline.operators().size(), 3u);
+  EXPECT_EQ(pipeline.operators().back(), root);
+}
+
+TEST_F(OperatorsPipelineTest, RejectsNonPipelineableRoot) { EXPECT_THROW(Pipeline{_table_wrapper}, std::logic_error); }
+
+TEST_F(OperatorsPipelineTest, MatchesOperatorAtATimeExecution) {
+  _table_wrapper->execute();
+  const auto expected_root = create_scans();
+  std::const_pointer_cast<AbstractOperator>(expected_root->left_input()->left_input())->execute();
+  std::const_pointer_cast<AbstractOperator>(expected_root->left_input())->execute();
+  expected_root->execute();
+
+  const auto root = create_scans();
+  auto pipeline = Pipeline{root};
+  pipeline.execute();
+
+  EXPECT_TABLE_EQ(root->get_output(), expected_root->get_output(), true);
+  EXPECT_TRUE(root->performance_data().executed);
+  EXPECT_EQ(root->performance_data().output_row_count, expected_root->get_output()->row_count());
+
+  // Intermediate results are never materialized.
+  EXPECT_FALSE(pipeline.operators().front()->performance_data().executed);
+}
+
+TEST_F(OperatorsPipelineTest, ExecutesSource) {
+  const auto root = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 42);
+  auto pipeline = Pipeline{root};
+  pipeline.execute();
+
+  EXPECT_TRUE(_table_wrapper->performance_data().executed);
+  EXPECT_EQ(root->get_output()->row_count(), 1u);
+}
+
+TEST_F(OperatorsPipelineTest, EmptyResult) {
+  const auto root = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1000);
+  auto pipeline = Pipeline{root};
+  pipeline.execute();
+
+  const auto& output = root->get_output();
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->chunk_count(), 1u);
+  EXPECT_EQ(output->column_count(), 2u);
+}
+
+TEST_F(OperatorsPipelineTest, StreamsChunksToSink) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  auto pipeline = Pipeline{create_scans()};
+
+  auto mutex = std::mutex{};
+  auto source_chunk_ids = std::vector<ChunkID>{};
+  auto row_count = uint64_t{0};
+  pipeline.execute([&](const ChunkID source_chunk_id, const std::shared_ptr<const Table>& output) {
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    EXPECT_EQ(output->chunk_count(), 1u);
+    source_chunk_ids.push_back(source_chunk_id);
+    row_count += output->row_count();
+  });
+
+  // Every chunk of the source is pushed through the pipeline exactly once, including those without matches.
+  std::sort(source_chunk_ids.begin(), source_chunk_ids.end());
+  ASSERT_EQ(source_chunk_ids.size(), 10u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 10; ++chunk_id) {
+    EXPECT_EQ(source_chunk_ids[chunk_id], chunk_id);
+  }
+
+  auto expected_row_count = uint64_t{0};
+  for (auto index = int32_t{21}; index < 80; ++index) {
+    expected_row_count += index % 7 < 3;
+  }
+  EXPECT_EQ(row_count, expected_row_count);
+}
+
+}  // namespace opossum
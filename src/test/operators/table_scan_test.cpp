@@ -1,5 +1,8 @@
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -13,7 +16,13 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/load_table.hpp"
@@ -240,6 +249,223 @@ TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanWithIndexes) {
+  const auto create_table = [] {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    for (auto index = int32_t{0}; index < 25; ++index) {
+      table->append({(index * 7) % 10, index});
+    }
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1});
+    return table;
+  };
+
+  // The first chunk has a group-key index, the second one is scanned, and the uncompressed third one has an ART index.
+  const auto indexed_table = create_table();
+  indexed_table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>({ColumnID{0}});
+  indexed_table->get_chunk(ChunkID{2})->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  auto indexed_table_wrapper = std::make_shared<TableWrapper>(indexed_table);
+  indexed_table_wrapper->execute();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(create_table());
+  table_wrapper->execute();
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {-1, 0, 4, 9, 10}) {
+      auto indexed_scan = std::make_shared<TableScan>(indexed_table_wrapper, ColumnID{0}, scan_type, search_value);
+      indexed_scan->execute();
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+
+      EXPECT_TABLE_EQ(indexed_scan->get_output(), scan->get_output(), true);
+    }
+  }
+}
+
+namespace {
+
+// Group-key index that counts its lookups, so that tests can check whether a scan used it.
+class CountingGroupKeyIndex : public GroupKeyIndex {
+ public:
+  using GroupKeyIndex::GroupKeyIndex;
+
+  mutable std::atomic<size_t> lookup_count{0};
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override {
+    ++lookup_count;
+    return GroupKeyIndex::_lower_bound(values);
+  }
+};
+
+}  // namespace
+
+TEST_F(OperatorsTableScanTest, ChooseIndexBySelectivity) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  for (auto index = int32_t{0}; index < 2000; ++index) {
+    table->append({(index * 7) % 1000});
+  }
+  table->compress_chunk(ChunkID{0});
+  const auto index = table->get_chunk(ChunkID{0})->create_index<CountingGroupKeyIndex>({ColumnID{0}});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan_and_count_lookups = [&](const ScanType scan_type, const AllTypeVariant& search_value,
+                                          const size_t expected_row_count) {
+    index->lookup_count = 0;
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count);
+    return index->lookup_count.load();
+  };
+
+  // Selective predicates on the compressed chunk are answered by the index.
+  EXPECT_GT(scan_and_count_lookups(ScanType::OpEquals, 42, 2), 0u);
+  EXPECT_GT(scan_and_count_lookups(ScanType::OpLessThan, 20, 40), 0u);
+
+  // Predicates that match most rows are scanned.
+  EXPECT_EQ(scan_and_count_lookups(ScanType::OpLessThan, 900, 1800), 0u);
+  EXPECT_EQ(scan_and_count_lookups(ScanType::OpNotEquals, 42, 1998), 0u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithTableIndex) {
+  const auto create_table = [] {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    for (auto index = int32_t{0}; index < 95; ++index) {
+      table->append({(index * 7) % 20, index});
+    }
+    return table;
+  };
+
+  const auto indexed_table = create_table();
+  StorageManager::get().add_table("indexed_table", indexed_table);
+  StorageManager::get().create_index("indexed_table", ColumnID{0});
+  indexed_table->append({3, 1000});
+  indexed_table->compress_chunk(ChunkID{2});
+  auto indexed_table_wrapper = std::make_shared<TableWrapper>(indexed_table);
+  indexed_table_wrapper->execute();
+
+  auto table = create_table();
+  table->append({3, 1000});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpLessThan, ScanType::OpNotEquals}) {
+    for (const auto search_value : {-1, 3, 19}) {
+      auto indexed_scan = std::make_shared<TableScan>(indexed_table_wrapper, ColumnID{0}, scan_type, search_value);
+      indexed_scan->execute();
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+
+      EXPECT_TABLE_EQ(indexed_scan->get_output(), scan->get_output(), true);
+    }
+  }
+
+  // Scans on the output of the indexed scan use the usual path.
+  auto point_scan = std::make_shared<TableScan>(indexed_table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  point_scan->execute();
+  EXPECT_TRUE(point_scan->used_table_index());
+  auto chained_scan = std::make_shared<TableScan>(point_scan, ColumnID{1}, ScanType::OpGreaterThan, 50);
+  chained_scan->execute();
+  EXPECT_FALSE(chained_scan->used_table_index());
+  EXPECT_EQ(chained_scan->get_output()->row_count(), 3u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthSegment) {
+  // Runs of 1000 equal values, some of which span the boundary between two morsels.
+  const auto row_count = static_cast<int32_t>(TableScan::MORSEL_SIZE + 5000);
+  auto create_table = [&](const std::optional<EncodingType> encoding_type) {
+    auto table = std::make_shared<Table>(2 * TableScan::MORSEL_SIZE);
+    table->add_column("a", "int");
+    for (auto index = int32_t{0}; index < row_count; ++index) {
+      table->append({index / 1000});
+    }
+    if (encoding_type) table->compress_chunk(ChunkID{0}, *encoding_type);
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto unencoded_table = create_table(std::nullopt);
+  const auto run_length_table = create_table(EncodingType::RunLength);
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    auto expected_scan = std::make_shared<TableScan>(unencoded_table, ColumnID{0}, scan_type, 65);
+    expected_scan->execute();
+    auto scan = std::make_shared<TableScan>(run_length_table, ColumnID{0}, scan_type, 65);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_scan->get_output()->row_count()) << scan_type;
+
+    // The second scan evaluates the runs for the positions referenced by the first one.
+    auto chained_scan = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpNotEquals, 3);
+    chained_scan->execute();
+    auto expected_chained_scan = std::make_shared<TableScan>(expected_scan, ColumnID{0}, ScanType::OpNotEquals, 3);
+    expected_chained_scan->execute();
+    EXPECT_EQ(chained_scan->get_output()->row_count(), expected_chained_scan->get_output()->row_count()) << scan_type;
+  }
+
+  auto scan = std::make_shared<TableScan>(run_length_table, ColumnID{0}, ScanType::OpEquals, 65);
+  scan->execute();
+  const auto pos_list =
+      std::dynamic_pointer_cast<ReferenceSegment>(scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+          ->pos_list();
+  ASSERT_EQ(pos_list->size(), 1000u);
+  for (auto index = ChunkOffset{0}; index < 1000; ++index) {
+    EXPECT_EQ((*pos_list)[index], (RowID{ChunkID{0}, 65000 + index}));
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnFrameOfReferenceSegment) {
+  // Values with a block minimum that differs from block to block, including negative values and the extremes.
+  auto values = std::vector<int64_t>{};
+  for (auto index = int64_t{0}; index < 5000; ++index) {
+    values.push_back((index % 2 ? -1 : 1) * (index / 7) + 3 * (index / 2048));
+  }
+  values.push_back(std::numeric_limits<int64_t>::max());
+  values.push_back(std::numeric_limits<int64_t>::min());
+
+  auto create_table = [&](const std::optional<EncodingType> encoding_type) {
+    auto table = std::make_shared<Table>(6000);
+    table->add_column("a", "long");
+    for (const auto value : values) {
+      table->append({value});
+    }
+    if (encoding_type) table->compress_chunk(ChunkID{0}, *encoding_type);
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto unencoded_table = create_table(std::nullopt);
+  const auto frame_of_reference_table = create_table(EncodingType::FrameOfReference);
+
+  for (const auto search_value : {int64_t{-400}, int64_t{0}, int64_t{5}, int64_t{300}, int64_t{2000},
+                                  std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()}) {
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+      auto expected_scan = std::make_shared<TableScan>(unencoded_table, ColumnID{0}, scan_type, search_value);
+      expected_scan->execute();
+      auto scan = std::make_shared<TableScan>(frame_of_reference_table, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), expected_scan->get_output()->row_count())
+          << scan_type << " " << search_value;
+
+      // The second scan evaluates the positions referenced by the first one.
+      auto chained_scan = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpGreaterThan, 3);
+      chained_scan->execute();
+      auto expected_chained_scan = std::make_shared<TableScan>(expected_scan, ColumnID{0}, ScanType::OpGreaterThan, 3);
+      expected_chained_scan->execute();
+      EXPECT_EQ(chained_scan->get_output()->row_count(), expected_chained_scan->get_output()->row_count())
+          << scan_type << " " << search_value;
+    }
+  }
+}
+
 TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
   scan_1->execute();
@@ -269,4 +495,217 @@ TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_F(OperatorsTableScanTest, ChainedScanReferencesOriginalTable) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 120);
+  scan_2->execute();
+
+  const auto& output = scan_2->get_output();
+  ASSERT_COLUMN_EQ(output, ColumnID{1}, {104, 106, 108, 110, 112, 114, 116, 118});
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(column_id));
+      ASSERT_TRUE(reference_segment);
+      EXPECT_EQ(reference_segment->referenced_table(), _table_wrapper_even_dict->get_output());
+      EXPECT_EQ(reference_segment->referenced_column_id(), column_id);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ConjunctiveScanOnStringColumn) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto index = int32_t{0}; index < 10; ++index) {
+    table->append({index, index % 2 == 0 ? "x" : "y"});
+  }
+  table->compress_chunk(ChunkID{1});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, "x");
+  scan_2->execute();
+
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{0}, {4, 6, 8});
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferenceSegmentAcrossChunks) {
+  // A position list that jumps back and forth between the chunks of the referenced table.
+  const auto table = _table_wrapper_even_dict->get_output();
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>(
+      {RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 4}, RowID{ChunkID{1}, 3}, RowID{ChunkID{0}, 1}, RowID{ChunkID{2}, 0}}));
+
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  reference_table->add_column_definition("b", "int");
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list));
+  chunk->add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{1}, pos_list));
+  reference_table->emplace_chunk(chunk);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 8);
+  scan->execute();
+
+  const auto& output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 4u);
+  const auto output_segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+  EXPECT_EQ((*output_segment)[0], AllTypeVariant{110});
+  EXPECT_EQ((*output_segment)[1], AllTypeVariant{108});
+  EXPECT_EQ((*output_segment)[2], AllTypeVariant{116});
+  EXPECT_EQ((*output_segment)[3], AllTypeVariant{120});
+}
+
+TEST_F(OperatorsTableScanTest, ScanMorselsInParallel) {
+  // Chunks with more rows than TableScan::MORSEL_SIZE are split into multiple morsels.
+  const auto chunk_size = ChunkOffset{TableScan::MORSEL_SIZE + TableScan::MORSEL_SIZE / 2};
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  for (auto index = int32_t{0}; index < static_cast<int32_t>(2 * chunk_size + 1000); ++index) {
+    table->append({index % 1000});
+  }
+  table->compress_chunk(ChunkID{1});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 500);
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpGreaterThanEquals, 250);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(scan_2));
+
+  const auto& output = scan_2->get_output();
+  ASSERT_EQ(output->chunk_count(), 3u);
+
+  // The matches of all morsels have to be stitched together in the order of the input.
+  auto expected_row_count = ChunkOffset{0};
+  auto previous_row_id = std::optional<RowID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    for (const auto& row_id : *segment->pos_list()) {
+      EXPECT_TRUE(!previous_row_id || *previous_row_id < row_id);
+      previous_row_id = row_id;
+    }
+  }
+  for (auto index = int32_t{0}; index < static_cast<int32_t>(2 * chunk_size + 1000); ++index) {
+    expected_row_count += index % 1000 >= 250 && index % 1000 < 500;
+  }
+  EXPECT_EQ(output->row_count(), expected_row_count);
+}
+
+TEST_F(OperatorsTableScanTest, ScanNullableColumn) {
+  // Every fifth row is NULL. The other rows include 0, which NULL rows hold as placeholder in the value segment.
+  const auto row_count = int32_t{5000};
+  const auto value_of = [](const int32_t index) { return index % 5 == 0 ? NULL_VALUE : AllTypeVariant{index % 7}; };
+  auto create_table = [&](const std::optional<EncodingType> encoding_type) {
+    auto table = std::make_shared<Table>(6000);
+    table->add_column("a", "int", true);
+    for (auto index = int32_t{0}; index < row_count; ++index) {
+      table->append({value_of(index)});
+    }
+    if (encoding_type) table->compress_chunk(ChunkID{0}, *encoding_type);
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto expected_row_count = [&](const ScanType scan_type, const int32_t search_value,
+                                      const std::function<bool(int32_t)>& filter) {
+    auto count = ChunkOffset{0};
+    for (auto index = int32_t{0}; index < row_count; ++index) {
+      if (!filter(index)) continue;
+      const auto value = value_of(index);
+      if (variant_is_null(value)) {
+        count += scan_type == ScanType::OpIsNull;
+        continue;
+      }
+      const auto typed_value = get<int32_t>(value);
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          count += typed_value == search_value;
+          break;
+        case ScanType::OpNotEquals:
+          count += typed_value != search_value;
+          break;
+        case ScanType::OpLessThan:
+          count += typed_value < search_value;
+          break;
+        case ScanType::OpLessThanEquals:
+          count += typed_value <= search_value;
+          break;
+        case ScanType::OpGreaterThan:
+          count += typed_value > search_value;
+          break;
+        case ScanType::OpGreaterThanEquals:
+          count += typed_value >= search_value;
+          break;
+        case ScanType::OpIsNull:
+          break;
+        case ScanType::OpIsNotNull:
+          ++count;
+          break;
+      }
+    }
+    return count;
+  };
+
+  for (const auto encoding_type : {std::optional<EncodingType>{}, std::optional{EncodingType::Dictionary},
+                                   std::optional{EncodingType::RunLength},
+                                   std::optional{EncodingType::FrameOfReference}}) {
+    const auto table_wrapper = create_table(encoding_type);
+    for (const auto search_value : {0, 3, 6}) {
+      for (const auto scan_type :
+           {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+            ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals, ScanType::OpIsNull, ScanType::OpIsNotNull}) {
+        auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+        scan->execute();
+        EXPECT_EQ(scan->get_output()->row_count(), expected_row_count(scan_type, search_value, [](int32_t) {
+          return true;
+        })) << scan_type << " " << search_value;
+
+        // The second scan evaluates the positions referenced by the first one.
+        auto first_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 1);
+        first_scan->execute();
+        auto chained_scan = std::make_shared<TableScan>(first_scan, ColumnID{0}, scan_type, search_value);
+        chained_scan->execute();
+        EXPECT_EQ(chained_scan->get_output()->row_count(),
+                  expected_row_count(scan_type, search_value, [&](const int32_t index) {
+                    return !variant_is_null(value_of(index)) && index % 7 != 1;
+                  }))
+            << scan_type << " " << search_value;
+      }
+    }
+
+    // Comparisons with NULL are never true.
+    auto null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, NULL_VALUE);
+    null_scan->execute();
+    EXPECT_EQ(null_scan->get_output()->row_count(), 0u);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanNullValuesFromFile) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_string_null.tbl", 2));
+  table_wrapper->execute();
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpIsNull, NULL_VALUE);
+  scan_1->execute();
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{0}, {5});
+
+  auto scan_2 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan_2->execute();
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{1}, {"x", NULL_VALUE});
+}
+
 }  // namespace opossum
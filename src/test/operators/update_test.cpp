@@ -0,0 +1,89 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsUpdateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "three"});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // Replaces row 2 by {20, "twenty"}.
+  std::shared_ptr<Update> update(const std::shared_ptr<TransactionContext>& context) {
+    const auto rows_to_update =
+        std::make_shared<TableScan>(get_validated_table("table", context), ColumnID{0}, ScanType::OpEquals, 2);
+    rows_to_update->execute();
+    auto values = std::make_shared<Table>();
+    values->add_column("a", "int");
+    values->add_column("b", "string");
+    values->append({20, "twenty"});
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto update = std::make_shared<Update>("table", rows_to_update, table_wrapper);
+    update->set_transaction_context(context);
+    return update;
+  }
+
+  std::shared_ptr<Table> expected_table(const bool updated) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->append({1, "one"});
+    updated ? table->append({20, "twenty"}) : table->append({2, "two"});
+    table->append({3, "three"});
+    return table;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsUpdateTest, ReplacesRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto update_operator = update(context);
+  update_operator->execute();
+  EXPECT_EQ(update_operator->description(), "Update (table)");
+
+  EXPECT_TABLE_EQ(get_validated_table("table", context)->get_output(), expected_table(true));
+  EXPECT_TABLE_EQ(get_validated_table("table", TransactionManager::get().new_transaction_context())->get_output(),
+                  expected_table(false));
+
+  context->commit();
+  EXPECT_TABLE_EQ(get_validated_table("table", TransactionManager::get().new_transaction_context())->get_output(),
+                  expected_table(true));
+  EXPECT_EQ(_table->row_count(), 4u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3u);
+}
+
+TEST_F(OperatorsUpdateTest, StopsOnConflict) {
+  const auto context_1 = TransactionManager::get().new_transaction_context();
+  const auto context_2 = TransactionManager::get().new_transaction_context();
+  update(context_1)->execute();
+  update(context_2)->execute();
+
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Conflicted);
+  EXPECT_EQ(_table->row_count(), 4u);
+  context_2->rollback();
+  context_1->commit();
+  EXPECT_TABLE_EQ(get_validated_table("table", TransactionManager::get().new_transaction_context())->get_output(),
+                  expected_table(true));
+}
+
+}  // namespace opossum
@@ -0,0 +1,187 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsValidateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "committed"});
+    _table->append({2, "committed"});
+
+    _uncommitted_context = TransactionManager::get().new_transaction_context();
+    insert(_uncommitted_context, {3, "uncommitted"});
+    insert(_uncommitted_context, {4, "uncommitted"});
+    _table->append({5, "committed"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  void insert(const std::shared_ptr<TransactionContext>& context, const std::vector<TaggedValue>& values) {
+    context->register_insert(_table, _table->append(values, context->transaction_id()));
+  }
+
+  std::shared_ptr<const Table> validate(const std::shared_ptr<const AbstractOperator>& input,
+                                        const std::shared_ptr<TransactionContext>& context) {
+    return execute_validate(input, context)->get_output();
+  }
+
+  std::shared_ptr<Table> expected_table(const std::vector<int32_t>& values) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (const auto value : values) {
+      table->append({value, value == 3 || value == 4 ? "uncommitted" : "committed"});
+    }
+    return table;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TransactionContext> _uncommitted_context;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsValidateTest, IsRowVisible) {
+  // Committed rows are visible from their commit on, until they are deleted.
+  EXPECT_TRUE(Validate::is_row_visible(2, 5, INVALID_TRANSACTION_ID, 5, MAX_COMMIT_ID));
+  EXPECT_FALSE(Validate::is_row_visible(2, 4, INVALID_TRANSACTION_ID, 5, MAX_COMMIT_ID));
+  EXPECT_TRUE(Validate::is_row_visible(2, 5, INVALID_TRANSACTION_ID, 3, 6));
+  EXPECT_FALSE(Validate::is_row_visible(2, 6, INVALID_TRANSACTION_ID, 3, 6));
+
+  // Uncommitted rows are only visible to the transaction that inserted them.
+  EXPECT_TRUE(Validate::is_row_visible(2, 5, 2, MAX_COMMIT_ID, MAX_COMMIT_ID));
+  EXPECT_FALSE(Validate::is_row_visible(3, 5, 2, MAX_COMMIT_ID, MAX_COMMIT_ID));
+
+  // Rolled back rows are never visible.
+  EXPECT_FALSE(Validate::is_row_visible(2, 5, INVALID_TRANSACTION_ID, MAX_COMMIT_ID, 0));
+}
+
+TEST_F(OperatorsValidateTest, HidesUncommittedRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto output = validate(_table_wrapper, context);
+  EXPECT_TABLE_EQ(output, expected_table({1, 2, 5}));
+  const auto segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ReferenceSegment>(segment));
+
+  EXPECT_TABLE_EQ(validate(_table_wrapper, _uncommitted_context), expected_table({1, 2, 3, 4, 5}));
+}
+
+TEST_F(OperatorsValidateTest, UsesSnapshotOfTransaction) {
+  const auto old_context = TransactionManager::get().new_transaction_context();
+  _uncommitted_context->commit();
+  const auto new_context = TransactionManager::get().new_transaction_context();
+
+  EXPECT_TABLE_EQ(validate(_table_wrapper, old_context), expected_table({1, 2, 5}));
+  EXPECT_TABLE_EQ(validate(_table_wrapper, new_context), expected_table({1, 2, 3, 4, 5}));
+}
+
+TEST_F(OperatorsValidateTest, HidesRolledBackRows) {
+  _uncommitted_context->rollback();
+  const auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_TABLE_EQ(validate(_table_wrapper, context), expected_table({1, 2, 5}));
+}
+
+TEST_F(OperatorsValidateTest, ValidatesReferenceSegments) {
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto output = validate(scan, context);
+  EXPECT_TABLE_EQ(output, expected_table({2, 5}));
+  const auto segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table);
+}
+
+TEST_F(OperatorsValidateTest, ExecutesInPipeline) {
+  const auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(_uncommitted_context);
+  const auto scan = std::make_shared<TableScan>(validate, ColumnID{0}, ScanType::OpLessThan, 5);
+  auto pipeline = Pipeline{scan};
+  pipeline.execute();
+  EXPECT_EQ(pipeline.operators().size(), 2u);
+  EXPECT_TABLE_EQ(scan->get_output(), expected_table({1, 2, 3, 4}));
+}
+
+TEST_F(OperatorsValidateTest, ReturnsEmptyTable) {
+  auto table = std::make_shared<Table>(3, UseMvcc::Yes);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto output = validate(table_wrapper, _uncommitted_context);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->chunk_count(), 1u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->column_count(), 2u);
+}
+
+TEST_F(OperatorsValidateTest, ThrowsWithoutMvcc) {
+  EXPECT_THROW(validate(_table_wrapper, nullptr), std::logic_error);
+
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  table->append({1});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  EXPECT_THROW(validate(table_wrapper, _uncommitted_context), std::logic_error);
+}
+
+TEST_F(OperatorsValidateTest, SeesConsistentSnapshotsWhileRowsAreAppended) {
+  // A writer inserts batches of rows in transactions, while readers validate the table. Readers must never see a
+  // partial batch, and later snapshots must not see fewer rows.
+  constexpr auto batch_size = 5;
+  constexpr auto batch_count = 1000;
+  auto table = std::make_shared<Table>(7, UseMvcc::Yes);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  auto done = std::atomic_bool{false};
+
+  auto writer = std::thread([&] {
+    for (auto batch = int32_t{0}; batch < batch_count; ++batch) {
+      const auto context = TransactionManager::get().new_transaction_context();
+      for (auto row = 0; row < batch_size; ++row) {
+        context->register_insert(table, table->append({batch, "row"}, context->transaction_id()));
+      }
+      batch % 3 == 0 ? context->rollback() : context->commit();
+    }
+    done = true;
+  });
+
+  auto previous_row_count = ChunkOffset{0};
+  do {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    const auto row_count = validate(table_wrapper, TransactionManager::get().new_transaction_context())->row_count();
+    EXPECT_EQ(row_count % batch_size, 0u);
+    EXPECT_GE(row_count, previous_row_count);
+    previous_row_count = row_count;
+  } while (!done);
+  writer.join();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto output = validate(table_wrapper, TransactionManager::get().new_transaction_context());
+  EXPECT_EQ(output->row_count(), (batch_count - (batch_count + 2) / 3) * batch_size);
+  EXPECT_EQ(table->row_count(), batch_count * batch_size);
+}
+
+}  // namespace opossum
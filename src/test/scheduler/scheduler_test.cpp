@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class SchedulerTest : public BaseTest {};
+
+TEST_F(SchedulerTest, ImmediateExecutionWithoutScheduler) {
+  auto order = std::vector<int32_t>{};
+  const auto task_1 = std::make_shared<JobTask>([&] { order.push_back(1); });
+  const auto task_2 = std::make_shared<JobTask>([&] { order.push_back(2); });
+  task_1->set_as_predecessor_of(task_2);
+
+  // task_2 is not ready yet, so scheduling it does not execute it.
+  task_2->schedule();
+  EXPECT_FALSE(task_2->is_ready());
+  EXPECT_TRUE(order.empty());
+
+  task_1->schedule();
+  EXPECT_TRUE(task_1->is_done());
+  EXPECT_TRUE(task_2->is_done());
+  EXPECT_EQ(order, std::vector<int32_t>({1, 2}));
+}
+
+TEST_F(SchedulerTest, CannotScheduleTwice) {
+  const auto task = std::make_shared<JobTask>([] {});
+  task->schedule();
+  EXPECT_THROW(task->schedule(), std::logic_error);
+}
+
+TEST_F(SchedulerTest, ExecutesAllTasks) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  auto counter = std::atomic<uint32_t>{0};
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  for (auto index = 0; index < 1000; ++index) {
+    tasks.push_back(std::make_shared<JobTask>([&] { ++counter; }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(counter, 1000u);
+}
+
+TEST_F(SchedulerTest, RespectsDependencies) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  // Diamond: first -> {left, right} -> last
+  auto mutex = std::mutex{};
+  auto order = std::vector<int32_t>{};
+  const auto record = [&](const int32_t id) {
+    const auto lock = std::lock_guard<std::mutex>{mutex};
+    order.push_back(id);
+  };
+
+  const auto first = std::make_shared<JobTask>([&] { record(0); });
+  const auto left = std::make_shared<JobTask>([&] { record(1); });
+  const auto right = std::make_shared<JobTask>([&] { record(1); });
+  const auto last = std::make_shared<JobTask>([&] { record(2); });
+  first->set_as_predecessor_of(left);
+  first->set_as_predecessor_of(right);
+  left->set_as_predecessor_of(last);
+  right->set_as_predecessor_of(last);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{last, right, left, first});
+
+  EXPECT_EQ(order, std::vector<int32_t>({0, 1, 1, 2}));
+}
+
+TEST_F(SchedulerTest, FailedTasksSkipSuccessors) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+
+  auto successor_executed = std::atomic_bool{false};
+  auto independent_executed = std::atomic_bool{false};
+  const auto failing = std::make_shared<JobTask>([] { Fail("Task failed"); });
+  const auto successor = std::make_shared<JobTask>([&] { successor_executed = true; });
+  const auto independent = std::make_shared<JobTask>([&] { independent_executed = true; });
+  failing->set_as_predecessor_of(successor);
+
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{
+                   failing, successor, independent}),
+               std::logic_error);
+  EXPECT_TRUE(successor->is_done());
+  EXPECT_FALSE(successor_executed);
+  EXPECT_TRUE(independent_executed);
+  EXPECT_TRUE(failing->exception());
+  EXPECT_EQ(successor->exception(), failing->exception());
+  EXPECT_FALSE(independent->exception());
+}
+
+TEST_F(SchedulerTest, SubtasksDoNotBlockWorkers) {
+  // A single worker has to execute the subtasks itself while its parent task waits for them.
+  CurrentScheduler::set(std::make_shared<Scheduler>(1));
+
+  auto counter = std::atomic<uint32_t>{0};
+  const auto parent = std::make_shared<JobTask>([&] {
+    auto subtasks = std::vector<std::shared_ptr<JobTask>>{};
+    for (auto index = 0; index < 10; ++index) {
+      subtasks.push_back(std::make_shared<JobTask>([&] { ++counter; }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(subtasks);
+  });
+  parent->schedule();
+  parent->join();
+
+  EXPECT_EQ(counter, 10u);
+}
+
+TEST_F(SchedulerTest, IdleWorkersStealTasks) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  // All subtasks end up in the queue of the worker that executes the parent. The others have to steal them.
+  auto mutex = std::mutex{};
+  auto thread_ids = std::set<std::thread::id>{};
+  const auto parent = std::make_shared<JobTask>([&] {
+    auto subtasks = std::vector<std::shared_ptr<JobTask>>{};
+    for (auto index = 0; index < 100; ++index) {
+      subtasks.push_back(std::make_shared<JobTask>([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        thread_ids.insert(std::this_thread::get_id());
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(subtasks);
+  });
+  parent->schedule();
+  parent->join();
+
+  EXPECT_GT(thread_ids.size(), 1u);
+}
+
+TEST_F(SchedulerTest, LowPriorityTasksRunLast) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(1));
+
+  // Block the only worker, so that both tasks are queued before either of them runs.
+  auto started = std::atomic_bool{false};
+  auto released = std::atomic_bool{false};
+  const auto blocker = std::make_shared<JobTask>([&] {
+    started = true;
+    while (!released) std::this_thread::yield();
+  });
+  blocker->schedule();
+  while (!started) std::this_thread::yield();
+
+  auto order = std::vector<SchedulePriority>{};
+  const auto low = std::make_shared<JobTask>([&] { order.push_back(SchedulePriority::Low); }, SchedulePriority::Low);
+  const auto regular = std::make_shared<JobTask>([&] { order.push_back(SchedulePriority::Default); });
+  EXPECT_EQ(low->priority(), SchedulePriority::Low);
+  EXPECT_EQ(regular->priority(), SchedulePriority::Default);
+  low->schedule();
+  regular->schedule();
+  released = true;
+  blocker->join();
+  low->join();
+  regular->join();
+
+  EXPECT_EQ(order, std::vector<SchedulePriority>({SchedulePriority::Default, SchedulePriority::Low}));
+}
+
+TEST_F(SchedulerTest, BoundsRunningLowPriorityTasks) {
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+
+  auto mutex = std::mutex{};
+  auto running_count = uint32_t{0};
+  auto max_running_count = uint32_t{0};
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  for (auto index = 0; index < 8; ++index) {
+    tasks.push_back(std::make_shared<JobTask>(
+        [&] {
+          {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            max_running_count = std::max(max_running_count, ++running_count);
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds{1});
+          const auto lock = std::lock_guard<std::mutex>{mutex};
+          --running_count;
+        },
+        SchedulePriority::Low));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(max_running_count, Scheduler::MAX_RUNNING_LOW_PRIORITY_TASKS);
+}
+
+TEST_F(SchedulerTest, OperatorTasks) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (auto value = int32_t{0}; value < 10; ++value) {
+    table->append({value});
+  }
+  StorageManager::get().add_table("table_a", table);
+
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto scan_1 = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  const auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpLessThan, 8);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan_2);
+  ASSERT_EQ(tasks.size(), 3u);
+  EXPECT_EQ(tasks[0]->get_operator(), get_table);
+  EXPECT_EQ(tasks[2]->get_operator(), scan_2);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), 5u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/segment_statistics.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StatisticsSegmentStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    int_segment = std::make_shared<ValueSegment<int32_t>>();
+    for (auto index = int32_t{0}; index < 200; ++index) {
+      int_segment->append(10 + index % 100);
+    }
+
+    string_segment = std::make_shared<ValueSegment<std::string>>();
+    for (const auto* value : {"delta", "alpha", "charlie", "alpha", "echo"}) {
+      string_segment->append(value);
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> int_segment;
+  std::shared_ptr<ValueSegment<std::string>> string_segment;
+};
+
+TEST_F(StatisticsSegmentStatisticsTest, CreateFromSegments) {
+  const auto value_statistics = BaseSegmentStatistics::create(*int_segment);
+  const auto dictionary_statistics =
+      BaseSegmentStatistics::create(DictionarySegment<int32_t>{std::shared_ptr<AbstractSegment>{int_segment}});
+
+  for (const auto& statistics : {value_statistics, dictionary_statistics}) {
+    const auto& typed_statistics = dynamic_cast<const SegmentStatistics<int32_t>&>(*statistics);
+    EXPECT_EQ(typed_statistics.min(), 10);
+    EXPECT_EQ(typed_statistics.max(), 109);
+    EXPECT_EQ(typed_statistics.distinct_count(), 100u);
+  }
+
+  EXPECT_FALSE(BaseSegmentStatistics::create(ValueSegment<float>{}));
+}
+
+TEST_F(StatisticsSegmentStatisticsTest, EstimateNumericSelectivity) {
+  const auto statistics = BaseSegmentStatistics::create(*int_segment);
+
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpEquals, 50), 0.01f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpEquals, 5), 0.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpNotEquals, 50), 0.99f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpNotEquals, 200), 1.0f);
+
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpLessThan, 5), 0.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpLessThan, 10), 0.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpLessThanEquals, 10), 0.01f);
+  EXPECT_NEAR(statistics->estimate_selectivity(ScanType::OpLessThan, 59.5), 0.5f, 0.01f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpLessThanEquals, 109), 1.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpGreaterThan, 109), 0.0f);
+  EXPECT_NEAR(statistics->estimate_selectivity(ScanType::OpGreaterThanEquals, 109), 0.01f, 1e-6f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpGreaterThanEquals, 0), 1.0f);
+}
+
+TEST_F(StatisticsSegmentStatisticsTest, EstimateStringSelectivity) {
+  const auto statistics = BaseSegmentStatistics::create(*string_segment);
+  EXPECT_EQ(statistics->distinct_count(), 4u);
+
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpEquals, "bravo"), 0.25f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpEquals, "zulu"), 0.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpLessThan, "aaa"), 0.0f);
+  EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpGreaterThan, "zulu"), 0.0f);
+
+  // Within the range of values, open range predicates fall back to a default selectivity.
+  const auto selectivity = statistics->estimate_selectivity(ScanType::OpLessThan, "bravo");
+  EXPECT_GT(selectivity, 0.0f);
+  EXPECT_LT(selectivity, 1.0f);
+}
+
+TEST_F(StatisticsSegmentStatisticsTest, NullValues) {
+  const auto nullable_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto index = int32_t{0}; index < 100; ++index) {
+    // The placeholder values of NULL rows must not count as 0.
+    nullable_segment->append(index % 4 == 0 ? NULL_VALUE : AllTypeVariant{10 + index});
+  }
+
+  const auto value_statistics = BaseSegmentStatistics::create(*nullable_segment);
+  const auto dictionary_statistics = BaseSegmentStatistics::create(
+      DictionarySegment<int32_t>{std::shared_ptr<AbstractSegment>{nullable_segment}});
+
+  for (const auto& statistics : {value_statistics, dictionary_statistics}) {
+    const auto& typed_statistics = dynamic_cast<const SegmentStatistics<int32_t>&>(*statistics);
+    EXPECT_EQ(typed_statistics.min(), 11);
+    EXPECT_EQ(typed_statistics.max(), 109);
+    EXPECT_EQ(typed_statistics.distinct_count(), 75u);
+    EXPECT_FLOAT_EQ(typed_statistics.null_fraction(), 0.25f);
+
+    EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpIsNull, NULL_VALUE), 0.25f);
+    EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpIsNotNull, NULL_VALUE), 0.75f);
+    EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpGreaterThanEquals, 11), 0.75f);
+    EXPECT_FLOAT_EQ(statistics->estimate_selectivity(ScanType::OpEquals, NULL_VALUE), 0.0f);
+
+    EXPECT_TRUE(statistics->does_not_contain(ScanType::OpLessThan, 11));
+    EXPECT_FALSE(statistics->does_not_contain(ScanType::OpLessThanEquals, 11));
+    EXPECT_TRUE(statistics->does_not_contain(ScanType::OpGreaterThan, 109));
+    EXPECT_TRUE(statistics->does_not_contain(ScanType::OpEquals, 0));
+    EXPECT_TRUE(statistics->does_not_contain(ScanType::OpNotEquals, NULL_VALUE));
+    EXPECT_FALSE(statistics->does_not_contain(ScanType::OpIsNull, NULL_VALUE));
+  }
+
+  EXPECT_TRUE(BaseSegmentStatistics::create(*int_segment)->does_not_contain(ScanType::OpIsNull, NULL_VALUE));
+}
+
+}  // namespace opossum
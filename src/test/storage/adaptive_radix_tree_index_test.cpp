@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  template <typename T>
+  static std::shared_ptr<ValueSegment<T>> create_segment(const std::vector<T>& values) {
+    auto segment = std::make_shared<ValueSegment<T>>();
+    for (const auto& value : values) {
+      segment->append(value);
+    }
+    return segment;
+  }
+
+  // Checks that the index orders the offsets by value and that the bounds for each search value match those of a
+  // sorted copy of the values.
+  template <typename T>
+  static void check_bounds(const std::vector<T>& values, const std::vector<T>& search_values,
+                           const std::shared_ptr<const AbstractSegment>& segment) {
+    const auto index = AdaptiveRadixTreeIndex{{segment}};
+
+    auto indexed_values = std::vector<T>{};
+    for (auto iter = index.cbegin(); iter != index.cend(); ++iter) {
+      indexed_values.push_back(values[*iter]);
+    }
+    ASSERT_EQ(indexed_values.size(), values.size());
+    EXPECT_TRUE(std::is_sorted(indexed_values.cbegin(), indexed_values.cend()));
+
+    for (const auto& search_value : search_values) {
+      const auto expected_lower = std::lower_bound(indexed_values.cbegin(), indexed_values.cend(), search_value);
+      const auto expected_upper = std::upper_bound(indexed_values.cbegin(), indexed_values.cend(), search_value);
+      EXPECT_EQ(std::distance(index.cbegin(), index.lower_bound({search_value})),
+                std::distance(indexed_values.cbegin(), expected_lower));
+      EXPECT_EQ(std::distance(index.cbegin(), index.upper_bound({search_value})),
+                std::distance(indexed_values.cbegin(), expected_upper));
+    }
+  }
+
+  template <typename T>
+  static void check_bounds(const std::vector<T>& values, const std::vector<T>& search_values) {
+    check_bounds(values, search_values, create_segment(values));
+  }
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, IntegerKeys) {
+  auto values = std::vector<int32_t>{};
+  for (auto index = int32_t{0}; index < 1000; ++index) {
+    values.push_back((index * 37) % 200 - 100);
+  }
+  values.push_back(std::numeric_limits<int32_t>::min());
+  values.push_back(std::numeric_limits<int32_t>::max());
+
+  check_bounds<int32_t>(values, {std::numeric_limits<int32_t>::min(), -101, -100, -1, 0, 1, 42, 99, 100, 1 << 20});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, LongKeys) {
+  check_bounds<int64_t>({int64_t{1} << 40, -(int64_t{1} << 40), 0, 3, 3, -3, std::numeric_limits<int64_t>::max()},
+                        {-(int64_t{1} << 41), -3, 0, 3, 4, int64_t{1} << 40, std::numeric_limits<int64_t>::max()});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, FloatingPointKeys) {
+  check_bounds<float>({1.5f, -1.5f, 0.0f, -0.0f, 1e30f, -1e30f, 0.25f, -0.25f, 1.5f},
+                      {-1e31f, -1.5f, -0.3f, -0.0f, 0.0f, 0.25f, 1.0f, 1.5f, 1e31f});
+  check_bounds<double>({1.5, -1.5, 0.0, 1e300, -1e300, 0.25, -0.25, 1e-300, -1e-300},
+                       {-1e301, -1.5, -1e-300, 0.0, 1e-300, 0.25, 1.5, 1e301});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, StringKeys) {
+  using namespace std::string_literals;  // NOLINT
+  const auto values = std::vector<std::string>{"b", "", "a", "ab", "a\0b"s, "abc", "\xff", "a", "ba", "abd", "b"};
+  check_bounds<std::string>(values,
+                            {"", "a", "a\0"s, "a\0c"s, "aa", "ab", "abc", "abcd", "b", "c", "\xff", "\xff\xff"});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, NodeSizes) {
+  // Varying the lowest byte of the keys creates inner nodes with 3, 10, 40, and 250 children, i.e., all node types.
+  for (const auto distinct_value_count : {3, 10, 40, 250}) {
+    auto values = std::vector<int32_t>{};
+    for (auto index = int32_t{0}; index < 500; ++index) {
+      values.push_back((index * 7) % distinct_value_count);
+    }
+    check_bounds<int32_t>(values, {-1, 0, 1, 2, distinct_value_count / 2, distinct_value_count - 1, 1000});
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, DictionarySegment) {
+  const auto values = std::vector<std::string>{"uuid-3", "uuid-1", "uuid-4", "uuid-1", "uuid-5"};
+  const auto segment = std::make_shared<DictionarySegment<std::string>>(create_segment(values));
+  check_bounds<std::string>(values, {"uuid-0", "uuid-1", "uuid-2", "uuid-5", "uuid-6"}, segment);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, SearchValueOfDifferentType) {
+  const auto segment = create_segment<int64_t>({5, 1, 3});
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+
+  // The search value is converted to the data type of the segment before it is encoded.
+  EXPECT_EQ(index.point_lookup({int32_t{3}}, ChunkID{0}), (PosList{RowID{ChunkID{0}, 2}}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, MultiColumnLookups) {
+  const auto int_segment = create_segment<int32_t>({2, 1, 2, 1, 2, 3});
+  const auto string_segment = create_segment<std::string>({"b", "z", "a", "z", "b", "a"});
+  const auto index = AdaptiveRadixTreeIndex{{int_segment, string_segment}};
+
+  const auto chunk_id = ChunkID{4};
+  EXPECT_EQ(index.point_lookup({2, "b"}, chunk_id), (PosList{RowID{chunk_id, 0}, RowID{chunk_id, 4}}));
+  EXPECT_EQ(index.point_lookup({1, "z"}, chunk_id), (PosList{RowID{chunk_id, 1}, RowID{chunk_id, 3}}));
+  EXPECT_TRUE(index.point_lookup({1, "a"}, chunk_id).empty());
+
+  // Lookups with fewer values than indexed segments match on the leading segments.
+  EXPECT_EQ(index.point_lookup({2}, chunk_id),
+            (PosList{RowID{chunk_id, 0}, RowID{chunk_id, 2}, RowID{chunk_id, 4}}));
+
+  EXPECT_EQ(index.range_lookup({1, "zz"}, {2, "a"}, chunk_id), (PosList{RowID{chunk_id, 2}}));
+  EXPECT_EQ(index.range_lookup({2}, {3}, chunk_id),
+            (PosList{RowID{chunk_id, 0}, RowID{chunk_id, 2}, RowID{chunk_id, 4}, RowID{chunk_id, 5}}));
+  EXPECT_TRUE(index.range_lookup({3}, {2}, chunk_id).empty());
+
+  EXPECT_TRUE(index.is_index_for({int_segment, string_segment}));
+  EXPECT_FALSE(index.is_index_for({int_segment}));
+  EXPECT_EQ(index.type(), SegmentIndexType::AdaptiveRadixTree);
+  EXPECT_GT(index.estimate_memory_usage(), 0u);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, EmptySegment) {
+  const auto index = AdaptiveRadixTreeIndex{{std::make_shared<ValueSegment<int32_t>>()}};
+  EXPECT_EQ(index.lower_bound({1}), index.cend());
+  EXPECT_EQ(index.upper_bound({1}), index.cend());
+  EXPECT_TRUE(index.point_lookup({1}, ChunkID{0}).empty());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, SegmentsOfDifferentSizes) {
+  const auto segment_1 = create_segment<int32_t>({1, 2});
+  const auto segment_2 = create_segment<int32_t>({1});
+  EXPECT_THROW(AdaptiveRadixTreeIndex({segment_1, segment_2}), std::logic_error);
+}
+
+}  // namespace opossum
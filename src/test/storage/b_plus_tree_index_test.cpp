@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/b_plus_tree_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageBPlusTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+
+    // Enough rows to split the root more than once. Values are inserted out of order and with duplicates.
+    for (auto index = int32_t{0}; index < 5000; ++index) {
+      append((index * 7919) % 1000);
+    }
+  }
+
+  void append(const int32_t value) {
+    table->append({value, std::to_string(value)});
+    values.push_back(value);
+  }
+
+  // Returns the RowIDs of all rows whose value satisfies the predicate, computed without the index.
+  PosList expected_pos_list(const std::function<bool(int32_t)>& predicate) const {
+    auto pos_list = PosList{};
+    const auto target_chunk_size = table->target_chunk_size();
+    for (auto row = size_t{0}; row < values.size(); ++row) {
+      if (!predicate(values[row])) continue;
+      pos_list.push_back(RowID{ChunkID{static_cast<uint32_t>(row / target_chunk_size)},
+                               static_cast<ChunkOffset>(row % target_chunk_size)});
+    }
+    return pos_list;
+  }
+
+  std::shared_ptr<Table> table;
+  std::vector<int32_t> values;
+};
+
+TEST_F(StorageBPlusTreeIndexTest, Lookups) {
+  const auto index = BPlusTreeIndex<int32_t>{*table, ColumnID{0}};
+  EXPECT_EQ(index.size(), 5000u);
+  EXPECT_GT(index.height(), 2u);
+  EXPECT_EQ(index.column_id(), ColumnID{0});
+
+  for (const auto search_value : {-1, 0, 1, 500, 999, 1000}) {
+    EXPECT_EQ(index.lookup(ScanType::OpEquals, search_value),
+              expected_pos_list([&](const auto value) { return value == search_value; }));
+    EXPECT_EQ(index.lookup(ScanType::OpNotEquals, search_value),
+              expected_pos_list([&](const auto value) { return value != search_value; }));
+    EXPECT_EQ(index.lookup(ScanType::OpLessThan, search_value),
+              expected_pos_list([&](const auto value) { return value < search_value; }));
+    EXPECT_EQ(index.lookup(ScanType::OpLessThanEquals, search_value),
+              expected_pos_list([&](const auto value) { return value <= search_value; }));
+    EXPECT_EQ(index.lookup(ScanType::OpGreaterThan, search_value),
+              expected_pos_list([&](const auto value) { return value > search_value; }));
+    EXPECT_EQ(index.lookup(ScanType::OpGreaterThanEquals, search_value),
+              expected_pos_list([&](const auto value) { return value >= search_value; }));
+  }
+
+  EXPECT_EQ(index.range_lookup(100, 110),
+            expected_pos_list([&](const auto value) { return value >= 100 && value <= 110; }));
+  EXPECT_TRUE(index.range_lookup(110, 100).empty());
+  EXPECT_GT(index.estimate_memory_usage(), 5000 * sizeof(RowID));
+}
+
+TEST_F(StorageBPlusTreeIndexTest, StringLookups) {
+  const auto index = BPlusTreeIndex<std::string>{*table, ColumnID{1}};
+  EXPECT_EQ(index.lookup(ScanType::OpEquals, "42"), expected_pos_list([&](const auto value) { return value == 42; }));
+  EXPECT_EQ(index.lookup(ScanType::OpLessThan, "11"),
+            expected_pos_list([&](const auto value) { return std::to_string(value) < "11"; }));
+}
+
+TEST_F(StorageBPlusTreeIndexTest, EmptyTable) {
+  auto empty_table = Table{};
+  empty_table.add_column("a", "int");
+  const auto index = BPlusTreeIndex<int32_t>{empty_table, ColumnID{0}};
+  EXPECT_EQ(index.size(), 0u);
+  EXPECT_EQ(index.height(), 1u);
+  EXPECT_TRUE(index.lookup(ScanType::OpEquals, 1).empty());
+  EXPECT_TRUE(index.lookup(ScanType::OpNotEquals, 1).empty());
+}
+
+TEST_F(StorageBPlusTreeIndexTest, MaintainedByTable) {
+  table->add_index(std::make_shared<BPlusTreeIndex<int32_t>>(*table, ColumnID{0}));
+  EXPECT_THROW(table->add_index(std::make_shared<BPlusTreeIndex<int32_t>>(*table, ColumnID{0})), std::logic_error);
+
+  // Appended rows are inserted into the index, compression keeps all RowIDs valid.
+  for (auto value = int32_t{2000}; value < 2150; ++value) {
+    append(value % 2 == 0 ? value : 7);
+  }
+  table->compress_chunk(ChunkID{3});
+  table->compress_chunk(ChunkID{50});
+
+  const auto index = table->get_index(ColumnID{0});
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index->size(), values.size());
+  EXPECT_EQ(index->lookup(ScanType::OpEquals, 7), expected_pos_list([&](const auto value) { return value == 7; }));
+  EXPECT_EQ(index->lookup(ScanType::OpGreaterThan, 2100),
+            expected_pos_list([&](const auto value) { return value > 2100; }));
+
+  // Emplaced chunks are inserted as well.
+  auto chunk = std::make_shared<Chunk>();
+  auto int_segment = std::make_shared<ValueSegment<int32_t>>();
+  auto string_segment = std::make_shared<ValueSegment<std::string>>();
+  int_segment->append(123456);
+  string_segment->append("123456");
+  chunk->add_segment(int_segment);
+  chunk->add_segment(string_segment);
+  table->emplace_chunk(chunk);
+  EXPECT_EQ(index->lookup(ScanType::OpEquals, 123456), (PosList{RowID{ChunkID{52}, 0}}));
+
+  EXPECT_FALSE(table->get_index(ColumnID{1}));
+  table->drop_index(ColumnID{0});
+  EXPECT_FALSE(table->get_index(ColumnID{0}));
+}
+
+}  // namespace opossum
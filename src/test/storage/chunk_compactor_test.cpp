@@ -0,0 +1,205 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/chunk_compactor.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageChunkCompactorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string", true);
+    for (auto value = int32_t{0}; value < 10; ++value) {
+      _table->append({value, value % 2 == 0 ? AllTypeVariant{"even"} : NULL_VALUE});
+    }
+    StorageManager::get().add_table("table", _table);
+  }
+
+  std::shared_ptr<const Table> validate(const std::shared_ptr<TransactionContext>& context) {
+    return get_validated_table("table", context)->get_output();
+  }
+
+  // Deletes the rows with a < value in a committed transaction.
+  void delete_rows_less_than(const int32_t value) {
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto table_scan =
+        std::make_shared<TableScan>(get_validated_table("table", context), ColumnID{0}, ScanType::OpLessThan, value);
+    table_scan->execute();
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+    context->commit();
+  }
+
+  std::shared_ptr<Table> expected_table(const int32_t begin_value) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "string", true);
+    for (auto value = begin_value; value < 10; ++value) {
+      table->append({value, value % 2 == 0 ? AllTypeVariant{"even"} : NULL_VALUE});
+    }
+    return table;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageChunkCompactorTest, ShouldCompact) {
+  delete_rows_less_than(3);
+  const auto compactor = ChunkCompactor{0.5f};
+  EXPECT_TRUE(compactor.should_compact(*_table->get_chunk(ChunkID{0})));
+  EXPECT_FALSE(ChunkCompactor{1.0f}.should_compact(*_table->get_chunk(ChunkID{0})));
+  EXPECT_FALSE(compactor.should_compact(*_table->get_chunk(ChunkID{1})));
+
+  // The last chunk is not full yet.
+  delete_rows_less_than(10);
+  EXPECT_TRUE(compactor.should_compact(*_table->get_chunk(ChunkID{1})));
+  EXPECT_FALSE(compactor.should_compact(*_table->get_chunk(ChunkID{2})));
+
+  EXPECT_THROW(ChunkCompactor{0.0f}, std::logic_error);
+}
+
+TEST_F(StorageChunkCompactorTest, CompactsAndRetiresChunks) {
+  const auto old_context = TransactionManager::get().new_transaction_context();
+  delete_rows_less_than(3);
+
+  ChunkCompactor{}.run();
+  // Row 3 moved to a new, compressed chunk at the end of the table.
+  ASSERT_EQ(_table->chunk_count(), 4u);
+  const auto compacted_chunk = _table->get_chunk(ChunkID{3});
+  EXPECT_EQ(compacted_chunk->size(), 1u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(compacted_chunk->get_segment(ColumnID{0})));
+  EXPECT_NE(_table->get_chunk(ChunkID{0})->cleanup_commit_id(), MAX_COMMIT_ID);
+  EXPECT_EQ(_table->approx_valid_row_count(), 7u);
+
+  // The old transaction still reads the old chunk, so it cannot be retired yet.
+  EXPECT_TABLE_EQ(validate(old_context), expected_table(0));
+  EXPECT_TABLE_EQ(validate(TransactionManager::get().new_transaction_context()), expected_table(3));
+  EXPECT_EQ(ChunkCompactor::retire_compacted_chunks(*_table), 0u);
+  EXPECT_EQ(_table->row_count(), 11u);
+
+  const auto memory_usage = _table->memory_usage();
+  old_context->commit();
+  ChunkCompactor{}.run();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(_table->row_count(), 7u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 7u);
+  EXPECT_LT(_table->memory_usage(), memory_usage);
+  EXPECT_TABLE_EQ(validate(TransactionManager::get().new_transaction_context()), expected_table(3));
+
+  // The previous last chunk was sealed, so it can be compressed. Appends continue in a new chunk.
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->mvcc_data()->capacity(), 2u);
+  _table->compress_chunk(ChunkID{2});
+  _table->append({10, NULL_VALUE});
+  EXPECT_EQ(_table->chunk_count(), 5u);
+}
+
+TEST_F(StorageChunkCompactorTest, RetiresChunksOnceNoSnapshotCanReadThem) {
+  // The output of a running transaction references the rows of the chunk that is compacted.
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto output = validate(context);
+  delete_rows_less_than(3);
+
+  ChunkCompactor{}.run();
+  ChunkCompactor{}.run();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 4u);
+  EXPECT_TABLE_EQ(output, expected_table(0));
+
+  // A transaction that started right after the compaction has a snapshot at its commit id.
+  const auto later_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(later_context->snapshot_commit_id(), _table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  context->commit();
+  EXPECT_EQ(ChunkCompactor::retire_compacted_chunks(*_table), 0u);
+
+  later_context->commit();
+  EXPECT_EQ(ChunkCompactor::retire_compacted_chunks(*_table), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(ChunkCompactor::retire_compacted_chunks(*_table), 0u);
+}
+
+TEST_F(StorageChunkCompactorTest, SkipsChunksInUse) {
+  delete_rows_less_than(3);
+
+  // A running transaction locked row 3 for deletion.
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto expected = INVALID_TRANSACTION_ID;
+  const auto& mvcc_data = _table->get_chunk(ChunkID{0})->mvcc_data();
+  ASSERT_TRUE(mvcc_data->compare_exchange_tid(3, expected, context->transaction_id()));
+  context->register_delete(_table, RowID{ChunkID{0}, 3});
+
+  const auto compactor = ChunkCompactor{};
+  EXPECT_FALSE(compactor.compact_chunk(_table, ChunkID{0}));
+  EXPECT_EQ(_table->chunk_count(), 3u);
+  EXPECT_EQ(mvcc_data->tid(3), context->transaction_id());
+
+  context->rollback();
+  EXPECT_TRUE(compactor.compact_chunk(_table, ChunkID{0}));
+  EXPECT_FALSE(compactor.compact_chunk(_table, ChunkID{0}));
+  EXPECT_TABLE_EQ(validate(TransactionManager::get().new_transaction_context()), expected_table(3));
+}
+
+TEST_F(StorageChunkCompactorTest, KeepsRowsOfCommittingTransactions) {
+  // A running transaction fills the last chunk, whose other rows are deleted afterwards.
+  const auto insert_context = TransactionManager::get().new_transaction_context();
+  for (const auto value : {10, 11}) {
+    insert_context->register_insert(_table, _table->append({value, NULL_VALUE}, insert_context->transaction_id()));
+  }
+  delete_rows_less_than(10);
+  const auto compactor = ChunkCompactor{};
+  ASSERT_TRUE(compactor.should_compact(*_table->get_chunk(ChunkID{2})));
+  EXPECT_FALSE(compactor.compact_chunk(_table, ChunkID{2}));
+
+  // While committing, the transaction sets the begin commit ids of its rows before it publishes the commit id, so the
+  // rows are not visible to new transactions yet.
+  const auto& mvcc_data = _table->get_chunk(ChunkID{2})->mvcc_data();
+  const auto commit_id = TransactionManager::get().last_commit_id() + 1;
+  for (const auto chunk_offset : {ChunkOffset{2}, ChunkOffset{3}}) {
+    mvcc_data->set_begin_cid(chunk_offset, commit_id);
+    mvcc_data->set_tid(chunk_offset, INVALID_TRANSACTION_ID);
+  }
+  EXPECT_FALSE(compactor.compact_chunk(_table, ChunkID{2}));
+
+  insert_context->commit();
+  EXPECT_EQ(insert_context->commit_id(), commit_id);
+  EXPECT_TRUE(compactor.compact_chunk(_table, ChunkID{2}));
+
+  auto expected_table = std::make_shared<Table>();
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "string", true);
+  expected_table->append({10, NULL_VALUE});
+  expected_table->append({11, NULL_VALUE});
+  EXPECT_TABLE_EQ(validate(TransactionManager::get().new_transaction_context()), expected_table);
+}
+
+TEST_F(StorageChunkCompactorTest, RunsAsLowPriorityTasks) {
+  delete_rows_less_than(8);
+  CurrentScheduler::set(std::make_shared<Scheduler>(2));
+
+  const auto tasks = ChunkCompactor{}.create_tasks();
+  // One task releases chunks, the other two compact the full chunks.
+  ASSERT_EQ(tasks.size(), 3u);
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->priority(), SchedulePriority::Low);
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_TABLE_EQ(validate(TransactionManager::get().new_transaction_context()), expected_table(8));
+  EXPECT_EQ(_table->approx_valid_row_count(), 2u);
+}
+
+}  // namespace opossum
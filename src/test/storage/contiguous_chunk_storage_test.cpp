@@ -0,0 +1,168 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/contiguous_chunk_storage.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageContiguousChunkStorageTest : public BaseTest {
+ protected:
+  std::shared_ptr<Table> create_table(const ChunkLayout chunk_layout) {
+    auto table = std::make_shared<Table>(100);
+    table->set_chunk_layout(chunk_layout);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "long", true);
+    table->add_column("d", "double");
+    for (auto row = int32_t{0}; row < 150; ++row) {
+      table->append({row, std::to_string(row % 10), row % 3 == 0 ? NULL_VALUE : AllTypeVariant{int64_t{row} * 2},
+                     row / 4.0});
+    }
+    return table;
+  }
+
+  // Returns whether the array lies in the storage and is listed in its directory for the given column.
+  template <typename Vector>
+  static bool is_stored(const ContiguousChunkStorage& storage, const ColumnID column_id, const Vector& vector) {
+    const auto offset = static_cast<size_t>(reinterpret_cast<const std::byte*>(vector.data()) - storage.data());
+    const auto& directory = storage.directory();
+    return std::any_of(directory.cbegin(), directory.cend(), [&](const auto& entry) {
+      return entry.column_id == column_id && entry.offset == offset && entry.size >= vector.size() * sizeof(vector[0]);
+    });
+  }
+};
+
+TEST_F(StorageContiguousChunkStorageTest, StoresUnencodedSegments) {
+  const auto table = create_table(ChunkLayout::Contiguous);
+  EXPECT_EQ(table->chunk_layout(), ChunkLayout::Contiguous);
+  table->compress_chunk(ChunkID{0}, EncodingType::Unencoded);
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto& storage = chunk->contiguous_storage();
+  ASSERT_TRUE(storage);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(storage->data()) % ContiguousChunkStorage::CACHE_LINE_SIZE, 0u);
+
+  // The values of the int, long, and double columns and the NULL bitmap of the long column. The string column keeps
+  // its own allocation.
+  const auto& directory = storage->directory();
+  ASSERT_EQ(directory.size(), 4u);
+  EXPECT_EQ(directory[0].column_id, ColumnID{0});
+  EXPECT_EQ(directory[0].size, 100 * sizeof(int32_t));
+  EXPECT_EQ(directory[1].column_id, ColumnID{2});
+  EXPECT_EQ(directory[2].column_id, ColumnID{2});
+  EXPECT_EQ(directory[2].size, 2 * sizeof(uint64_t));
+  EXPECT_EQ(directory[3].column_id, ColumnID{3});
+
+  const auto int_segment = std::static_pointer_cast<ValueSegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{0}, int_segment->values()));
+  const auto long_segment = std::static_pointer_cast<ValueSegment<int64_t>>(chunk->get_segment(ColumnID{2}));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{2}, long_segment->values()));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{2}, long_segment->null_bitmap()->words()));
+
+  for (const auto& entry : directory) {
+    EXPECT_EQ(entry.offset % ContiguousChunkStorage::CACHE_LINE_SIZE, 0u);
+  }
+  EXPECT_EQ(storage->size(), directory.back().offset + directory.back().size);
+  EXPECT_EQ(storage->size(), storage->capacity());
+
+  // The remaining, partially filled chunk is not compressed.
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->contiguous_storage());
+}
+
+TEST_F(StorageContiguousChunkStorageTest, StoresEncodedSegments) {
+  const auto table = create_table(ChunkLayout::Contiguous);
+  table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  auto chunk = table->get_chunk(ChunkID{0});
+  auto storage = chunk->contiguous_storage();
+  ASSERT_TRUE(storage);
+
+  // Both the attribute vectors and the numeric dictionaries are stored, even those of string columns.
+  for (auto column_id = ColumnID{0}; column_id < 4; ++column_id) {
+    const auto segment = chunk->get_segment(column_id);
+    resolve_segment_data_type(*segment, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      const auto& dictionary_segment = static_cast<const DictionarySegment<Type>&>(*segment);
+      resolve_attribute_vector(*dictionary_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        EXPECT_TRUE(is_stored(*storage, column_id, attribute_vector.values()));
+      });
+      if constexpr (!std::is_same_v<Type, std::string>) {
+        EXPECT_TRUE(is_stored(*storage, column_id, dictionary_segment.dictionary()));
+      }
+    });
+  }
+
+
+  // Frame-of-reference encoding only supports int and long columns.
+  auto integer_table = Table{100};
+  integer_table.set_chunk_layout(ChunkLayout::Contiguous);
+  integer_table.add_column("a", "long", true);
+  for (auto row = int32_t{0}; row < 100; ++row) {
+    integer_table.append({row % 3 == 0 ? NULL_VALUE : AllTypeVariant{int64_t{row} * 2}});
+  }
+  integer_table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  chunk = integer_table.get_chunk(ChunkID{0});
+  storage = chunk->contiguous_storage();
+  ASSERT_TRUE(storage);
+  const auto& frame_of_reference_segment =
+      static_cast<const FrameOfReferenceSegment<int64_t>&>(*chunk->get_segment(ColumnID{0}));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{0}, frame_of_reference_segment.block_minima()));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{0}, frame_of_reference_segment.null_bitmap()->words()));
+  EXPECT_EQ(storage->directory().size(), 3u);
+}
+
+TEST_F(StorageContiguousChunkStorageTest, StoresRunLengthSegments) {
+  const auto table = create_table(ChunkLayout::Contiguous);
+  table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto& storage = chunk->contiguous_storage();
+  ASSERT_TRUE(storage);
+
+  const auto& long_segment = static_cast<const RunLengthSegment<int64_t>&>(*chunk->get_segment(ColumnID{2}));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{2}, long_segment.values()));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{2}, long_segment.end_positions()));
+  // The values of string columns keep their own allocations, but their end positions are stored.
+  const auto& string_segment = static_cast<const RunLengthSegment<std::string>&>(*chunk->get_segment(ColumnID{1}));
+  EXPECT_FALSE(is_stored(*storage, ColumnID{1}, string_segment.values()));
+  EXPECT_TRUE(is_stored(*storage, ColumnID{1}, string_segment.end_positions()));
+}
+
+TEST_F(StorageContiguousChunkStorageTest, HoldsTheSameRows) {
+  for (const auto encoding_type :
+       {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength, EncodingType::Automatic}) {
+    const auto segmented_table = create_table(ChunkLayout::Segmented);
+    const auto contiguous_table = create_table(ChunkLayout::Contiguous);
+    for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+      segmented_table->compress_chunk(chunk_id, encoding_type);
+      contiguous_table->compress_chunk(chunk_id, encoding_type);
+    }
+    EXPECT_FALSE(segmented_table->get_chunk(ChunkID{0})->contiguous_storage());
+    EXPECT_TRUE(contiguous_table->get_chunk(ChunkID{0})->contiguous_storage());
+    EXPECT_TABLE_EQ(contiguous_table, segmented_table, true);
+
+    auto scans = std::vector<std::shared_ptr<TableScan>>{};
+    for (const auto& table : {segmented_table, contiguous_table}) {
+      const auto table_wrapper = std::make_shared<TableWrapper>(table);
+      table_wrapper->execute();
+      const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, int64_t{200});
+      scan->execute();
+      scans.push_back(scan);
+    }
+    EXPECT_EQ(scans[1]->get_output()->row_count(), 33u);
+    EXPECT_TABLE_EQ(scans[1]->get_output(), scans[0]->get_output(), true);
+  }
+}
+
+}  // namespace opossum
@@ -157,4 +157,20 @@ INSTANTIATE_TEST_SUITE_P(EstimateMemoryUsage, StorageDictionarySegmentAdaptiveAt
                                            std::make_tuple(std::pow(2, 16), 524288),      // uint32_t
                                            std::make_tuple(std::pow(2, 19), 4194304)));   // uint32_t
 
+TEST_F(StorageDictionarySegmentTest, CompressNullableSegment) {
+  const auto nullable_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (const auto& value : {AllTypeVariant{7}, NULL_VALUE, AllTypeVariant{3}, NULL_VALUE, AllTypeVariant{7}}) {
+    nullable_segment->append(value);
+  }
+
+  const auto dictionary_segment = DictionarySegment<int32_t>{nullable_segment};
+  EXPECT_TRUE(dictionary_segment.is_nullable());
+  // NULL is not part of the dictionary, the value id after the dictionary stands for it.
+  EXPECT_EQ(dictionary_segment.unique_values_count(), 2u);
+  EXPECT_EQ(dictionary_segment.null_value_id(), ValueID{2});
+  EXPECT_EQ(dictionary_segment.attribute_vector()->get(1), ValueID{2});
+  EXPECT_TRUE(variant_is_null(dictionary_segment[3]));
+  EXPECT_EQ(dictionary_segment[4], AllTypeVariant{7});
+}
+
 }  // namespace opossum
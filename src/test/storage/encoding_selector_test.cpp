@@ -0,0 +1,91 @@
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "storage/encoding_selector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageEncodingSelectorTest : public BaseTest {
+ protected:
+  static constexpr auto ROW_COUNT = int32_t{100'000};
+  EncodingSelector selector;
+};
+
+TEST_F(StorageEncodingSelectorTest, LongRunsUseRunLength) {
+  auto segment = ValueSegment<int32_t>{};
+  for (auto index = int32_t{0}; index < ROW_COUNT; ++index) {
+    segment.append(index / 5000);
+  }
+  EXPECT_EQ(selector.select("int", segment), EncodingType::RunLength);
+}
+
+TEST_F(StorageEncodingSelectorTest, IncreasingKeysUseFrameOfReference) {
+  auto segment = ValueSegment<int64_t>{};
+  for (auto index = int64_t{0}; index < ROW_COUNT; ++index) {
+    segment.append(int64_t{1'600'000'000'000} + 7 * index);
+  }
+  EXPECT_EQ(selector.select("long", segment), EncodingType::FrameOfReference);
+}
+
+TEST_F(StorageEncodingSelectorTest, ExtremeValuesDoNotUseFrameOfReference) {
+  auto int_segment = ValueSegment<int32_t>{};
+  auto long_segment = ValueSegment<int64_t>{};
+  for (auto index = int32_t{0}; index < ROW_COUNT; ++index) {
+    int_segment.append(index % 2 == 0 ? std::numeric_limits<int32_t>::min() : std::numeric_limits<int32_t>::max());
+    long_segment.append(index % 2 == 0 ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max());
+  }
+
+  // The range spans all values of the type, so the offsets would be as wide as the values themselves.
+  const auto int_costs = selector.estimate_costs("int", int_segment);
+  EXPECT_GT(int_costs.at(EncodingType::FrameOfReference), int_costs.at(EncodingType::Dictionary));
+  EXPECT_NE(selector.select("int", int_segment), EncodingType::FrameOfReference);
+  EXPECT_NE(selector.select("long", long_segment), EncodingType::FrameOfReference);
+}
+
+TEST_F(StorageEncodingSelectorTest, FewDistinctStringsUseDictionary) {
+  auto segment = ValueSegment<std::string>{};
+  for (auto index = int32_t{0}; index < ROW_COUNT; ++index) {
+    segment.append("country_" + std::to_string(index * 7 % 50));
+  }
+  EXPECT_EQ(selector.select("string", segment), EncodingType::Dictionary);
+}
+
+TEST_F(StorageEncodingSelectorTest, UniqueValuesStayUnencoded) {
+  auto segment = ValueSegment<double>{};
+  for (auto index = int32_t{0}; index < ROW_COUNT; ++index) {
+    segment.append(static_cast<double>(index * 7919 % ROW_COUNT) / 3.0);
+  }
+  const auto costs = selector.estimate_costs("double", segment);
+  EXPECT_EQ(costs.count(EncodingType::FrameOfReference), 0u);
+  EXPECT_EQ(selector.select("double", segment), EncodingType::Unencoded);
+}
+
+TEST_F(StorageEncodingSelectorTest, CompressChunkRecordsEncodings) {
+  auto table = Table{1000};
+  table.add_column("id", "int");
+  table.add_column("category", "string");
+  table.add_column("price", "float");
+  for (auto index = int32_t{0}; index < 1000; ++index) {
+    table.append({index, std::string{index < 500 ? "a" : "b"}, static_cast<float>(index * 7919 % 1000) / 3.0f});
+  }
+
+  table.compress_chunk(ChunkID{0}, EncodingType::Automatic);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk->encoding_types(), (std::vector<EncodingType>{EncodingType::FrameOfReference,
+                                                                 EncodingType::RunLength, EncodingType::Unencoded}));
+  EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[999], AllTypeVariant{999});
+  EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[600], AllTypeVariant{"b"});
+
+  // Explicitly chosen encodings are recorded as well.
+  table.append({1000, std::string{"c"}, 1.0f});
+  table.compress_chunk(ChunkID{1});
+  EXPECT_EQ(table.get_chunk(ChunkID{1})->encoding_types(), (std::vector<EncodingType>(3, EncodingType::Dictionary)));
+}
+
+}  // namespace opossum
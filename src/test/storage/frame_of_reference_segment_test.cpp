@@ -0,0 +1,98 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three blocks of increasing timestamps with small gaps.
+    for (auto index = int64_t{0}; index < 3 * BLOCK_SIZE - 100; ++index) {
+      value_segment_long->append(int64_t{1'600'000'000'000} + 3 * index + index % 2);
+    }
+  }
+
+  static constexpr auto BLOCK_SIZE = int64_t{FrameOfReferenceSegment<int64_t>::BLOCK_SIZE};
+  std::shared_ptr<ValueSegment<int64_t>> value_segment_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentLong) {
+  const auto segment = FrameOfReferenceSegment<int64_t>{value_segment_long};
+
+  EXPECT_EQ(segment.size(), value_segment_long->size());
+  ASSERT_EQ(segment.block_minima().size(), 3u);
+  EXPECT_EQ(segment.block_minima()[0], int64_t{1'600'000'000'000});
+  EXPECT_EQ(segment.block_minima()[1], int64_t{1'600'000'000'000} + 3 * BLOCK_SIZE);
+
+  // The largest offset within a block is 3 * (BLOCK_SIZE - 1) + 1 = 6142, which needs 13 bits.
+  EXPECT_EQ(segment.offset_bit_width(), 13u);
+  EXPECT_EQ(segment.max_offset(), 8191u);
+  EXPECT_LT(segment.estimate_memory_usage(), value_segment_long->estimate_memory_usage() / 4);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, AccessAndDecompress) {
+  const auto segment = FrameOfReferenceSegment<int64_t>{value_segment_long};
+  const auto& values = value_segment_long->values();
+
+  for (auto offset = ChunkOffset{0}; offset < segment.size(); ++offset) {
+    ASSERT_EQ(segment.get(offset), values[offset]);
+  }
+  EXPECT_EQ(type_cast<int64_t>(segment[ChunkOffset{4000}]), values[4000]);
+  EXPECT_EQ(segment.decompress(), std::vector<int64_t>(values.cbegin(), values.cend()));
+
+  auto partial = std::vector<int64_t>(3000);
+  segment.decompress(ChunkOffset{1000}, ChunkOffset{4000}, partial.data());
+  EXPECT_TRUE(std::equal(partial.cbegin(), partial.cend(), values.cbegin() + 1000));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ExtremeValues) {
+  auto value_segment_int = std::make_shared<ValueSegment<int32_t>>();
+  for (const auto value : {std::numeric_limits<int32_t>::max(), -5, std::numeric_limits<int32_t>::min(), 0}) {
+    value_segment_int->append(value);
+  }
+  const auto int_segment = FrameOfReferenceSegment<int32_t>{value_segment_int};
+  EXPECT_EQ(int_segment.offset_bit_width(), 32u);
+  const auto& values = value_segment_int->values();
+  EXPECT_EQ(int_segment.decompress(), std::vector<int32_t>(values.cbegin(), values.cend()));
+
+  auto value_segment_constant = std::make_shared<ValueSegment<int64_t>>();
+  for (auto index = 0; index < 100; ++index) {
+    value_segment_constant->append(int64_t{-42});
+  }
+  const auto constant_segment = FrameOfReferenceSegment<int64_t>{value_segment_constant};
+  EXPECT_EQ(constant_segment.offset_bit_width(), 0u);
+  EXPECT_EQ(constant_segment.get(ChunkOffset{99}), -42);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Immutable) {
+  auto segment = FrameOfReferenceSegment<int64_t>{value_segment_long};
+  EXPECT_THROW(segment.append(int64_t{3}), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressChunkWithFrameOfReferenceEncoding) {
+  auto table = Table{10};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.append({1, "x"});
+  table.append({2, "y"});
+
+  auto int_table = Table{10};
+  int_table.add_column("a", "int");
+  int_table.append({1});
+  int_table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const FrameOfReferenceSegment<int32_t>>(
+      int_table.get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+
+  // Strings cannot be encoded with frame-of-reference.
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference), std::logic_error);
+}
+
+}  // namespace opossum
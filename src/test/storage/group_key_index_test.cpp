@@ -0,0 +1,99 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_segment = std::make_shared<ValueSegment<std::string>>();
+    for (const auto* value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      value_segment->append(value);
+    }
+    dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+    index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{dictionary_segment});
+  }
+
+  std::vector<ChunkOffset> offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<DictionarySegment<std::string>> dictionary_segment;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, OrdersOffsetsByValue) {
+  // Dictionary: apple, charlie, delta, frank, hotel, inbox. Offsets of the same value are in ascending order.
+  EXPECT_EQ(offsets(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+  EXPECT_EQ(index->type(), SegmentIndexType::GroupKey);
+}
+
+TEST_F(StorageGroupKeyIndexTest, PointLookup) {
+  EXPECT_EQ(offsets(index->lower_bound({"delta"}), index->upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(offsets(index->lower_bound({"hotel"}), index->upper_bound({"hotel"})), (std::vector<ChunkOffset>{0}));
+
+  // Values that are not in the dictionary result in empty ranges.
+  EXPECT_EQ(index->lower_bound({"echo"}), index->upper_bound({"echo"}));
+  EXPECT_EQ(index->lower_bound({"zulu"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"aaa"}), index->cbegin());
+}
+
+TEST_F(StorageGroupKeyIndexTest, RangeLookup) {
+  EXPECT_EQ(offsets(index->lower_bound({"charlie"}), index->upper_bound({"echo"})),
+            (std::vector<ChunkOffset>{5, 6, 1, 3}));
+  EXPECT_EQ(offsets(index->upper_bound({"frank"}), index->cend()), (std::vector<ChunkOffset>{0, 7}));
+  EXPECT_EQ(offsets(index->cbegin(), index->lower_bound({"b"})), (std::vector<ChunkOffset>{4}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, SkipsNullValues) {
+  auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+  for (const auto& value : {AllTypeVariant{"delta"}, NULL_VALUE, AllTypeVariant{"apple"}, NULL_VALUE}) {
+    value_segment->append(value);
+  }
+  const auto nullable_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+  const auto nullable_index = GroupKeyIndex{std::vector<std::shared_ptr<const AbstractSegment>>{nullable_segment}};
+
+  EXPECT_EQ(offsets(nullable_index.cbegin(), nullable_index.cend()), (std::vector<ChunkOffset>{2, 0}));
+  EXPECT_EQ(offsets(nullable_index.upper_bound({"apple"}), nullable_index.cend()), (std::vector<ChunkOffset>{0}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, IsIndexForSegment) {
+  EXPECT_TRUE(index->is_index_for({dictionary_segment}));
+  EXPECT_FALSE(index->is_index_for({}));
+  EXPECT_FALSE(index->is_index_for({dictionary_segment, dictionary_segment}));
+  EXPECT_GT(index->estimate_memory_usage(), 0u);
+}
+
+TEST_F(StorageGroupKeyIndexTest, RequiresSingleDictionarySegment) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  value_segment->append(1);
+  EXPECT_THROW(GroupKeyIndex({value_segment}), std::logic_error);
+  EXPECT_THROW(GroupKeyIndex({dictionary_segment, dictionary_segment}), std::logic_error);
+}
+
+TEST_F(StorageGroupKeyIndexTest, AttachToChunk) {
+  auto chunk = Chunk{};
+  chunk.add_segment(dictionary_segment);
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  const auto chunk_index = chunk.create_index<GroupKeyIndex>(column_ids);
+  ASSERT_EQ(chunk.get_indexes(column_ids).size(), 1u);
+  EXPECT_EQ(chunk.get_indexes(column_ids).front(), chunk_index);
+
+  const auto segments = std::vector<std::shared_ptr<const AbstractSegment>>{dictionary_segment};
+  EXPECT_EQ(chunk.get_indexes(segments).front(), chunk_index);
+
+  chunk.remove_index(chunk_index);
+  EXPECT_TRUE(chunk.indexes().empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/null_bitmap.hpp"
+
+namespace opossum {
+
+class StorageNullBitmapTest : public BaseTest {};
+
+TEST_F(StorageNullBitmapTest, PushBackAcrossWords) {
+  auto null_bitmap = NullBitmap{};
+  for (auto index = ChunkOffset{0}; index < 150; ++index) {
+    null_bitmap.push_back(index % 3 == 0);
+  }
+
+  EXPECT_EQ(null_bitmap.size(), 150u);
+  EXPECT_EQ(null_bitmap.words().size(), 3u);
+  EXPECT_EQ(null_bitmap.null_count(), 50u);
+  for (auto index = ChunkOffset{0}; index < 150; ++index) {
+    EXPECT_EQ(null_bitmap[index], index % 3 == 0) << index;
+  }
+}
+
+TEST_F(StorageNullBitmapTest, CreateWithoutNulls) {
+  const auto null_bitmap = NullBitmap{65};
+  EXPECT_EQ(null_bitmap.size(), 65u);
+  EXPECT_EQ(null_bitmap.words().size(), 2u);
+  EXPECT_EQ(null_bitmap.null_count(), 0u);
+  EXPECT_FALSE(null_bitmap[64]);
+}
+
+}  // namespace opossum
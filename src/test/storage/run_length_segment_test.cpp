@@ -0,0 +1,88 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "statistics/segment_statistics.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {4, 4, 4, 1, 1, 7, 4, 4}) {
+      value_segment_int->append(value);
+    }
+    for (const auto* value : {"Bill", "Bill", "Steve", "Alexander", "Alexander"}) {
+      value_segment_str->append(value);
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentInt) {
+  const auto segment = RunLengthSegment<int32_t>{value_segment_int};
+
+  EXPECT_EQ(segment.size(), 8u);
+  EXPECT_EQ(segment.run_count(), 4u);
+  EXPECT_EQ(segment.values(), (std::pmr::vector<int32_t>{4, 1, 7, 4}));
+  EXPECT_EQ(segment.end_positions(), (std::pmr::vector<ChunkOffset>{2, 4, 5, 7}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  const auto segment = RunLengthSegment<std::string>{value_segment_str};
+
+  EXPECT_EQ(segment.size(), 5u);
+  EXPECT_EQ(segment.values(), (std::pmr::vector<std::string>{"Bill", "Steve", "Alexander"}));
+  EXPECT_EQ(segment.end_positions(), (std::pmr::vector<ChunkOffset>{1, 2, 4}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, AccessValues) {
+  const auto segment = RunLengthSegment<int32_t>{value_segment_int};
+
+  for (auto offset = ChunkOffset{0}; offset < value_segment_int->size(); ++offset) {
+    EXPECT_EQ(segment.get(offset), value_segment_int->values()[offset]);
+    EXPECT_EQ(type_cast<int32_t>(segment[offset]), value_segment_int->values()[offset]);
+  }
+
+  EXPECT_EQ(segment.run_index(ChunkOffset{0}), 0u);
+  EXPECT_EQ(segment.run_index(ChunkOffset{2}), 0u);
+  EXPECT_EQ(segment.run_index(ChunkOffset{3}), 1u);
+  EXPECT_EQ(segment.run_index(ChunkOffset{7}), 3u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Immutable) {
+  auto segment = RunLengthSegment<int32_t>{value_segment_int};
+  EXPECT_THROW(segment.append(3), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryUsage) {
+  const auto segment = RunLengthSegment<int32_t>{value_segment_int};
+  EXPECT_EQ(segment.estimate_memory_usage(), 4 * sizeof(int32_t) + 4 * sizeof(ChunkOffset));
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressChunkWithRunLengthEncoding) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.append({1, "x"});
+  table.append({1, "x"});
+  table.append({2, "y"});
+
+  table.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->run_count(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RunLengthSegment<std::string>>(chunk->get_segment(ColumnID{1})));
+  EXPECT_EQ(chunk->statistics().at(0)->distinct_count(), 2u);
+}
+
+}  // namespace opossum
@@ -1,9 +1,11 @@
 #include <memory>
 #include <sstream>
+#include <string>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "../lib/storage/index/base_table_index.hpp"
 #include "../lib/storage/storage_manager.hpp"
 #include "../lib/storage/table.hpp"
 
@@ -65,6 +67,30 @@ TEST_F(StorageStorageManagerTest, TableNames) {
   }
 }
 
+TEST_F(StorageStorageManagerTest, CreateIndex) {
+  auto& storage_manager = StorageManager::get();
+  auto table = storage_manager.get_table("second_table");
+  table->add_column("column_1", "int");
+  table->append({4});
+  table->append({2});
+
+  storage_manager.create_index("second_table", ColumnID{0});
+  const auto index = storage_manager.get_index("second_table", ColumnID{0});
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index, table->get_index(ColumnID{0}));
+
+  table->append({2});
+  table->append({4});
+  EXPECT_EQ(index->lookup(ScanType::OpEquals, 4), (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 3}}));
+
+  EXPECT_THROW(storage_manager.create_index("second_table", ColumnID{0}), std::logic_error);
+  EXPECT_THROW(storage_manager.create_index("second_table", ColumnID{1}), std::logic_error);
+  EXPECT_THROW(storage_manager.create_index("third_table", ColumnID{0}), std::exception);
+
+  storage_manager.drop_index("second_table", ColumnID{0});
+  EXPECT_FALSE(storage_manager.get_index("second_table", ColumnID{0}));
+}
+
 TEST_F(StorageStorageManagerTest, Print) {
   auto& storage_manager = StorageManager::get();
   auto table = storage_manager.get_table("first_table");
@@ -76,9 +102,34 @@ TEST_F(StorageStorageManagerTest, Print) {
 
   std::stringstream out;
   storage_manager.print(out);
-  EXPECT_EQ(
-      out.str(),
-      "Name: second_table, #columns: 0, #rows: 0, #chunks: 1\nName: first_table, #columns: 2, #rows: 3, #chunks: 1\n");
+  EXPECT_EQ(out.str(),
+            "Name: second_table, #columns: 0, #rows: 0, #chunks: 1, memory: 0 bytes\n"
+            "Name: first_table, #columns: 2, #rows: 3, #chunks: 1, memory: 32 bytes\n"
+            "  column_1 (int): 16 bytes (Unencoded: 16 bytes)\n"
+            "  column_2 (float): 16 bytes (Unencoded: 16 bytes)\n");
+}
+
+TEST_F(StorageStorageManagerTest, PrintMemoryUsageByEncoding) {
+  auto& storage_manager = StorageManager::get();
+  auto table = storage_manager.get_table("second_table");
+  table->add_column("column_1", "int");
+  for (auto value = int32_t{0}; value < 6; ++value) {
+    table->append({value});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  storage_manager.drop_table("first_table");
+
+  const auto segment_memory_usage = [&](const ChunkID chunk_id) {
+    return table->get_chunk(chunk_id)->get_segment(ColumnID{0})->estimate_memory_usage();
+  };
+  std::stringstream out;
+  storage_manager.print(out);
+  EXPECT_EQ(out.str(), "Name: second_table, #columns: 1, #rows: 6, #chunks: 2, memory: " +
+                           std::to_string(table->memory_usage()) + " bytes\n  column_1 (int): " +
+                           std::to_string(segment_memory_usage(ChunkID{0}) + segment_memory_usage(ChunkID{1})) +
+                           " bytes (Dictionary: " + std::to_string(segment_memory_usage(ChunkID{0})) +
+                           " bytes, RunLength: " + std::to_string(segment_memory_usage(ChunkID{1})) + " bytes)\n");
 }
 
 }  // namespace opossum
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/string_dictionary.hpp"
+
+namespace opossum {
+
+class StorageStringDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Sorted, unique values with long shared prefixes, values that are prefixes of others, and the empty string.
+    for (auto index = 0; index < 100; ++index) {
+      values.push_back("customer#" + std::to_string(1000 + index * 3));
+      values.push_back("customer#" + std::to_string(1000 + index * 3) + "x");
+    }
+    values.push_back("");
+    values.push_back("c");
+    values.push_back("zebra");
+    std::sort(values.begin(), values.end());
+  }
+
+  // Checks lower_bound and upper_bound against the standard library for all values and values in between.
+  void check_bounds(const StringDictionary& dictionary) {
+    auto search_values = values;
+    for (const auto& value : values) {
+      search_values.push_back(value + "0");
+      search_values.push_back(value + "~");
+      if (!value.empty()) search_values.push_back(value.substr(0, value.size() - 1));
+    }
+    search_values.push_back("~");
+
+    for (const auto& search_value : search_values) {
+      const auto expected_lower = std::lower_bound(values.cbegin(), values.cend(), search_value) - values.cbegin();
+      const auto expected_upper = std::upper_bound(values.cbegin(), values.cend(), search_value) - values.cbegin();
+      EXPECT_EQ(dictionary.lower_bound(search_value), static_cast<size_t>(expected_lower)) << search_value;
+      EXPECT_EQ(dictionary.upper_bound(search_value), static_cast<size_t>(expected_upper)) << search_value;
+    }
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageStringDictionaryTest, AccessWithoutFrontCoding) {
+  const auto dictionary = StringDictionary{values, false};
+  EXPECT_FALSE(dictionary.is_front_coded());
+  ASSERT_EQ(dictionary.size(), values.size());
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary[index], values[index]);
+  }
+  EXPECT_EQ(dictionary.front(), "");
+  EXPECT_EQ(dictionary.back(), "zebra");
+}
+
+TEST_F(StorageStringDictionaryTest, AccessWithFrontCoding) {
+  const auto dictionary = StringDictionary{values, true};
+  EXPECT_TRUE(dictionary.is_front_coded());
+  ASSERT_EQ(dictionary.size(), values.size());
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary[index], values[index]);
+  }
+  EXPECT_EQ(dictionary.back(), "zebra");
+}
+
+TEST_F(StorageStringDictionaryTest, BoundsWithoutFrontCoding) { check_bounds(StringDictionary{values, false}); }
+
+TEST_F(StorageStringDictionaryTest, BoundsWithFrontCoding) { check_bounds(StringDictionary{values, true}); }
+
+TEST_F(StorageStringDictionaryTest, ChooseFrontCoding) {
+  const auto prefixed_dictionary = StringDictionary{values};
+  EXPECT_TRUE(prefixed_dictionary.is_front_coded());
+  EXPECT_LT(prefixed_dictionary.estimate_memory_usage(), StringDictionary(values, false).estimate_memory_usage());
+
+  const auto distinct_dictionary = StringDictionary{std::vector<std::string>{"apple", "banana", "cherry"}};
+  EXPECT_FALSE(distinct_dictionary.is_front_coded());
+  EXPECT_EQ(distinct_dictionary.estimate_memory_usage(), 17 + 4 * sizeof(uint32_t));
+}
+
+TEST_F(StorageStringDictionaryTest, EmptyDictionary) {
+  const auto dictionary = StringDictionary{std::vector<std::string>{}};
+  EXPECT_TRUE(dictionary.empty());
+  EXPECT_EQ(dictionary.lower_bound("a"), 0u);
+  EXPECT_EQ(dictionary.upper_bound("a"), 0u);
+}
+
+}  // namespace opossum
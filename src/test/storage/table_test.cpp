@@ -9,6 +9,8 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/table.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -96,4 +98,100 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_EQ(casted_int_segment->dictionary().size(), 1);
   EXPECT_EQ(casted_string_segment->dictionary().size(), 2);
 }
+
+TEST_F(StorageTableTest, AppendReturnsRowId) {
+  EXPECT_EQ(table.append({4, "Hello,"}), (RowID{ChunkID{0}, 0}));
+  EXPECT_EQ(table.append({6, "world"}), (RowID{ChunkID{0}, 1}));
+  EXPECT_EQ(table.append({3, "!"}), (RowID{ChunkID{1}, 0}));
+}
+
+TEST_F(StorageTableTest, MvccTable) {
+  EXPECT_THROW(Table(0, UseMvcc::Yes), std::logic_error);
+  EXPECT_THROW(table.append({4, "Hello,"}, TransactionID{1}), std::logic_error);
+
+  auto mvcc_table = Table{2, UseMvcc::Yes};
+  mvcc_table.add_column("col_1", "int");
+  EXPECT_TRUE(mvcc_table.uses_mvcc());
+  EXPECT_FALSE(table.uses_mvcc());
+
+  // The chunks are preallocated, so appending does not move the values.
+  const auto& values = std::static_pointer_cast<ValueSegment<int32_t>>(
+                           mvcc_table.get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+                           ->values();
+  EXPECT_EQ(values.capacity(), 2u);
+  mvcc_table.append({4});
+  const auto data = values.data();
+  mvcc_table.append({6}, TransactionID{1});
+  EXPECT_EQ(values.data(), data);
+
+  // Compressed chunks keep their MVCC data, but only full chunks can be compressed.
+  mvcc_table.append({3});
+  EXPECT_THROW(mvcc_table.compress_chunk(ChunkID{1}), std::logic_error);
+  const auto mvcc_data = mvcc_table.get_chunk(ChunkID{0})->mvcc_data();
+  mvcc_table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(mvcc_table.get_chunk(ChunkID{0})->mvcc_data(), mvcc_data);
+
+  EXPECT_EQ(mvcc_data->size(), 2u);
+  EXPECT_EQ(mvcc_data->tid(0), INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data->begin_cid(0), CommitID{0});
+  EXPECT_EQ(mvcc_data->tid(1), TransactionID{1});
+  EXPECT_EQ(mvcc_data->begin_cid(1), MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data->end_cid(1), MAX_COMMIT_ID);
+}
+
+TEST_F(StorageTableTest, CompressionKeepsInvalidRowCount) {
+  auto mvcc_table = Table{2, UseMvcc::Yes};
+  mvcc_table.add_column("col_1", "int");
+  mvcc_table.append({4});
+  mvcc_table.append({6});
+  const auto old_chunk = mvcc_table.get_chunk(ChunkID{0});
+  old_chunk->increase_invalid_row_count(1);
+
+  // A transaction that got the chunk before it was compressed invalidates a row afterwards.
+  mvcc_table.compress_chunk(ChunkID{0});
+  old_chunk->increase_invalid_row_count(1);
+  EXPECT_EQ(mvcc_table.get_chunk(ChunkID{0})->invalid_row_count(), 2u);
+  EXPECT_EQ(mvcc_table.approx_valid_row_count(), 0u);
+}
+
+TEST_F(StorageTableTest, EmplaceChunkIntoMvccTable) {
+  auto mvcc_table = Table{3, UseMvcc::Yes};
+  mvcc_table.add_column("col_1", "int");
+  mvcc_table.append({1});
+
+  // Emplaced chunks become visible to all transactions. As they are not preallocated, appends start a new chunk.
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(std::make_shared<ValueSegment<int32_t>>());
+  chunk->append({2});
+  mvcc_table.emplace_chunk(chunk);
+  ASSERT_TRUE(chunk->has_mvcc_data());
+  EXPECT_EQ(chunk->mvcc_data()->size(), 1u);
+  EXPECT_EQ(chunk->mvcc_data()->begin_cid(0), CommitID{0});
+
+  EXPECT_EQ(mvcc_table.append({3}), (RowID{ChunkID{2}, 0}));
+  EXPECT_EQ(mvcc_table.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, MemoryUsage) {
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  table.append({3, "!"});
+  table.compress_chunk(ChunkID{0});
+
+  const auto chunk_memory_usage = [&](const ChunkID chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    return chunk->get_segment(ColumnID{0})->estimate_memory_usage() +
+           chunk->get_segment(ColumnID{1})->estimate_memory_usage();
+  };
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->memory_usage(), chunk_memory_usage(ChunkID{0}));
+  EXPECT_EQ(table.memory_usage(), chunk_memory_usage(ChunkID{0}) + chunk_memory_usage(ChunkID{1}));
+
+  auto mvcc_table = Table{2, UseMvcc::Yes};
+  mvcc_table.add_column("col_1", "int");
+  mvcc_table.append({1});
+  const auto& chunk = *mvcc_table.get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk.memory_usage(),
+            chunk.get_segment(ColumnID{0})->estimate_memory_usage() + chunk.mvcc_data()->estimate_memory_usage());
+}
+
 }  // namespace opossum
@@ -61,6 +61,24 @@ TEST_F(StorageValueSegmentTest, SubscriptOperator) {
   EXPECT_EQ(int_value_segment[1], AllTypeVariant(1338));
 }
 
+TEST_F(StorageValueSegmentTest, AppendNull) {
+  EXPECT_FALSE(int_value_segment.is_nullable());
+  EXPECT_THROW(int_value_segment.append(NULL_VALUE), std::logic_error);
+
+  auto nullable_segment = ValueSegment<int32_t>{true};
+  EXPECT_TRUE(nullable_segment.is_nullable());
+  nullable_segment.append(1);
+  nullable_segment.append(NULL_VALUE);
+  nullable_segment.append(3);
+
+  EXPECT_EQ(nullable_segment.size(), 3u);
+  EXPECT_FALSE(nullable_segment.is_null(0));
+  EXPECT_TRUE(nullable_segment.is_null(1));
+  EXPECT_TRUE(variant_is_null(nullable_segment[1]));
+  EXPECT_EQ(nullable_segment[2], AllTypeVariant{3});
+  EXPECT_EQ(nullable_segment.null_bitmap()->null_count(), 1u);
+}
+
 TEST_F(StorageValueSegmentTest, Values) {
   int_value_segment.append(1337);
   int_value_segment.append(1338);
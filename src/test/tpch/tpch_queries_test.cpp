@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/abstract_operator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_queries.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+namespace opossum {
+
+class TpchQueriesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TpchTableGenerator{0.005f, ChunkOffset{5000}}.generate_and_store();
+  }
+
+  static std::shared_ptr<const Table> _execute(const TpchQuery& query) {
+    const auto plan = query.create_plan();
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(plan));
+    return plan->get_output();
+  }
+};
+
+TEST_F(TpchQueriesTest, Q6MatchesBruteForce) {
+  const auto lineitem = StorageManager::get().get_table("lineitem");
+  const auto quantity_id = lineitem->column_id_by_name("l_quantity");
+  const auto discount_id = lineitem->column_id_by_name("l_discount");
+  const auto shipdate_id = lineitem->column_id_by_name("l_shipdate");
+  const auto extendedprice_id = lineitem->column_id_by_name("l_extendedprice");
+
+  auto expected_row_count = int64_t{0};
+  auto expected_revenue = 0.0;
+  for (auto chunk_id = ChunkID{0}; chunk_id < lineitem->chunk_count(); ++chunk_id) {
+    const auto chunk = lineitem->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto quantity = type_cast<float>((*chunk->get_segment(quantity_id))[chunk_offset]);
+      const auto discount = type_cast<float>((*chunk->get_segment(discount_id))[chunk_offset]);
+      const auto shipdate = type_cast<std::string>((*chunk->get_segment(shipdate_id))[chunk_offset]);
+      if (shipdate >= "1994-01-01" && shipdate < "1995-01-01" && discount >= 0.05f && discount <= 0.07f &&
+          quantity < 24.0f) {
+        ++expected_row_count;
+        expected_revenue += type_cast<float>((*chunk->get_segment(extendedprice_id))[chunk_offset]);
+      }
+    }
+  }
+  ASSERT_GT(expected_row_count, 0);
+
+  const auto& queries = tpch_queries();
+  const auto q6 = std::find_if(queries.begin(), queries.end(), [](const auto& query) { return query.name == "Q6"; });
+  ASSERT_NE(q6, queries.end());
+  const auto output = _execute(*q6);
+  ASSERT_EQ(output->row_count(), 1u);
+  const auto& chunk = *output->get_chunk(ChunkID{0});
+  // The sums add up the same values in a different order.
+  EXPECT_NEAR(type_cast<double>((*chunk.get_segment(ColumnID{0}))[0]), expected_revenue, expected_revenue * 1e-9);
+  EXPECT_EQ(type_cast<int64_t>((*chunk.get_segment(ColumnID{1}))[0]), expected_row_count);
+}
+
+TEST_F(TpchQueriesTest, Q1HasOneRowPerGroup) {
+  const auto& queries = tpch_queries();
+  const auto q1 = std::find_if(queries.begin(), queries.end(), [](const auto& query) { return query.name == "Q1"; });
+  ASSERT_NE(q1, queries.end());
+  const auto output = _execute(*q1);
+  // The generator creates the (l_returnflag, l_linestatus) pairs (A, F), (N, F), (N, O), and (R, F).
+  EXPECT_EQ(output->row_count(), 4u);
+  EXPECT_EQ(output->column_count(), 8u);
+}
+
+TEST_F(TpchQueriesTest, AllQueriesRunWithScheduler) {
+  const auto& queries = tpch_queries();
+  ASSERT_EQ(queries.size(), 4u);
+
+  auto single_threaded_row_counts = std::vector<ChunkOffset>{};
+  for (const auto& query : queries) {
+    single_threaded_row_counts.emplace_back(_execute(query)->row_count());
+    EXPECT_GT(single_threaded_row_counts.back(), 0u) << query.name;
+  }
+
+  CurrentScheduler::set(std::make_shared<Scheduler>(4));
+  for (auto query_index = size_t{0}; query_index < queries.size(); ++query_index) {
+    EXPECT_EQ(_execute(queries[query_index])->row_count(), single_threaded_row_counts[query_index]);
+  }
+}
+
+}  // namespace opossum
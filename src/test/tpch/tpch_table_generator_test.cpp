@@ -0,0 +1,84 @@
+#include <memory>
+#include <set>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+namespace opossum {
+
+class TpchTableGeneratorTest : public BaseTest {
+ protected:
+  template <typename T>
+  static std::set<T> _distinct_values(const Table& table, const std::string& column_name) {
+    const auto column_id = table.column_id_by_name(column_name);
+    auto values = std::set<T>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        values.emplace(type_cast<T>(segment[chunk_offset]));
+      }
+    }
+    return values;
+  }
+};
+
+TEST_F(TpchTableGeneratorTest, RowCounts) {
+  const auto tables = TpchTableGenerator{0.01f, ChunkOffset{1000}}.generate();
+  ASSERT_EQ(tables.size(), 8u);
+  EXPECT_EQ(tables.at("region")->row_count(), 5u);
+  EXPECT_EQ(tables.at("nation")->row_count(), 25u);
+  EXPECT_EQ(tables.at("supplier")->row_count(), 100u);
+  EXPECT_EQ(tables.at("customer")->row_count(), 1500u);
+  EXPECT_EQ(tables.at("part")->row_count(), 2000u);
+  EXPECT_EQ(tables.at("partsupp")->row_count(), 8000u);
+  EXPECT_EQ(tables.at("orders")->row_count(), 15000u);
+
+  // Each order has between one and seven lineitems.
+  const auto lineitem_count = tables.at("lineitem")->row_count();
+  EXPECT_GE(lineitem_count, 15000u);
+  EXPECT_LE(lineitem_count, 7u * 15000u);
+  EXPECT_EQ(tables.at("lineitem")->target_chunk_size(), 1000u);
+}
+
+TEST_F(TpchTableGeneratorTest, ValueDomains) {
+  const auto tables = TpchTableGenerator{0.01f}.generate();
+
+  EXPECT_EQ(_distinct_values<std::string>(*tables.at("lineitem"), "l_returnflag"),
+            (std::set<std::string>{"A", "N", "R"}));
+  EXPECT_EQ(_distinct_values<std::string>(*tables.at("lineitem"), "l_linestatus"), (std::set<std::string>{"F", "O"}));
+  EXPECT_EQ(_distinct_values<std::string>(*tables.at("orders"), "o_orderstatus"),
+            (std::set<std::string>{"F", "O", "P"}));
+
+  const auto discounts = _distinct_values<float>(*tables.at("lineitem"), "l_discount");
+  EXPECT_EQ(discounts.size(), 11u);
+  EXPECT_FLOAT_EQ(*discounts.begin(), 0.0f);
+  EXPECT_FLOAT_EQ(*discounts.rbegin(), 0.1f);
+
+  const auto ship_dates = _distinct_values<std::string>(*tables.at("lineitem"), "l_shipdate");
+  EXPECT_GE(*ship_dates.begin(), "1992-01-02");
+  EXPECT_LE(*ship_dates.rbegin(), "1998-12-01");
+
+  // Every third customer does not place orders.
+  for (const auto customer_key : _distinct_values<int32_t>(*tables.at("orders"), "o_custkey")) {
+    EXPECT_NE(customer_key % 3, 0);
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, GenerationIsDeterministic) {
+  const auto first = TpchTableGenerator{0.001f}.generate();
+  const auto second = TpchTableGenerator{0.001f}.generate();
+  EXPECT_TABLE_EQ(first.at("lineitem"), second.at("lineitem"), true);
+}
+
+TEST_F(TpchTableGeneratorTest, StoreEncodedTables) {
+  TpchTableGenerator{0.001f}.generate_and_store(EncodingType::Dictionary);
+  const auto lineitem = StorageManager::get().get_table("lineitem");
+  EXPECT_EQ(lineitem->get_chunk(ChunkID{0})->encoding_types().front(), EncodingType::Dictionary);
+  EXPECT_TRUE(StorageManager::get().has_table("region"));
+}
+
+}  // namespace opossum